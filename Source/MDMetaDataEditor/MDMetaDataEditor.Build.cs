@@ -8,13 +8,25 @@ public class MDMetaDataEditor : ModuleRules
 	{
 		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
 
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine"
+			}
+		);
+
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
 				"ApplicationCore",
+				"AssetRegistry",
 				"BlueprintGraph",
+				"ContentBrowser",
 				"Core",
 				"CoreUObject",
+				"DataValidation",
 				"DeveloperSettings",
 				"EditorFramework",
 				"Engine",
@@ -22,11 +34,16 @@ public class MDMetaDataEditor : ModuleRules
 				"GameplayTagsEditor",
 				"InputCore",
 				"KismetWidgets",
+				"MDMetaDataEditorGraph",
+				"MDMetaDataRuntime",
 				"Slate",
 				"SlateCore",
+				"SourceControl",
+				"ToolMenus",
 				"UMG",
 				"UMGEditor",
-				"UnrealEd"
+				"UnrealEd",
+				"WorkspaceMenuStructure"
 			}
 		);
 
@@ -0,0 +1,90 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataTagRedirectCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Export/MDMetaDataExporter.h"
+#include "Modules/ModuleManager.h"
+#include "References/MDMetaDataTagRedirector.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMDMetaDataTagRedirect, Log, All);
+
+UMDMetaDataTagRedirectCommandlet::UMDMetaDataTagRedirectCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Rewrites GameplayTag and GameplayTagContainer meta data values that name a redirected tag");
+	HelpUsage = TEXT("<Editor.exe> <MyProject.uproject> -run=MDMetaDataTagRedirect [-Paths=/Game/Foo+/Game/Bar] [-DryRun]");
+	HelpParamNames = { TEXT("Paths"), TEXT("DryRun") };
+	HelpParamDescriptions = {
+		TEXT("The package paths to search, separated by +. Defaults to /Game"),
+		TEXT("Only list the values that would be rewritten")
+	};
+}
+
+int32 UMDMetaDataTagRedirectCommandlet::Main(const FString& Params)
+{
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	TMap<FString, FString> ParamValues;
+	ParseCommandLine(*Params, Tokens, Switches, ParamValues);
+
+	const bool bDryRun = Switches.Contains(TEXT("DryRun"));
+
+	TArray<FString> PackagePaths;
+	if (const FString* PathsValue = ParamValues.Find(TEXT("Paths")))
+	{
+		PathsValue->ParseIntoArray(PackagePaths, TEXT("+"));
+	}
+
+	if (PackagePaths.IsEmpty())
+	{
+		PackagePaths.Add(TEXT("/Game"));
+	}
+
+	TMap<FName, FName> Redirects;
+	FMDMetaDataTagRedirector::GatherRedirects(Redirects);
+	if (Redirects.IsEmpty())
+	{
+		UE_LOG(LogMDMetaDataTagRedirect, Display, TEXT("No GameplayTag redirects are configured"));
+		return 0;
+	}
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	TArray<FAssetData> Assets;
+	FMDMetaDataExporter::GatherAssets(PackagePaths, Assets);
+
+	FMDMetaDataTagIndex TagIndex;
+	TagIndex.Build(Assets);
+
+	TArray<FMDMetaDataTagRewrite> Rewrites;
+	TagIndex.FindRewrites(Redirects, Rewrites);
+
+	UE_LOG(LogMDMetaDataTagRedirect, Display, TEXT("Found %d tag-valued meta data values in %d assets, %d name a redirected tag"), TagIndex.GetNumValues(), Assets.Num(), Rewrites.Num());
+	for (const FMDMetaDataTagRewrite& Rewrite : Rewrites)
+	{
+		UE_LOG(LogMDMetaDataTagRedirect, Display, TEXT("%s %s"), *Rewrite.TagValue.AssetPath.ToString(), *FMDMetaDataTagRedirector::DescribeRewrite(Rewrite).ToString());
+	}
+
+	if (bDryRun || Rewrites.IsEmpty())
+	{
+		return 0;
+	}
+
+	bool bSaveFailed = false;
+	const int32 NumChangedAssets = FMDMetaDataTagRedirector::ApplyRewrites(Rewrites, Redirects, true, &bSaveFailed);
+	if (bSaveFailed)
+	{
+		UE_LOG(LogMDMetaDataTagRedirect, Error, TEXT("Rewrote %d assets but some of them failed to save"), NumChangedAssets);
+		return 1;
+	}
+
+	UE_LOG(LogMDMetaDataTagRedirect, Display, TEXT("Rewrote and saved %d assets"), NumChangedAssets);
+
+	return 0;
+}
@@ -0,0 +1,22 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+
+#include "MDMetaDataTagRedirectCommandlet.generated.h"
+
+/**
+ * Applies the project's GameplayTag redirects to tag-valued meta data without opening the editor, and saves the changed assets.
+ * Usage: -run=MDMetaDataTagRedirect [-Paths=/Game/Foo+/Game/Bar] [-DryRun]
+ */
+UCLASS()
+class UMDMetaDataTagRedirectCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UMDMetaDataTagRedirectCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
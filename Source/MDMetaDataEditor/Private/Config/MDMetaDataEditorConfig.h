@@ -4,10 +4,15 @@
 
 #include "EdGraphSchema_K2.h"
 #include "Engine/DeveloperSettings.h"
+#include "HAL/CriticalSection.h"
 #include "Types/MDMetaDataKey.h"
+#include "Types/MDMetaDataPreset.h"
 
 #include "MDMetaDataEditorConfig.generated.h"
 
+class FMDMetaDataEditorConfigSnapshot;
+class UMDMetaDataKeyPack;
+
 /**
  * Configure which meta data keys will display on blueprint Properties and Functions.
  * Can be setup per Blueprint type and Property type.
@@ -32,6 +37,22 @@ public:
 	void ForEachFunctionMetaDataKey(const UBlueprint* Blueprint, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
 	void ForEachStructMetaDataKey(const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
 
+	// Immutable copy of the current keys that can be queried from any thread, replaced whenever the config changes
+	TSharedRef<const FMDMetaDataEditorConfigSnapshot> GetSnapshot() const;
+
+	// Broadcast on the game thread after the keys are edited and the snapshot has been rebuilt
+	FSimpleMulticastDelegate OnMetaDataKeysChanged;
+
+	// Loads any key packs that target the Blueprint's type and haven't been loaded yet
+	void LoadKeyPacksForBlueprint(const UBlueprint* Blueprint);
+	void OnKeyPackChanged(const UMDMetaDataKeyPack* KeyPack);
+
+	UFUNCTION()
+	TArray<FName> GetMetaDataKeyNames() const;
+
+	const TArray<FMDMetaDataPreset>& GetMetaDataPresets() const { return MetaDataPresets; }
+	const FMDMetaDataPreset* FindMetaDataPreset(FName PresetName) const;
+
 	// If true, the metadata keys will automatically be sorted alphabetically
 	UPROPERTY(EditDefaultsOnly, Config, Category = "Meta Data Editor")
 	bool bSortMetaDataAlphabetically = true;
@@ -63,14 +84,32 @@ public:
 	UPROPERTY(EditDefaultsOnly, Config, Category = "Meta Data Editor")
 	bool bEnablePropertyVisibilityEditor = true;
 
+	// If true, compiling a Blueprint will warn about meta data values that break the rules of their keys, such as a ClampMin greater than its ClampMax
+	UPROPERTY(EditDefaultsOnly, Config, Category = "Meta Data Editor")
+	bool bValidateMetaDataOnCompile = true;
+
 #if WITH_EDITOR
-	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+	virtual void PostEditChangeChainProperty(struct FPropertyChangedChainEvent& PropertyChangedEvent) override;
 #endif //WITH_EDITOR
 
 private:
-	UFUNCTION()
-	TArray<FName> GetMetaDataKeyNames() const;
+	// Sorts and fixes up the keys loaded from the ini
+	void ProcessMetaDataKeys();
+	static void FixUpMetaDataKey(FMDMetaDataKey& Key);
+
+	// Returns false if the keys are the same as the current snapshot's, in which case it's kept
+	bool RebuildSnapshot();
+
+	mutable FRWLock SnapshotLock;
+	TSharedPtr<const FMDMetaDataEditorConfigSnapshot> Snapshot;
 
 	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Keys", meta = (TitleProperty = "{Key} ({KeyType})"))
 	TArray<FMDMetaDataKey> MetaDataKeys;
+
+	// Named sets of meta data values that can be applied to one or many fields at once, from the details panel or the Metadata Matrix
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Presets", meta = (TitleProperty = "PresetName"))
+	TArray<FMDMetaDataPreset> MetaDataPresets;
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UMDMetaDataKeyPack>> LoadedKeyPacks;
 };
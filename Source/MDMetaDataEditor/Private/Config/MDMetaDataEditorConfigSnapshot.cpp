@@ -0,0 +1,398 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEditorConfigSnapshot.h"
+
+#include "Algo/Transform.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Misc/Crc.h"
+
+FMDMetaDataResolvedClass::FMDMetaDataResolvedClass(const UClass* Class)
+{
+	check(IsInGameThread());
+
+	// A loaded class has all of its super classes loaded, so comparing their paths is the same as IsChildOf
+	for (; Class != nullptr; Class = Class->GetSuperClass())
+	{
+		ClassPaths.Emplace(Class->GetClassPathName());
+	}
+}
+
+FMDMetaDataEditorCompiledKey::FMDMetaDataEditorCompiledKey(const FMDMetaDataKey& InKey)
+	: Key(InKey)
+{
+	if (Key.bCanBeUsedOnVariables)
+	{
+		Usage |= EMDMetaDataKeyUsage::Variables;
+	}
+	if (Key.bCanBeUsedOnLocalVariables)
+	{
+		Usage |= EMDMetaDataKeyUsage::LocalVariables;
+	}
+	if (Key.bCanBeUsedOnFunctionParameters)
+	{
+		Usage |= EMDMetaDataKeyUsage::FunctionParameters;
+	}
+	if (Key.bCanBeUsedByFunctions)
+	{
+		Usage |= EMDMetaDataKeyUsage::Functions;
+	}
+	if (Key.bCanBeUsedByStructs)
+	{
+		Usage |= EMDMetaDataKeyUsage::Structs;
+	}
+
+	SupportedBlueprintClassPaths.Reserve(Key.SupportedBlueprints.Num());
+	for (const TSoftClassPtr<UBlueprint>& BPClass : Key.SupportedBlueprints)
+	{
+		if (!BPClass.IsNull())
+		{
+			SupportedBlueprintClassPaths.Emplace(BPClass.ToSoftObjectPath().GetAssetPath());
+		}
+	}
+
+	SupportedPropertyTypes.Reserve(Key.SupportedPropertyTypes.Num());
+	for (const FMDMetaDataEditorPropertyType& PropertyType : Key.SupportedPropertyTypes)
+	{
+		SupportedPropertyTypes.Emplace(PropertyType);
+	}
+
+	TArray<FString> Subgroups;
+	Key.Category.ParseIntoArray(Subgroups, TEXT("|"));
+	for (FString& Subgroup : Subgroups)
+	{
+		if (!FText::FromString(Subgroup).IsEmptyOrWhitespace())
+		{
+			CategoryPath.Emplace(MoveTemp(Subgroup));
+		}
+	}
+
+	if (Key.KeyType == EMDMetaDataEditorKeyType::ValueList)
+	{
+		AllowedValues.Append(Key.ValueList);
+	}
+}
+
+bool FMDMetaDataEditorCompiledKey::DoesSupportBlueprintClass(const FMDMetaDataResolvedClass& BlueprintClass) const
+{
+	for (const FTopLevelAssetPath& ClassPath : BlueprintClass.ClassPaths)
+	{
+		if (SupportedBlueprintClassPaths.Contains(ClassPath))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FMDMetaDataEditorCompiledKey::DoesSupportPinType(const FMDMetaDataResolvedPinType& PinType) const
+{
+	for (const FMDMetaDataEditorCompiledPropertyType& PropertyType : SupportedPropertyTypes)
+	{
+		if (PropertyType.DoesMatchPinType(PinType))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FMDMetaDataEditorCompiledKey::DoesSupportProperty(const FProperty* Property) const
+{
+	for (const FMDMetaDataEditorCompiledPropertyType& PropertyType : SupportedPropertyTypes)
+	{
+		if (PropertyType.DoesMatchProperty(Property))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+TSharedRef<const FMDMetaDataEditorConfigSnapshot> FMDMetaDataEditorConfigSnapshot::Create(const TArray<FMDMetaDataKey>& MetaDataKeys, const TSharedPtr<const FMDMetaDataEditorConfigSnapshot>& PreviousSnapshot)
+{
+	check(IsInGameThread());
+
+	TSharedRef<FMDMetaDataEditorConfigSnapshot> Snapshot = MakeShared<FMDMetaDataEditorConfigSnapshot>();
+	Snapshot->Keys.Reserve(MetaDataKeys.Num());
+	bool bIsUnchanged = PreviousSnapshot.IsValid() && PreviousSnapshot->Keys.Num() == MetaDataKeys.Num();
+	TArray<int32> PreviousIndices;
+	for (int32 KeyIndex = 0; KeyIndex < MetaDataKeys.Num(); ++KeyIndex)
+	{
+		const FMDMetaDataKey& MetaDataKey = MetaDataKeys[KeyIndex];
+		const FMDMetaDataEditorCompiledKey* PreviousKey = nullptr;
+		if (PreviousSnapshot.IsValid())
+		{
+			PreviousIndices.Reset();
+			PreviousSnapshot->FindKeyIndices(MetaDataKey.Key, PreviousIndices);
+			for (const int32 PreviousIndex : PreviousIndices)
+			{
+				if (FMDMetaDataKey::StaticStruct()->CompareScriptStruct(&PreviousSnapshot->Keys[PreviousIndex].Key, &MetaDataKey, PPF_None))
+				{
+					PreviousKey = &PreviousSnapshot->Keys[PreviousIndex];
+					bIsUnchanged &= PreviousIndex == KeyIndex;
+					break;
+				}
+			}
+		}
+
+		bIsUnchanged &= PreviousKey != nullptr;
+		if (PreviousKey != nullptr)
+		{
+			Snapshot->Keys.Add(*PreviousKey);
+		}
+		else
+		{
+			Snapshot->Keys.Emplace(MetaDataKey);
+		}
+
+		Snapshot->KeyIndices.Add(MetaDataKeys[KeyIndex].Key, KeyIndex);
+		Snapshot->ValidatedMetaData.Add(MetaDataKeys[KeyIndex].Key);
+
+		if (MetaDataKeys[KeyIndex].bAvailableAtRuntime)
+		{
+			Snapshot->RuntimeKeys.Add(MetaDataKeys[KeyIndex].Key);
+		}
+
+		if (MetaDataKeys[KeyIndex].KeyType == EMDMetaDataEditorKeyType::Param)
+		{
+			Snapshot->ParamKeys.Add(MetaDataKeys[KeyIndex].Key);
+		}
+	}
+
+	if (bIsUnchanged)
+	{
+		return PreviousSnapshot.ToSharedRef();
+	}
+
+	// Resolve constraints once all keys have an index
+	TArray<int32> ConstraintIndices;
+	for (FMDMetaDataEditorCompiledKey& CompiledKey : Snapshot->Keys)
+	{
+		const FMDMetaDataKey& Key = CompiledKey.Key;
+		CompiledKey.RequiredKeys.Init(false, MetaDataKeys.Num());
+		CompiledKey.IncompatibleKeys.Init(false, MetaDataKeys.Num());
+		CompiledKey.UnindexedRequiredMetaData = NAME_None;
+		CompiledKey.UnindexedIncompatibleMetaData.Reset();
+
+		if (Key.RequiredMetaData != Key.Key && !Key.RequiredMetaData.IsNone())
+		{
+			ConstraintIndices.Reset();
+			Snapshot->KeyIndices.MultiFind(Key.RequiredMetaData, ConstraintIndices);
+			if (ConstraintIndices.IsEmpty())
+			{
+				CompiledKey.UnindexedRequiredMetaData = Key.RequiredMetaData;
+				Snapshot->ValidatedMetaData.Add(Key.RequiredMetaData);
+			}
+
+			for (const int32 ConstraintIndex : ConstraintIndices)
+			{
+				CompiledKey.RequiredKeys[ConstraintIndex] = true;
+			}
+		}
+
+		for (const FName& IncompatibleKey : Key.IncompatibleMetaData)
+		{
+			if (IncompatibleKey == Key.Key || IncompatibleKey.IsNone())
+			{
+				continue;
+			}
+
+			ConstraintIndices.Reset();
+			Snapshot->KeyIndices.MultiFind(IncompatibleKey, ConstraintIndices);
+			if (ConstraintIndices.IsEmpty())
+			{
+				CompiledKey.UnindexedIncompatibleMetaData.Add(IncompatibleKey);
+				Snapshot->ValidatedMetaData.Add(IncompatibleKey);
+			}
+
+			for (const int32 ConstraintIndex : ConstraintIndices)
+			{
+				CompiledKey.IncompatibleKeys[ConstraintIndex] = true;
+			}
+		}
+	}
+
+	// FName hashes aren't stable between sessions and names compare without case, so hash the sorted lower case strings
+	TArray<FString> ValidatedNames;
+	Algo::Transform(Snapshot->ValidatedMetaData, ValidatedNames, [](const FName& Name) { return Name.ToString().ToLower(); });
+	ValidatedNames.Sort();
+	Snapshot->ValidatedMetaDataHash = FCrc::StrCrc32(*FString::Join(ValidatedNames, TEXT("\n")));
+
+	return Snapshot;
+}
+
+void FMDMetaDataEditorConfigSnapshot::FindKeyIndices(FName Key, TArray<int32>& OutKeyIndices) const
+{
+	KeyIndices.MultiFind(Key, OutKeyIndices);
+}
+
+void FMDMetaDataEditorConfigSnapshot::ForEachKeyIndex(EMDMetaDataKeyUsage Usage, const FMDMetaDataResolvedClass* BlueprintClass, const FMDMetaDataResolvedPinType* PinType, const TFunctionRef<void(int32)>& Func) const
+{
+	for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); ++KeyIndex)
+	{
+		const FMDMetaDataEditorCompiledKey& CompiledKey = Keys[KeyIndex];
+		if (Usage != EMDMetaDataKeyUsage::None && !EnumHasAnyFlags(CompiledKey.Usage, Usage))
+		{
+			continue;
+		}
+
+		if (BlueprintClass != nullptr && !CompiledKey.DoesSupportBlueprintClass(*BlueprintClass))
+		{
+			continue;
+		}
+
+		if (PinType != nullptr && !CompiledKey.DoesSupportPinType(*PinType))
+		{
+			continue;
+		}
+
+		Func(KeyIndex);
+	}
+}
+
+void FMDMetaDataEditorConfigSnapshot::ForEachVariableMetaDataKey(const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+{
+	ForEachPropertyMetaDataKeyForUsage(EMDMetaDataKeyUsage::Variables, BlueprintClass, Property, Func);
+}
+
+void FMDMetaDataEditorConfigSnapshot::ForEachLocalVariableMetaDataKey(const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+{
+	ForEachPropertyMetaDataKeyForUsage(EMDMetaDataKeyUsage::LocalVariables, BlueprintClass, Property, Func);
+}
+
+void FMDMetaDataEditorConfigSnapshot::ForEachParameterMetaDataKey(const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+{
+	ForEachPropertyMetaDataKeyForUsage(EMDMetaDataKeyUsage::FunctionParameters, BlueprintClass, Property, Func);
+}
+
+void FMDMetaDataEditorConfigSnapshot::ForEachPropertyMetaDataKey(const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+{
+	ForEachPropertyMetaDataKeyForUsage(EMDMetaDataKeyUsage::None, BlueprintClass, Property, Func);
+}
+
+void FMDMetaDataEditorConfigSnapshot::ForEachStructPropertyMetaDataKey(const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+{
+	// Test as if the struct were a basic blueprint
+	ForEachPropertyMetaDataKeyForUsage(EMDMetaDataKeyUsage::None, UBlueprint::StaticClass(), Property, Func);
+}
+
+void FMDMetaDataEditorConfigSnapshot::ForEachFunctionMetaDataKey(const UClass* BlueprintClass, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+{
+	if (BlueprintClass == nullptr)
+	{
+		return;
+	}
+
+	const FMDMetaDataResolvedClass ResolvedClass(BlueprintClass);
+	ForEachKeyIndex(EMDMetaDataKeyUsage::Functions, &ResolvedClass, nullptr, [this, &Func](int32 KeyIndex)
+	{
+		Func(Keys[KeyIndex].Key);
+	});
+}
+
+void FMDMetaDataEditorConfigSnapshot::ForEachStructMetaDataKey(const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+{
+	ForEachKeyIndex(EMDMetaDataKeyUsage::Structs, nullptr, nullptr, [this, &Func](int32 KeyIndex)
+	{
+		Func(Keys[KeyIndex].Key);
+	});
+}
+
+TBitArray<> FMDMetaDataEditorConfigSnapshot::GetPresentKeys(const TMap<FName, FString>* MetaDataMap) const
+{
+	TBitArray<> PresentKeys(false, Keys.Num());
+	if (MetaDataMap != nullptr)
+	{
+		TArray<int32> MatchingIndices;
+		for (const TPair<FName, FString>& MetaDataPair : *MetaDataMap)
+		{
+			MatchingIndices.Reset();
+			KeyIndices.MultiFind(MetaDataPair.Key, MatchingIndices);
+			for (const int32 KeyIndex : MatchingIndices)
+			{
+				PresentKeys[KeyIndex] = true;
+			}
+		}
+	}
+
+	return PresentKeys;
+}
+
+bool FMDMetaDataEditorConfigSnapshot::AreKeyConstraintsMet(int32 KeyIndex, const TBitArray<>& PresentKeys, const TMap<FName, FString>* MetaDataMap) const
+{
+	const FMDMetaDataEditorCompiledKey& CompiledKey = Keys[KeyIndex];
+
+	if (!CompiledKey.UnindexedRequiredMetaData.IsNone() && (MetaDataMap == nullptr || !MetaDataMap->Contains(CompiledKey.UnindexedRequiredMetaData)))
+	{
+		return false;
+	}
+
+	if (TConstSetBitIterator<> RequiredIt(CompiledKey.RequiredKeys); RequiredIt)
+	{
+		bool bHasRequiredKey = false;
+		for (; RequiredIt && !bHasRequiredKey; ++RequiredIt)
+		{
+			bHasRequiredKey = PresentKeys[RequiredIt.GetIndex()];
+		}
+
+		if (!bHasRequiredKey)
+		{
+			return false;
+		}
+	}
+
+	for (TConstSetBitIterator<> IncompatibleIt(CompiledKey.IncompatibleKeys); IncompatibleIt; ++IncompatibleIt)
+	{
+		if (PresentKeys[IncompatibleIt.GetIndex()])
+		{
+			return false;
+		}
+	}
+
+	if (MetaDataMap != nullptr)
+	{
+		for (const FName& IncompatibleKey : CompiledKey.UnindexedIncompatibleMetaData)
+		{
+			if (MetaDataMap->Contains(IncompatibleKey))
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+void FMDMetaDataEditorConfigSnapshot::ForEachPropertyMetaDataKeyForUsage(EMDMetaDataKeyUsage Usage, const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
+{
+	if (BlueprintClass == nullptr || Property == nullptr)
+	{
+		return;
+	}
+
+	const FMDMetaDataResolvedClass ResolvedClass(BlueprintClass);
+
+	FEdGraphPinType PinType;
+	if (GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(Property, PinType))
+	{
+		const FMDMetaDataResolvedPinType ResolvedPinType(PinType);
+		ForEachKeyIndex(Usage, &ResolvedClass, &ResolvedPinType, [this, &Func](int32 KeyIndex)
+		{
+			Func(Keys[KeyIndex].Key);
+		});
+		return;
+	}
+
+	// Properties that a pin can't describe can still use wildcard keys
+	ForEachKeyIndex(Usage, &ResolvedClass, nullptr, [this, Property, &Func](int32 KeyIndex)
+	{
+		if (Keys[KeyIndex].DoesSupportProperty(Property))
+		{
+			Func(Keys[KeyIndex].Key);
+		}
+	});
+}
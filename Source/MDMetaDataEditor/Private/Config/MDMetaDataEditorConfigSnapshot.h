@@ -0,0 +1,126 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/BitArray.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Templates/SharedPointer.h"
+#include "Types/MDMetaDataKey.h"
+#include "UObject/TopLevelAssetPath.h"
+
+enum class EMDMetaDataKeyUsage : uint8
+{
+	None = 0,
+	Variables = 1 << 0,
+	LocalVariables = 1 << 1,
+	FunctionParameters = 1 << 2,
+	Functions = 1 << 3,
+	Structs = 1 << 4
+};
+ENUM_CLASS_FLAGS(EMDMetaDataKeyUsage);
+
+/**
+ * A Blueprint class and its super classes as paths.
+ * Must be created on the game thread, but can then be matched against keys from any thread.
+ */
+struct FMDMetaDataResolvedClass
+{
+	explicit FMDMetaDataResolvedClass(const UClass* Class);
+
+	TArray<FTopLevelAssetPath> ClassPaths;
+};
+
+/**
+ * A meta data key along with everything needed to test it without going back to the config
+ */
+struct FMDMetaDataEditorCompiledKey
+{
+	explicit FMDMetaDataEditorCompiledKey(const FMDMetaDataKey& InKey);
+
+	bool DoesSupportBlueprintClass(const FMDMetaDataResolvedClass& BlueprintClass) const;
+	bool DoesSupportPinType(const FMDMetaDataResolvedPinType& PinType) const;
+
+	// Must be called on the game thread
+	bool DoesSupportProperty(const FProperty* Property) const;
+
+	FMDMetaDataKey Key;
+
+	EMDMetaDataKeyUsage Usage = EMDMetaDataKeyUsage::None;
+
+	// Kept as paths so Blueprint classes from modules that load after the snapshot is made still match
+	TArray<FTopLevelAssetPath> SupportedBlueprintClassPaths;
+	TArray<FMDMetaDataEditorCompiledPropertyType> SupportedPropertyTypes;
+
+	// The non-empty sub groups of Key.Category
+	TArray<FString> CategoryPath;
+
+	// Key.RequiredMetaData and Key.IncompatibleMetaData as indices into the snapshot's keys.
+	// Constraints on meta data that isn't a configured key are kept by name.
+	TBitArray<> RequiredKeys;
+	TBitArray<> IncompatibleKeys;
+	FName UnindexedRequiredMetaData = NAME_None;
+	TArray<FName> UnindexedIncompatibleMetaData;
+
+	// Key.ValueList as a set, so values can be validated without a linear search
+	TSet<FString> AllowedValues;
+};
+
+/**
+ * Immutable copy of the meta data keys in UMDMetaDataEditorConfig.
+ * Must be created on the game thread, but can then be read from any thread.
+ * Matching keys against classes and pin types only reads paths, the functions that take UObjects or properties resolve them first so are game thread only.
+ */
+class FMDMetaDataEditorConfigSnapshot
+{
+public:
+	// Keys that are unchanged from PreviousSnapshot reuse its compiled keys, and if nothing changed PreviousSnapshot itself is returned
+	static TSharedRef<const FMDMetaDataEditorConfigSnapshot> Create(const TArray<FMDMetaDataKey>& MetaDataKeys, const TSharedPtr<const FMDMetaDataEditorConfigSnapshot>& PreviousSnapshot = nullptr);
+
+	const TArray<FMDMetaDataEditorCompiledKey>& GetKeys() const { return Keys; }
+
+	// Finds the indices of every key with this name, there can be more than one if they have different key types
+	void FindKeyIndices(FName Key, TArray<int32>& OutKeyIndices) const;
+
+	// Whether any key with this name is baked into generated classes for use at runtime
+	bool IsRuntimeKey(FName Key) const { return RuntimeKeys.Contains(Key); }
+	const TSet<FName>& GetRuntimeKeys() const { return RuntimeKeys; }
+
+	// Whether any key with this name has the Param key type
+	bool IsParamKey(FName Key) const { return ParamKeys.Contains(Key); }
+
+	// Whether validation reads this meta data, either as a key or as a constraint of one
+	bool IsValidatedMetaData(FName Name) const { return ValidatedMetaData.Contains(Name); }
+
+	// Changes whenever the validated meta data names do, so anything filtered by IsValidatedMetaData can tell when it's out of date
+	uint32 GetValidatedMetaDataHash() const { return ValidatedMetaDataHash; }
+
+	// Calls Func with the index of each key that can be used for Usage. None, or a null BlueprintClass or PinType, skips that test.
+	void ForEachKeyIndex(EMDMetaDataKeyUsage Usage, const FMDMetaDataResolvedClass* BlueprintClass, const FMDMetaDataResolvedPinType* PinType, const TFunctionRef<void(int32)>& Func) const;
+
+	// The ForEach*MetaDataKey functions resolve the class and property, so must be called on the game thread
+	void ForEachVariableMetaDataKey(const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
+	void ForEachLocalVariableMetaDataKey(const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
+	void ForEachParameterMetaDataKey(const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
+	void ForEachPropertyMetaDataKey(const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
+	void ForEachStructPropertyMetaDataKey(const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
+	void ForEachFunctionMetaDataKey(const UClass* BlueprintClass, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
+	void ForEachStructMetaDataKey(const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
+
+	// Bit N is set if the meta data map has a value for key N
+	TBitArray<> GetPresentKeys(const TMap<FName, FString>* MetaDataMap) const;
+	bool AreKeyConstraintsMet(int32 KeyIndex, const TBitArray<>& PresentKeys, const TMap<FName, FString>* MetaDataMap) const;
+
+private:
+	void ForEachPropertyMetaDataKeyForUsage(EMDMetaDataKeyUsage Usage, const UClass* BlueprintClass, const FProperty* Property, const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
+
+	TArray<FMDMetaDataEditorCompiledKey> Keys;
+
+	// Multiple keys can share a name if they have different key types
+	TMultiMap<FName, int32> KeyIndices;
+
+	TSet<FName> RuntimeKeys;
+	TSet<FName> ParamKeys;
+
+	TSet<FName> ValidatedMetaData;
+	uint32 ValidatedMetaDataHash = 0;
+};
@@ -0,0 +1,423 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEditorDefaultKeys.h"
+
+#include "Animation/WidgetAnimation.h"
+#include "Components/Widget.h"
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
+#include "Engine/DataTable.h"
+#include "GameplayTagContainer.h"
+#include "Types/MDMetaDataKey.h"
+#include "Types/MDMetaDataPreset.h"
+#include "WidgetBlueprint.h"
+
+#define LOCTEXT_NAMESPACE "MDMetaDataEditor"
+
+namespace MDMDEDK_Private
+{
+	// The shared sets of property types that default keys can support, built once per population
+	enum class ETypeSet : uint8
+	{
+		Wildcard,
+		None,
+		Bool,
+		Numeric,
+		Integer,
+		Float,
+		NonLocString,
+		AnyArray,
+		AnyMap,
+		StructArray,
+		AnyStruct,
+		Enum,
+		GameplayTag,
+		PrimaryAssetId,
+		DataTable,
+		Color,
+		SoftObject,
+		Class,
+		Widget,
+		WidgetAnimation,
+		Asset,
+		InstancedStruct,
+		SoftPath,
+
+		Count
+	};
+
+	enum class EBlueprintType : uint8
+	{
+		Blueprint,
+		WidgetBlueprint
+	};
+
+	// FText can't be built at compile time, so display name overrides are looked up when the key is created
+	enum class EDisplayName : uint8
+	{
+		None,
+		TagFilter,
+		AllowedStructClasses,
+		DisallowedStructClasses,
+		StructTypeConst
+	};
+
+	constexpr EMDMetaDataKeyUsage PropertyUsage = EMDMetaDataKeyUsage::Variables | EMDMetaDataKeyUsage::LocalVariables | EMDMetaDataKeyUsage::FunctionParameters;
+	constexpr EMDMetaDataKeyUsage NoParamUsage = EMDMetaDataKeyUsage::Variables | EMDMetaDataKeyUsage::LocalVariables;
+
+	struct FDefaultKey
+	{
+		constexpr FDefaultKey(const TCHAR* InKey, EMDMetaDataEditorKeyType InKeyType, ETypeSet InTypeSet, const TCHAR* InDescription, const TCHAR* InCategory = nullptr)
+			: Key(InKey)
+			, KeyType(InKeyType)
+			, TypeSet(InTypeSet)
+			, Description(InDescription)
+			, Category(InCategory)
+		{}
+
+		constexpr FDefaultKey SetUsage(EMDMetaDataKeyUsage InUsage) const { FDefaultKey Copy = *this; Copy.Usage = InUsage; return Copy; }
+		constexpr FDefaultKey SetBlueprintType(EBlueprintType InBlueprintType) const { FDefaultKey Copy = *this; Copy.BlueprintType = InBlueprintType; return Copy; }
+		constexpr FDefaultKey SetRequiredMetaData(const TCHAR* InRequiredMetaData) const { FDefaultKey Copy = *this; Copy.RequiredMetaData = InRequiredMetaData; return Copy; }
+		constexpr FDefaultKey SetIncompatibleMetaData(const TCHAR* InIncompatibleMetaData) const { FDefaultKey Copy = *this; Copy.IncompatibleMetaData = InIncompatibleMetaData; return Copy; }
+		constexpr FDefaultKey SetMinInt(int32 InMinInt) const { FDefaultKey Copy = *this; Copy.MinInt = InMinInt; return Copy; }
+		constexpr FDefaultKey SetMinFloat(float InMinFloat) const { FDefaultKey Copy = *this; Copy.MinFloat = InMinFloat; return Copy; }
+		constexpr FDefaultKey SetDisplayName(EDisplayName InDisplayName) const { FDefaultKey Copy = *this; Copy.DisplayName = InDisplayName; return Copy; }
+		constexpr FDefaultKey SetValueReference(EMDMetaDataValueReference InValueReference) const { FDefaultKey Copy = *this; Copy.ValueReference = InValueReference; return Copy; }
+		constexpr FDefaultKey SetMaxValueMetaData(const TCHAR* InMaxValueMetaData) const { FDefaultKey Copy = *this; Copy.MaxValueMetaData = InMaxValueMetaData; return Copy; }
+		constexpr FDefaultKey SetBaseType(const TCHAR* InBaseType) const { FDefaultKey Copy = *this; Copy.BaseType = InBaseType; return Copy; }
+		constexpr FDefaultKey AllowMultipleValues() const { FDefaultKey Copy = *this; Copy.bAllowMultipleValues = true; return Copy; }
+
+		const TCHAR* Key = nullptr;
+		EMDMetaDataEditorKeyType KeyType = EMDMetaDataEditorKeyType::Flag;
+		ETypeSet TypeSet = ETypeSet::Wildcard;
+		const TCHAR* Description = nullptr;
+		const TCHAR* Category = nullptr;
+		EMDMetaDataKeyUsage Usage = PropertyUsage;
+		EBlueprintType BlueprintType = EBlueprintType::Blueprint;
+		const TCHAR* RequiredMetaData = nullptr;
+		const TCHAR* IncompatibleMetaData = nullptr;
+		int32 MinInt = TNumericLimits<int32>::Lowest();
+		float MinFloat = TNumericLimits<float>::Lowest();
+		EDisplayName DisplayName = EDisplayName::None;
+		EMDMetaDataValueReference ValueReference = EMDMetaDataValueReference::None;
+		const TCHAR* MaxValueMetaData = nullptr;
+		// The path of the BaseClass or BaseStruct of Class and Struct keys
+		const TCHAR* BaseType = nullptr;
+		// Whether Class, Interface, Struct and Param keys are comma separated lists
+		bool bAllowMultipleValues = false;
+	};
+
+	// Must stay sorted by key (case insensitive) so the config doesn't need to sort the defaults, this is checked below
+	constexpr FDefaultKey DefaultKeys[] = {
+		FDefaultKey{ TEXT("AdvancedDisplay"), EMDMetaDataEditorKeyType::Param, ETypeSet::None, TEXT("Parameters that are hidden in the advanced section of the node until it's expanded.") }.SetUsage(EMDMetaDataKeyUsage::Functions).AllowMultipleValues(),
+		FDefaultKey{ TEXT("AllowAbstract"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Class, TEXT("Include abstract classes in the class picker for this property.") },
+		FDefaultKey{ TEXT("AllowedClasses"), EMDMetaDataEditorKeyType::Class, ETypeSet::Asset, TEXT("Filter the selection to classes that inherit from specific classes or implement specific interfaces.") }.AllowMultipleValues(),
+		FDefaultKey{ TEXT("AllowedClasses"), EMDMetaDataEditorKeyType::Struct, ETypeSet::InstancedStruct, TEXT("Inclusive list of allowed struct classes.") }.SetDisplayName(EDisplayName::AllowedStructClasses).AllowMultipleValues(),
+		FDefaultKey{ TEXT("AllowedTypes"), EMDMetaDataEditorKeyType::String, ETypeSet::PrimaryAssetId, TEXT("Limit which Primary Data Assets may be selected to one or more specific Primary Asset Types.") },
+		FDefaultKey{ TEXT("ArrayClamp"), EMDMetaDataEditorKeyType::String, ETypeSet::Integer, TEXT("Clamps the valid values that can be entered in the UI to be between 0 and the length of the array specified."), TEXT("Value Range") }.SetUsage(NoParamUsage),
+		FDefaultKey{ TEXT("AssetBundles"), EMDMetaDataEditorKeyType::String, ETypeSet::SoftObject, TEXT("The name of the bundle to store the secondary asset in.") },
+		FDefaultKey{ TEXT("AutoCreateRefTerm"), EMDMetaDataEditorKeyType::Param, ETypeSet::None, TEXT("Pass-by-reference parameters that use a default value when their pins aren't connected.") }.SetUsage(EMDMetaDataKeyUsage::Functions).AllowMultipleValues(),
+		FDefaultKey{ TEXT("BaseStruct"), EMDMetaDataEditorKeyType::Struct, ETypeSet::InstancedStruct, TEXT("The minimum allowable type holdable by this struct.") },
+		FDefaultKey{ TEXT("BindWidget"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Widget, TEXT("This property requires a widget be bound to it in any child Widget Blueprints."), TEXT("UMG|Bind Widget") }.SetBlueprintType(EBlueprintType::WidgetBlueprint).SetIncompatibleMetaData(TEXT("BindWidgetOptional")).SetUsage(EMDMetaDataKeyUsage::Variables),
+		FDefaultKey{ TEXT("BindWidgetAnim"), EMDMetaDataEditorKeyType::Flag, ETypeSet::WidgetAnimation, TEXT("This property requires a widget animation be bound to it in any child Widget Blueprints."), TEXT("UMG|Bind Widget Anim") }.SetBlueprintType(EBlueprintType::WidgetBlueprint).SetIncompatibleMetaData(TEXT("BindWidgetAnimOptional")).SetUsage(EMDMetaDataKeyUsage::Variables),
+		FDefaultKey{ TEXT("BindWidgetAnimOptional"), EMDMetaDataEditorKeyType::Flag, ETypeSet::WidgetAnimation, TEXT("This property allows a widget animation be bound to it in any child Widget Blueprints."), TEXT("UMG|Bind Widget Anim") }.SetBlueprintType(EBlueprintType::WidgetBlueprint).SetIncompatibleMetaData(TEXT("BindWidgetAnim")).SetUsage(EMDMetaDataKeyUsage::Variables),
+		FDefaultKey{ TEXT("BindWidgetOptional"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Widget, TEXT("This property allows a widget be bound to it in any child Widget Blueprints."), TEXT("UMG|Bind Widget") }.SetBlueprintType(EBlueprintType::WidgetBlueprint).SetIncompatibleMetaData(TEXT("BindWidget")).SetUsage(EMDMetaDataKeyUsage::Variables),
+		FDefaultKey{ TEXT("BlueprintBaseOnly"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Class, TEXT("Only allow selecting blueprint classes.") },
+		FDefaultKey{ TEXT("Categories"), EMDMetaDataEditorKeyType::GameplayTagContainer, ETypeSet::GameplayTag, TEXT("Limit which gameplay tags may be selected to one or more specific root tags.") }.SetDisplayName(EDisplayName::TagFilter),
+		FDefaultKey{ TEXT("ClampMax"), EMDMetaDataEditorKeyType::Integer, ETypeSet::Integer, TEXT("Specifies the maximum value that may be entered for the property."), TEXT("Value Range") },
+		FDefaultKey{ TEXT("ClampMax"), EMDMetaDataEditorKeyType::Float, ETypeSet::Float, TEXT("Specifies the maximum value that may be entered for the property."), TEXT("Value Range") },
+		FDefaultKey{ TEXT("ClampMin"), EMDMetaDataEditorKeyType::Integer, ETypeSet::Integer, TEXT("Specifies the minimum value that may be entered for the property."), TEXT("Value Range") }.SetMaxValueMetaData(TEXT("ClampMax")),
+		FDefaultKey{ TEXT("ClampMin"), EMDMetaDataEditorKeyType::Float, ETypeSet::Float, TEXT("Specifies the minimum value that may be entered for the property."), TEXT("Value Range") }.SetMaxValueMetaData(TEXT("ClampMax")),
+		FDefaultKey{ TEXT("DefaultToSelf"), EMDMetaDataEditorKeyType::Param, ETypeSet::None, TEXT("Specify which function parameter should default to \"self\".") }.SetUsage(EMDMetaDataKeyUsage::Functions),
+		FDefaultKey{ TEXT("Delta"), EMDMetaDataEditorKeyType::Integer, ETypeSet::Integer, TEXT("How much to change the value by when dragging.") },
+		FDefaultKey{ TEXT("Delta"), EMDMetaDataEditorKeyType::Float, ETypeSet::Float, TEXT("How much to change the value by when dragging.") },
+		FDefaultKey{ TEXT("DesignerRebuild"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Wildcard, TEXT("When this property changes, the widget preview will be rebuilt."), TEXT("UMG") }.SetBlueprintType(EBlueprintType::WidgetBlueprint).SetUsage(EMDMetaDataKeyUsage::Variables),
+		FDefaultKey{ TEXT("DisableSplitPin"), EMDMetaDataEditorKeyType::Flag, ETypeSet::None, TEXT("Indicates that node pins of this struct type cannot be split.") }.SetUsage(EMDMetaDataKeyUsage::Structs),
+		FDefaultKey{ TEXT("DisallowedClasses"), EMDMetaDataEditorKeyType::Class, ETypeSet::Asset, TEXT("Filter out classes that inherit from specific classes or implement specific interfaces from the selection.") }.AllowMultipleValues(),
+		FDefaultKey{ TEXT("DisallowedClasses"), EMDMetaDataEditorKeyType::Struct, ETypeSet::InstancedStruct, TEXT("List of struct classes to hide from picker.") }.SetDisplayName(EDisplayName::DisallowedStructClasses).AllowMultipleValues(),
+		FDefaultKey{ TEXT("DisplayAfter"), EMDMetaDataEditorKeyType::String, ETypeSet::Wildcard, TEXT("In the details panel, this property will be displayed after the property specified here.") }.SetUsage(NoParamUsage).SetValueReference(EMDMetaDataValueReference::Property),
+		FDefaultKey{ TEXT("DisplayPriority"), EMDMetaDataEditorKeyType::Integer, ETypeSet::Wildcard, TEXT("The priority to display this property in the deatils panel, lower values are first.") }.SetUsage(NoParamUsage),
+		FDefaultKey{ TEXT("DisplayThumbnail"), EMDMetaDataEditorKeyType::Boolean, ETypeSet::Asset, TEXT("Whether or not to display the asset thumbnail.") },
+		FDefaultKey{ TEXT("EditCondition"), EMDMetaDataEditorKeyType::String, ETypeSet::Wildcard, TEXT("Enter a condition to determine whether or not this property can be edited. Supports Bools and Enums.") }.SetUsage(NoParamUsage),
+		FDefaultKey{ TEXT("EditConditionHides"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Wildcard, TEXT("If this property's EditCondition is false, it will be hidden.") }.SetRequiredMetaData(TEXT("EditCondition")).SetUsage(NoParamUsage),
+		FDefaultKey{ TEXT("ExactClass"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Class, TEXT("Only allow selecting specifically from the list of allowed classes, no subclasses.") }.SetRequiredMetaData(TEXT("AllowedClasses")),
+		FDefaultKey{ TEXT("ExcludeBaseStruct"), EMDMetaDataEditorKeyType::Flag, ETypeSet::InstancedStruct, TEXT("Only allow subclasses of the BaseStruct type.") }.SetRequiredMetaData(TEXT("BaseStruct")),
+		FDefaultKey{ TEXT("ExpandEnumAsExecs"), EMDMetaDataEditorKeyType::Param, ETypeSet::None, TEXT("Expand the specified enum parameter into an exec pin for each of its values.") }.SetUsage(EMDMetaDataKeyUsage::Functions),
+		FDefaultKey{ TEXT("ForceInlineRow"), EMDMetaDataEditorKeyType::Flag, ETypeSet::AnyMap, TEXT("Force the Key and Value of a TMap to display in the same row.") },
+		FDefaultKey{ TEXT("GetOptions"), EMDMetaDataEditorKeyType::String, ETypeSet::NonLocString, TEXT("Specify a function that returns a list of Strings or Names that are valid values for this property. Seems to only support C++ functions since BP functions don't return anything for UFunction::GetReturnProperty().") },
+		FDefaultKey{ TEXT("HiddenByDefault"), EMDMetaDataEditorKeyType::Flag, ETypeSet::None, TEXT("Pins in Make and Break nodes are hidden by default.") }.SetUsage(EMDMetaDataKeyUsage::Structs),
+		FDefaultKey{ TEXT("HideAlphaChannel"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Color, TEXT("Hide the alpha channel from the color picker.") },
+		FDefaultKey{ TEXT("HidePin"), EMDMetaDataEditorKeyType::Param, ETypeSet::None, TEXT("Hide the specified parameter's pin on the node.") }.SetUsage(EMDMetaDataKeyUsage::Functions),
+		FDefaultKey{ TEXT("InlineEditConditionToggle"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Bool, TEXT("If this bool is an EditCondition for another property, it will be displayed inline.") }.SetUsage(NoParamUsage),
+		FDefaultKey{ TEXT("InvalidEnumValues"), EMDMetaDataEditorKeyType::EnumValue, ETypeSet::Enum, TEXT("Prevents selecting a subset of the enum's values.") },
+		FDefaultKey{ TEXT("MetaClass"), EMDMetaDataEditorKeyType::Class, ETypeSet::SoftPath, TEXT("Limit the selection to classes that inherit from the specified class.") },
+		FDefaultKey{ TEXT("Multiple"), EMDMetaDataEditorKeyType::Integer, ETypeSet::Integer, TEXT("Forces the property value to be a multiple of this value.") },
+		FDefaultKey{ TEXT("Multiple"), EMDMetaDataEditorKeyType::Float, ETypeSet::Float, TEXT("Forces the property value to be a multiple of this value.") },
+		FDefaultKey{ TEXT("MustImplement"), EMDMetaDataEditorKeyType::Interface, ETypeSet::Class, TEXT("Only allow classes that inherit the specified interface.") },
+		FDefaultKey{ TEXT("NoElementDuplicate"), EMDMetaDataEditorKeyType::Flag, ETypeSet::AnyArray, TEXT("Indicates that the duplicate icon should not be shown for entries of this array in the property panel.") },
+		FDefaultKey{ TEXT("NoResetToDefault"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Wildcard, TEXT("If set, this property will never show the 'Reset to Default' arrow button.") }.SetUsage(NoParamUsage),
+		FDefaultKey{ TEXT("NoSpinbox"), EMDMetaDataEditorKeyType::Boolean, ETypeSet::Numeric, TEXT("Disables the click and drag functionality for setting the value of this property.") },
+		FDefaultKey{ TEXT("RequiredAssetDataTags"), EMDMetaDataEditorKeyType::String, ETypeSet::DataTable, TEXT("Limit the selection to data tables with matching asset data tags.") },
+		FDefaultKey{ TEXT("RowType"), EMDMetaDataEditorKeyType::Struct, ETypeSet::DataTable, TEXT("Limit the selection to a specific data table row struct type.") }.SetBaseType(TEXT("/Script/Engine.TableRowBase")),
+		FDefaultKey{ TEXT("ShowOnlyInnerProperties"), EMDMetaDataEditorKeyType::Flag, ETypeSet::AnyStruct, TEXT("Removes the struct layer in the details panel, directly displaying the child properties of the struct.") }.SetUsage(NoParamUsage),
+		FDefaultKey{ TEXT("ShowTreeView"), EMDMetaDataEditorKeyType::Flag, ETypeSet::Class, TEXT("Show a tree of class inheritence instead of a list view for the class picker.") },
+		FDefaultKey{ TEXT("ShowTreeView"), EMDMetaDataEditorKeyType::Flag, ETypeSet::InstancedStruct, TEXT("Dispay the Struct Class picker as a tree view.") },
+		FDefaultKey{ TEXT("SliderExponent"), EMDMetaDataEditorKeyType::Integer, ETypeSet::Integer, TEXT("How fast the value should change while dragging to set the value.") }.SetMinInt(1),
+		FDefaultKey{ TEXT("SliderExponent"), EMDMetaDataEditorKeyType::Float, ETypeSet::Float, TEXT("How fast the value should change while dragging to set the value.") }.SetMinFloat(1.f),
+		FDefaultKey{ TEXT("StructTypeConst"), EMDMetaDataEditorKeyType::Flag, ETypeSet::InstancedStruct, TEXT("Struct class cannot be changed.") }.SetDisplayName(EDisplayName::StructTypeConst),
+		FDefaultKey{ TEXT("TitleProperty"), EMDMetaDataEditorKeyType::String, ETypeSet::StructArray, TEXT("Specify a child property or FText style format of child properties to use as the summary.") },
+		FDefaultKey{ TEXT("UIMax"), EMDMetaDataEditorKeyType::Integer, ETypeSet::Integer, TEXT("Specifies the highest that the value slider should represent."), TEXT("Value Range") },
+		FDefaultKey{ TEXT("UIMax"), EMDMetaDataEditorKeyType::Float, ETypeSet::Float, TEXT("Specifies the highest that the value slider should represent."), TEXT("Value Range") },
+		FDefaultKey{ TEXT("UIMin"), EMDMetaDataEditorKeyType::Integer, ETypeSet::Integer, TEXT("Specifies the lowest that the value slider should represent."), TEXT("Value Range") }.SetMaxValueMetaData(TEXT("UIMax")),
+		FDefaultKey{ TEXT("UIMin"), EMDMetaDataEditorKeyType::Float, ETypeSet::Float, TEXT("Specifies the lowest that the value slider should represent."), TEXT("Value Range") }.SetMaxValueMetaData(TEXT("UIMax")),
+		FDefaultKey{ TEXT("Untracked"), EMDMetaDataEditorKeyType::Flag, ETypeSet::SoftObject, TEXT("Specify that the soft reference should not be tracked and therefore not automatically cooked or checked during delete or redirector fixup.") },
+		FDefaultKey{ TEXT("ValidEnumValues"), EMDMetaDataEditorKeyType::EnumValue, ETypeSet::Enum, TEXT("Restricts selection to a subset of the enum's values.") },
+		FDefaultKey{ TEXT("WorldContext"), EMDMetaDataEditorKeyType::Param, ETypeSet::None, TEXT("Specify which function parameter is automatically set to the calling object's world context.") }.SetUsage(EMDMetaDataKeyUsage::Functions)
+	};
+
+	// Case insensitive to match FName::Compare for plain ASCII key names
+	constexpr int32 CompareKeyNames(const TCHAR* A, const TCHAR* B)
+	{
+		for (;; ++A, ++B)
+		{
+			const TCHAR LowerA = (*A >= 'A' && *A <= 'Z') ? static_cast<TCHAR>(*A + ('a' - 'A')) : *A;
+			const TCHAR LowerB = (*B >= 'A' && *B <= 'Z') ? static_cast<TCHAR>(*B + ('a' - 'A')) : *B;
+			if (LowerA != LowerB)
+			{
+				return (LowerA < LowerB) ? -1 : 1;
+			}
+
+			if (LowerA == 0)
+			{
+				return 0;
+			}
+		}
+	}
+
+	template<int32 NumKeys>
+	constexpr bool AreKeysSorted(const FDefaultKey (&Keys)[NumKeys])
+	{
+		for (int32 i = 1; i < NumKeys; ++i)
+		{
+			if (CompareKeyNames(Keys[i - 1].Key, Keys[i].Key) > 0)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	static_assert(AreKeysSorted(DefaultKeys), "MDMetaDataEditor default keys must be sorted alphabetically");
+
+	struct FDefaultPresetValue
+	{
+		const TCHAR* Key = nullptr;
+		const TCHAR* Value = nullptr;
+	};
+
+	struct FDefaultPreset
+	{
+		const TCHAR* PresetName = nullptr;
+		const TCHAR* Description = nullptr;
+		const FDefaultPresetValue* Values = nullptr;
+		int32 NumValues = 0;
+	};
+
+	constexpr FDefaultPresetValue NormalizedValues[] = {
+		{ TEXT("ClampMin"), TEXT("0") },
+		{ TEXT("UIMin"), TEXT("0") },
+		{ TEXT("ClampMax"), TEXT("1") },
+		{ TEXT("UIMax"), TEXT("1") }
+	};
+
+	constexpr FDefaultPreset DefaultPresets[] = {
+		{ TEXT("Normalized"), TEXT("Limits a number to the 0 to 1 range"), NormalizedValues, UE_ARRAY_COUNT(NormalizedValues) }
+	};
+
+	TArray<TSet<FMDMetaDataEditorPropertyType>> MakeTypeSets()
+	{
+		TArray<TSet<FMDMetaDataEditorPropertyType>> TypeSets;
+		TypeSets.SetNum(static_cast<int32>(ETypeSet::Count));
+
+		auto TypeSet = [&TypeSets](ETypeSet Id) -> TSet<FMDMetaDataEditorPropertyType>&
+		{
+			return TypeSets[static_cast<int32>(Id)];
+		};
+
+		TypeSet(ETypeSet::Wildcard) = { { UEdGraphSchema_K2::PC_Wildcard } };
+		TypeSet(ETypeSet::Bool) = { { UEdGraphSchema_K2::PC_Boolean } };
+		TypeSet(ETypeSet::Integer) = {
+			{ UEdGraphSchema_K2::PC_Int },
+			{ UEdGraphSchema_K2::PC_Int64 },
+		};
+		TypeSet(ETypeSet::Float) = {
+			{ UEdGraphSchema_K2::PC_Real, UEdGraphSchema_K2::PC_Float },
+			{ UEdGraphSchema_K2::PC_Real, UEdGraphSchema_K2::PC_Double },
+		};
+		TypeSet(ETypeSet::Numeric) = TypeSet(ETypeSet::Integer);
+		TypeSet(ETypeSet::Numeric).Append(TypeSet(ETypeSet::Float));
+		TypeSet(ETypeSet::NonLocString) = {
+			{ UEdGraphSchema_K2::PC_String },
+			{ UEdGraphSchema_K2::PC_Name }
+		};
+		TypeSet(ETypeSet::AnyArray) = { FMDMetaDataEditorPropertyType{ UEdGraphSchema_K2::PC_Wildcard }.SetContainerType(EMDMetaDataPropertyContainerType::Array) };
+		TypeSet(ETypeSet::AnyMap) = { FMDMetaDataEditorPropertyType{ UEdGraphSchema_K2::PC_Wildcard }.SetValueType({ UEdGraphSchema_K2::PC_Wildcard }).SetContainerType(EMDMetaDataPropertyContainerType::Map) };
+		TypeSet(ETypeSet::StructArray) = { FMDMetaDataEditorPropertyType{ UEdGraphSchema_K2::PC_Struct }.SetContainerType(EMDMetaDataPropertyContainerType::Array) };
+		TypeSet(ETypeSet::AnyStruct) = { { UEdGraphSchema_K2::PC_Struct } };
+		TypeSet(ETypeSet::Enum) = {
+			{ UEdGraphSchema_K2::PC_Enum, NAME_None, UEnum::StaticClass() },
+			{ UEdGraphSchema_K2::PC_Byte, NAME_None, UEnum::StaticClass() }
+		};
+		TypeSet(ETypeSet::GameplayTag) = {
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, FGameplayTag::StaticStruct() },
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, FGameplayTagContainer::StaticStruct() }
+		};
+		TypeSet(ETypeSet::PrimaryAssetId) = { { UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FPrimaryAssetId>::Get() } };
+		TypeSet(ETypeSet::DataTable) = {
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, FDataTableRowHandle::StaticStruct() },
+			{ UEdGraphSchema_K2::PC_Object, NAME_None, UDataTable::StaticClass() },
+			{ UEdGraphSchema_K2::PC_SoftObject, NAME_None, UDataTable::StaticClass() }
+		};
+		TypeSet(ETypeSet::Color) = {
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FLinearColor>::Get() },
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FColor>::Get() }
+		};
+		TypeSet(ETypeSet::SoftObject) = {
+			{ UEdGraphSchema_K2::PC_SoftObject, NAME_None, UObject::StaticClass() },
+			{ UEdGraphSchema_K2::PC_SoftClass, NAME_None, UObject::StaticClass() },
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FSoftObjectPath>::Get() },
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FSoftClassPath>::Get() }
+		};
+		TypeSet(ETypeSet::Class) = {
+			{ UEdGraphSchema_K2::PC_Class, NAME_None, UObject::StaticClass() },
+			{ UEdGraphSchema_K2::PC_SoftClass, NAME_None, UObject::StaticClass() },
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FSoftClassPath>::Get() }
+		};
+		TypeSet(ETypeSet::Widget) = { { UEdGraphSchema_K2::PC_Object, NAME_None, UWidget::StaticClass() } };
+		TypeSet(ETypeSet::WidgetAnimation) = { { UEdGraphSchema_K2::PC_Object, NAME_None, UWidgetAnimation::StaticClass() } };
+		// Any UObject type and PrimaryAssetID
+		TypeSet(ETypeSet::Asset) = {
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FPrimaryAssetId>::Get() },
+			{ UEdGraphSchema_K2::PC_Object, NAME_None, UObject::StaticClass() },
+			{ UEdGraphSchema_K2::PC_SoftObject, NAME_None, UObject::StaticClass() },
+			{ UEdGraphSchema_K2::PC_Class, NAME_None, UObject::StaticClass() },
+			{ UEdGraphSchema_K2::PC_SoftClass, NAME_None, UObject::StaticClass() },
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FSoftObjectPath>::Get() },
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FSoftClassPath>::Get() }
+		};
+		TypeSet(ETypeSet::InstancedStruct) = { { UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FInstancedStruct>::Get() } };
+		TypeSet(ETypeSet::SoftPath) = {
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FSoftObjectPath>::Get() },
+			{ UEdGraphSchema_K2::PC_Struct, NAME_None, TBaseStructure<FSoftClassPath>::Get() }
+		};
+
+		return TypeSets;
+	}
+
+	FText GetDisplayNameText(EDisplayName DisplayName)
+	{
+		switch (DisplayName)
+		{
+		case EDisplayName::TagFilter:
+			return LOCTEXT("Categories_DisplayName","Tag Filter");
+		case EDisplayName::AllowedStructClasses:
+			return LOCTEXT("InstancedStruct_AllowedClasses_DisplayName","Allowed Struct Classes");
+		case EDisplayName::DisallowedStructClasses:
+			return LOCTEXT("InstancedStruct_DisallowedClasses_DisplayName","Disallowed Struct Classes");
+		case EDisplayName::StructTypeConst:
+			return LOCTEXT("InstancedStruct_StructTypeConst_DisplayName","Struct Type is Constant");
+		default:
+			return FText::GetEmpty();
+		}
+	}
+}
+
+void FMDMetaDataEditorDefaultKeys::Populate(TArray<FMDMetaDataKey>& OutKeys)
+{
+	using namespace MDMDEDK_Private;
+
+	const TArray<TSet<FMDMetaDataEditorPropertyType>> TypeSets = MakeTypeSets();
+
+	OutKeys.Reserve(OutKeys.Num() + UE_ARRAY_COUNT(DefaultKeys));
+	for (const FDefaultKey& DefaultKey : DefaultKeys)
+	{
+		FMDMetaDataKey Key{ DefaultKey.Key, DefaultKey.KeyType, DefaultKey.Description };
+		if (DefaultKey.Category != nullptr)
+		{
+			Key.Category = DefaultKey.Category;
+		}
+
+		Key.SupportedPropertyTypes = TypeSets[static_cast<int32>(DefaultKey.TypeSet)];
+
+		if (DefaultKey.BlueprintType == EBlueprintType::WidgetBlueprint)
+		{
+			Key.SetSupportedBlueprint(UWidgetBlueprint::StaticClass());
+		}
+
+		Key.bCanBeUsedOnVariables = EnumHasAnyFlags(DefaultKey.Usage, EMDMetaDataKeyUsage::Variables);
+		Key.bCanBeUsedOnLocalVariables = EnumHasAnyFlags(DefaultKey.Usage, EMDMetaDataKeyUsage::LocalVariables);
+		Key.bCanBeUsedOnFunctionParameters = EnumHasAnyFlags(DefaultKey.Usage, EMDMetaDataKeyUsage::FunctionParameters);
+		Key.bCanBeUsedByFunctions = EnumHasAnyFlags(DefaultKey.Usage, EMDMetaDataKeyUsage::Functions);
+		Key.bCanBeUsedByStructs = EnumHasAnyFlags(DefaultKey.Usage, EMDMetaDataKeyUsage::Structs);
+
+		if (DefaultKey.RequiredMetaData != nullptr)
+		{
+			Key.SetRequiredMetaData(FName(DefaultKey.RequiredMetaData));
+		}
+
+		if (DefaultKey.IncompatibleMetaData != nullptr)
+		{
+			Key.SetIncompatibleMetaData(FName(DefaultKey.IncompatibleMetaData));
+		}
+
+		Key.MinInt = DefaultKey.MinInt;
+		Key.MinFloat = DefaultKey.MinFloat;
+		Key.ValueReference = DefaultKey.ValueReference;
+		Key.bAllowMultipleValues = DefaultKey.bAllowMultipleValues;
+
+		if (DefaultKey.BaseType != nullptr)
+		{
+			if (DefaultKey.KeyType == EMDMetaDataEditorKeyType::Struct)
+			{
+				Key.SetBaseStruct(TSoftObjectPtr<UScriptStruct>(FSoftObjectPath(DefaultKey.BaseType)));
+			}
+			else
+			{
+				Key.SetBaseClass(TSoftClassPtr<UObject>(FSoftObjectPath(DefaultKey.BaseType)));
+			}
+		}
+
+		if (DefaultKey.MaxValueMetaData != nullptr)
+		{
+			Key.SetMaxValueMetaData(FName(DefaultKey.MaxValueMetaData));
+		}
+
+		if (DefaultKey.DisplayName != EDisplayName::None)
+		{
+			Key.SetDisplayNameOverride(GetDisplayNameText(DefaultKey.DisplayName));
+		}
+
+		OutKeys.Emplace(MoveTemp(Key));
+	}
+}
+
+void FMDMetaDataEditorDefaultKeys::PopulatePresets(TArray<FMDMetaDataPreset>& OutPresets)
+{
+	using namespace MDMDEDK_Private;
+
+	OutPresets.Reserve(OutPresets.Num() + UE_ARRAY_COUNT(DefaultPresets));
+	for (const FDefaultPreset& DefaultPreset : DefaultPresets)
+	{
+		FMDMetaDataPreset& Preset = OutPresets.AddDefaulted_GetRef();
+		Preset.PresetName = DefaultPreset.PresetName;
+		Preset.Description = DefaultPreset.Description;
+		for (int32 i = 0; i < DefaultPreset.NumValues; ++i)
+		{
+			FMDMetaDataPresetValue& PresetValue = Preset.Values.AddDefaulted_GetRef();
+			PresetValue.Key = DefaultPreset.Values[i].Key;
+			PresetValue.Value = DefaultPreset.Values[i].Value;
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,18 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+
+struct FMDMetaDataKey;
+struct FMDMetaDataPreset;
+
+/**
+ * The built-in meta data keys and presets that the config starts with, described by static tables. The keys are sorted at compile time.
+ */
+class FMDMetaDataEditorDefaultKeys
+{
+public:
+	static void Populate(TArray<FMDMetaDataKey>& OutKeys);
+	static void PopulatePresets(TArray<FMDMetaDataPreset>& OutPresets);
+};
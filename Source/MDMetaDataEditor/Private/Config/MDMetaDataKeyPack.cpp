@@ -0,0 +1,119 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataKeyPack.h"
+
+#include "AssetRegistry/AssetData.h"
+#include "Config/MDMetaDataEditorConfig.h"
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+#include "UObject/AssetRegistryTagsContext.h"
+#endif
+
+const FName UMDMetaDataKeyPack::TargetBlueprintsTagName = TEXT("MDTargetBlueprints");
+
+void UMDMetaDataKeyPack::PostLoad()
+{
+	Super::PostLoad();
+
+	// Fix Supported Property Types which may be coming from old packs.
+	for (FMDMetaDataKey& Key : MetaDataKeys)
+	{
+		for (FMDMetaDataEditorPropertyType& SupportedPropertyType : Key.SupportedPropertyTypes)
+		{
+			SupportedPropertyType.FixUp();
+		}
+	}
+}
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+void UMDMetaDataKeyPack::GetAssetRegistryTags(FAssetRegistryTagsContext Context) const
+{
+	Super::GetAssetRegistryTags(Context);
+
+	Context.AddTag(FAssetRegistryTag(TargetBlueprintsTagName, GetTargetBlueprintsTagValue(), FAssetRegistryTag::TT_Hidden));
+}
+#else
+void UMDMetaDataKeyPack::GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const
+{
+	Super::GetAssetRegistryTags(OutTags);
+
+	OutTags.Emplace(TargetBlueprintsTagName, GetTargetBlueprintsTagValue(), FAssetRegistryTag::TT_Hidden);
+}
+#endif
+
+#if WITH_EDITOR
+void UMDMetaDataKeyPack::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	GetMutableDefault<UMDMetaDataEditorConfig>()->OnKeyPackChanged(this);
+}
+#endif //WITH_EDITOR
+
+bool UMDMetaDataKeyPack::DoesAssetTargetBlueprint(const FAssetData& AssetData, const UBlueprint* Blueprint)
+{
+	if (!IsValid(Blueprint))
+	{
+		return false;
+	}
+
+	FString TagValue;
+	if (!AssetData.GetTagValue(TargetBlueprintsTagName, TagValue))
+	{
+		return false;
+	}
+
+	TArray<FString> ClassPaths;
+	TagValue.ParseIntoArray(ClassPaths, TEXT(","));
+	for (const FString& ClassPath : ClassPaths)
+	{
+		// Blueprint types are native classes, if it's not loaded then the Blueprint can't be one
+		const UClass* TargetClass = FSoftClassPath(ClassPath).ResolveClass();
+		if (TargetClass != nullptr && Blueprint->GetClass()->IsChildOf(TargetClass))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UMDMetaDataKeyPack::GetTargetedMetaDataKeys(TArray<FMDMetaDataKey>& OutKeys) const
+{
+	OutKeys.Reserve(OutKeys.Num() + MetaDataKeys.Num());
+	for (const FMDMetaDataKey& Key : MetaDataKeys)
+	{
+		FMDMetaDataKey& TargetedKey = OutKeys.Add_GetRef(Key);
+		const bool bSupportsAnyBlueprint = TargetedKey.SupportedBlueprints.Num() == 1 && TargetedKey.SupportedBlueprints.Contains(UBlueprint::StaticClass());
+		if (bSupportsAnyBlueprint && !TargetBlueprints.IsEmpty())
+		{
+			TargetedKey.SetSupportedBlueprints(TargetBlueprints);
+		}
+	}
+}
+
+TArray<FName> UMDMetaDataKeyPack::GetMetaDataKeyNames() const
+{
+	// Keys in a pack can depend on keys from the config
+	TArray<FName> Result = GetDefault<UMDMetaDataEditorConfig>()->GetMetaDataKeyNames();
+
+	for (const FMDMetaDataKey& Key : MetaDataKeys)
+	{
+		Result.AddUnique(Key.Key);
+	}
+
+	return Result;
+}
+
+FString UMDMetaDataKeyPack::GetTargetBlueprintsTagValue() const
+{
+	TArray<FString> ClassPaths;
+	for (const TSoftClassPtr<UBlueprint>& TargetBlueprint : TargetBlueprints)
+	{
+		if (!TargetBlueprint.IsNull())
+		{
+			ClassPaths.Add(TargetBlueprint.ToString());
+		}
+	}
+
+	return FString::Join(ClassPaths, TEXT(","));
+}
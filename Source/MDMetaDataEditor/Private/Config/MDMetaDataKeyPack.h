@@ -0,0 +1,53 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Engine/DataAsset.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "Types/MDMetaDataKey.h"
+
+#include "MDMetaDataKeyPack.generated.h"
+
+/**
+ * A set of meta data keys that only apply to specific Blueprint types.
+ * Packs aren't loaded at startup, they're found through the asset registry and loaded the first time a matching Blueprint editor is opened.
+ */
+UCLASS()
+class UMDMetaDataKeyPack : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	static const FName TargetBlueprintsTagName;
+
+	virtual void PostLoad() override;
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+	virtual void GetAssetRegistryTags(FAssetRegistryTagsContext Context) const override;
+#else
+	virtual void GetAssetRegistryTags(TArray<FAssetRegistryTag>& OutTags) const override;
+#endif
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(struct FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif //WITH_EDITOR
+
+	// Parses the target Blueprint classes out of the pack's asset registry tag, without loading the pack
+	static bool DoesAssetTargetBlueprint(const FAssetData& AssetData, const UBlueprint* Blueprint);
+
+	// Returns the pack's keys, with keys that support any Blueprint narrowed down to the pack's target Blueprints
+	void GetTargetedMetaDataKeys(TArray<FMDMetaDataKey>& OutKeys) const;
+
+	// The Blueprint types this pack's keys are used for, the pack is loaded when an editor for one of these (or a child type) is opened
+	UPROPERTY(EditAnywhere, Category = "Meta Data Keys")
+	TSet<TSoftClassPtr<UBlueprint>> TargetBlueprints;
+
+	UPROPERTY(EditAnywhere, Category = "Meta Data Keys", meta = (TitleProperty = "{Key} ({KeyType})"))
+	TArray<FMDMetaDataKey> MetaDataKeys;
+
+private:
+	UFUNCTION()
+	TArray<FName> GetMetaDataKeyNames() const;
+
+	FString GetTargetBlueprintsTagValue() const;
+};
@@ -29,10 +29,24 @@ FMDMetaDataEditorCustomizationBase::FMDMetaDataEditorCustomizationBase(const TWe
 	, BlueprintPtr(MoveTemp(BlueprintPtr))
 {}
 
+FMDMetaDataEditorCustomizationBase::~FMDMetaDataEditorCustomizationBase()
+{
+	if (MetaDataKeysChangedHandle.IsValid() && UObjectInitialized())
+	{
+		GetMutableDefault<UMDMetaDataEditorConfig>()->OnMetaDataKeysChanged.Remove(MetaDataKeysChangedHandle);
+	}
+}
+
 void FMDMetaDataEditorCustomizationBase::CustomizeDetails(IDetailLayoutBuilder& DetailLayout)
 {
 	DetailBuilderPtr = &DetailLayout;
 
+	if (!MetaDataKeysChangedHandle.IsValid())
+	{
+		// Rebuild the rows when the available keys are edited in the project settings
+		MetaDataKeysChangedHandle = GetMutableDefault<UMDMetaDataEditorConfig>()->OnMetaDataKeysChanged.AddSP(this, &FMDMetaDataEditorCustomizationBase::RefreshDetails);
+	}
+
 	TArray<TWeakObjectPtr<UObject>> ObjectsBeingCustomized;
 	DetailLayout.GetObjectsBeingCustomized(ObjectsBeingCustomized);
 	if (ObjectsBeingCustomized.Num() != 1)
@@ -32,6 +32,7 @@ class FMDMetaDataEditorCustomizationBase : public IDetailCustomization
 {
 public:
 	FMDMetaDataEditorCustomizationBase(const TWeakPtr<IBlueprintEditor>& BlueprintEditor, TWeakObjectPtr<UBlueprint>&& BlueprintPtr);
+	virtual ~FMDMetaDataEditorCustomizationBase() override;
 
 	virtual void CustomizeDetails(IDetailLayoutBuilder& DetailLayout) override;
 	// This version doesn't actually get called (see FBlueprintGraphActionDetails::CustomizeDetails and https://github.com/EpicGames/UnrealEngine/pull/11137)
@@ -48,4 +49,6 @@ private:
 	TWeakObjectPtr<UBlueprint> BlueprintPtr;
 
 	IDetailLayoutBuilder* DetailBuilderPtr = nullptr;
+
+	FDelegateHandle MetaDataKeysChangedHandle;
 };
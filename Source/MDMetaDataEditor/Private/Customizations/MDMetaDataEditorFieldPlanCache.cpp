@@ -0,0 +1,234 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEditorFieldPlanCache.h"
+
+#include "Async/Async.h"
+#include "Config/MDMetaDataEditorConfig.h"
+#include "Customizations/MDMetaDataEditorFieldView.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Tasks/Task.h"
+
+FMDMetaDataEditorFieldPlanCache::~FMDMetaDataEditorFieldPlanCache()
+{
+	for (const TPair<TObjectKey<UBlueprint>, FBlueprintPlans>& Pair : BlueprintPlans)
+	{
+		if (UBlueprint* Blueprint = Pair.Value.Blueprint.Get())
+		{
+			Blueprint->OnCompiled().RemoveAll(this);
+		}
+	}
+}
+
+void FMDMetaDataEditorFieldPlanCache::RequestPlans(UBlueprint* Blueprint)
+{
+	if (!IsValid(Blueprint) || Blueprint->SkeletonGeneratedClass == nullptr)
+	{
+		return;
+	}
+
+	// Drop anything planned for Blueprints that have since been unloaded
+	for (auto It = BlueprintPlans.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.Blueprint.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	FBlueprintPlans& Plans = BlueprintPlans.FindOrAdd(Blueprint);
+	if (!Plans.Blueprint.IsValid())
+	{
+		Plans.Blueprint = Blueprint;
+		Blueprint->OnCompiled().AddSP(this, &FMDMetaDataEditorFieldPlanCache::OnBlueprintCompiled);
+	}
+
+	const uint32 RequestId = ++LastRequestId;
+	Plans.RequestId = RequestId;
+
+	// Gather the fields and resolve their types on the game thread, only plain data is handed to the task
+	TSharedRef<const FMDMetaDataEditorConfigSnapshot> Snapshot = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot();
+	const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+	const UClass* SkeletonClass = Blueprint->SkeletonGeneratedClass;
+	FMDMetaDataResolvedClass BlueprintClass(Blueprint->GetClass());
+	TArray<FFieldToPlan> Fields;
+
+	auto AddField = [K2Schema, &Fields](EMDMetaDataKeyUsage Usage, FName ScopeName, const FProperty* Property)
+	{
+		FFieldKey Key;
+		Key.Usage = Usage;
+		Key.ScopeName = ScopeName;
+		Key.FieldName = Property->GetFName();
+
+		FEdGraphPinType PinType;
+		if (K2Schema->ConvertPropertyToPinType(Property, PinType))
+		{
+			Fields.Emplace(Key, PinType);
+		}
+	};
+
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		if (const FProperty* Property = FindFProperty<FProperty>(SkeletonClass, Variable.VarName))
+		{
+			AddField(EMDMetaDataKeyUsage::Variables, NAME_None, Property);
+		}
+	}
+
+	for (TFieldIterator<UFunction> FuncIt(SkeletonClass, EFieldIteratorFlags::ExcludeSuper); FuncIt; ++FuncIt)
+	{
+		for (TFieldIterator<FProperty> PropIt(*FuncIt); PropIt; ++PropIt)
+		{
+			const EMDMetaDataKeyUsage Usage = PropIt->HasAnyPropertyFlags(CPF_Parm) ? EMDMetaDataKeyUsage::FunctionParameters : EMDMetaDataKeyUsage::LocalVariables;
+			AddField(Usage, FuncIt->GetFName(), *PropIt);
+		}
+	}
+
+	const TObjectKey<UBlueprint> BlueprintKey = Blueprint;
+	TWeakPtr<FMDMetaDataEditorFieldPlanCache> WeakCache = SharedThis(this);
+
+	UE::Tasks::Launch(UE_SOURCE_LOCATION, [WeakCache, BlueprintKey, RequestId, Snapshot, BlueprintClass = MoveTemp(BlueprintClass), Fields = MoveTemp(Fields)]()
+	{
+		TMap<FFieldKey, FMDMetaDataEditorFieldPlan> Plans = PlanFields(Snapshot, BlueprintClass, Fields);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakCache, BlueprintKey, RequestId, Plans = MoveTemp(Plans)]() mutable
+		{
+			if (const TSharedPtr<FMDMetaDataEditorFieldPlanCache> Cache = WeakCache.Pin())
+			{
+				Cache->PublishPlans(BlueprintKey, RequestId, MoveTemp(Plans));
+			}
+		});
+	});
+}
+
+void FMDMetaDataEditorFieldPlanCache::RequestAllPlans()
+{
+	TArray<UBlueprint*> Blueprints;
+	for (const TPair<TObjectKey<UBlueprint>, FBlueprintPlans>& Pair : BlueprintPlans)
+	{
+		if (UBlueprint* Blueprint = Pair.Value.Blueprint.Get())
+		{
+			Blueprints.Add(Blueprint);
+		}
+	}
+
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		RequestPlans(Blueprint);
+	}
+}
+
+const FMDMetaDataEditorFieldPlan* FMDMetaDataEditorFieldPlanCache::FindPlan(const UBlueprint* Blueprint, EMDMetaDataEditorFieldType FieldType, const FProperty* Property) const
+{
+	FFieldKey FieldKey;
+	if (Property == nullptr || !MakeFieldKey(FieldType, Property, FieldKey))
+	{
+		return nullptr;
+	}
+
+	const FBlueprintPlans* Plans = BlueprintPlans.Find(Blueprint);
+	const FMDMetaDataEditorFieldPlan* Plan = (Plans != nullptr) ? Plans->Plans.Find(FieldKey) : nullptr;
+	if (Plan == nullptr || Plan->Snapshot != GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot())
+	{
+		return nullptr;
+	}
+
+	FEdGraphPinType PinType;
+	if (!GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(Property, PinType) || !IsSamePinType(PinType, Plan->PinType))
+	{
+		return nullptr;
+	}
+
+	return Plan;
+}
+
+void FMDMetaDataEditorFieldPlanCache::MakeGroupNames(FName FieldName, const TArray<FString>& CategoryPath, TArray<FName>& OutGroupNames)
+{
+	OutGroupNames.Reset(CategoryPath.Num());
+
+	FName GroupName = FieldName;
+	for (const FString& Subgroup : CategoryPath)
+	{
+		GroupName = (GroupName.IsNone()) ? *Subgroup : *FString::Printf(TEXT("%s|%s"), *GroupName.ToString(), *Subgroup);
+		OutGroupNames.Add(GroupName);
+	}
+}
+
+bool FMDMetaDataEditorFieldPlanCache::MakeFieldKey(EMDMetaDataEditorFieldType FieldType, const FProperty* Property, FFieldKey& OutKey)
+{
+	switch (FieldType)
+	{
+	case EMDMetaDataEditorFieldType::Variable:
+		OutKey.Usage = EMDMetaDataKeyUsage::Variables;
+		break;
+	case EMDMetaDataEditorFieldType::LocalVariable:
+		OutKey.Usage = EMDMetaDataKeyUsage::LocalVariables;
+		break;
+	case EMDMetaDataEditorFieldType::FunctionParamInput:
+	case EMDMetaDataEditorFieldType::FunctionParamOutput:
+		OutKey.Usage = EMDMetaDataKeyUsage::FunctionParameters;
+		break;
+	default:
+		return false;
+	}
+
+	const UFunction* Function = Property->GetOwner<UFunction>();
+	OutKey.ScopeName = (Function != nullptr) ? Function->GetFName() : NAME_None;
+	OutKey.FieldName = Property->GetFName();
+	return true;
+}
+
+bool FMDMetaDataEditorFieldPlanCache::IsSamePinType(const FEdGraphPinType& A, const FEdGraphPinType& B)
+{
+	// Only the parts of the type that key matching looks at
+	return A.PinCategory == B.PinCategory
+		&& A.PinSubCategory == B.PinSubCategory
+		&& A.PinSubCategoryObject == B.PinSubCategoryObject
+		&& A.PinSubCategoryMemberReference == B.PinSubCategoryMemberReference
+		&& A.ContainerType == B.ContainerType
+		&& A.PinValueType.TerminalCategory == B.PinValueType.TerminalCategory
+		&& A.PinValueType.TerminalSubCategory == B.PinValueType.TerminalSubCategory
+		&& A.PinValueType.TerminalSubCategoryObject == B.PinValueType.TerminalSubCategoryObject;
+}
+
+TMap<FMDMetaDataEditorFieldPlanCache::FFieldKey, FMDMetaDataEditorFieldPlan> FMDMetaDataEditorFieldPlanCache::PlanFields(const TSharedRef<const FMDMetaDataEditorConfigSnapshot>& Snapshot, const FMDMetaDataResolvedClass& BlueprintClass, const TArray<FFieldToPlan>& Fields)
+{
+	const TArray<FMDMetaDataEditorCompiledKey>& Keys = Snapshot->GetKeys();
+
+	TMap<FFieldKey, FMDMetaDataEditorFieldPlan> Plans;
+	Plans.Reserve(Fields.Num());
+
+	for (const FFieldToPlan& Field : Fields)
+	{
+		FMDMetaDataEditorFieldPlan& Plan = Plans.Add(Field.Key);
+		Plan.Snapshot = Snapshot;
+		Plan.PinType = Field.PinType;
+
+		Snapshot->ForEachKeyIndex(Field.Key.Usage, &BlueprintClass, &Field.ResolvedPinType, [&Plan, &Field, &Keys](int32 KeyIndex)
+		{
+			FMDMetaDataEditorPlannedKey& PlannedKey = Plan.Keys.AddDefaulted_GetRef();
+			PlannedKey.KeyIndex = KeyIndex;
+			MakeGroupNames(Field.Key.FieldName, Keys[KeyIndex].CategoryPath, PlannedKey.GroupNames);
+		});
+	}
+
+	return Plans;
+}
+
+void FMDMetaDataEditorFieldPlanCache::OnBlueprintCompiled(UBlueprint* Blueprint)
+{
+	// Fields may have been added, removed or retyped
+	RequestPlans(Blueprint);
+}
+
+void FMDMetaDataEditorFieldPlanCache::PublishPlans(const TObjectKey<UBlueprint>& BlueprintKey, uint32 RequestId, TMap<FFieldKey, FMDMetaDataEditorFieldPlan>&& Plans)
+{
+	FBlueprintPlans* BlueprintPlan = BlueprintPlans.Find(BlueprintKey);
+	if (BlueprintPlan == nullptr || BlueprintPlan->RequestId != RequestId)
+	{
+		// A newer request for this Blueprint is still in flight
+		return;
+	}
+
+	BlueprintPlan->Plans = MoveTemp(Plans);
+}
@@ -0,0 +1,100 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+enum class EMDMetaDataEditorFieldType : uint8;
+
+struct FMDMetaDataEditorPlannedKey
+{
+	// Index into the snapshot's keys
+	int32 KeyIndex = INDEX_NONE;
+
+	// The detail group for each level of the key's category, already prefixed with the field name
+	TArray<FName> GroupNames;
+};
+
+// The meta data keys that apply to a single variable, local variable or param, worked out ahead of time
+struct FMDMetaDataEditorFieldPlan
+{
+	TSharedPtr<const FMDMetaDataEditorConfigSnapshot> Snapshot;
+
+	// The type of the field when it was planned, if it no longer matches then the plan is stale
+	FEdGraphPinType PinType;
+
+	TArray<FMDMetaDataEditorPlannedKey> Keys;
+};
+
+/**
+ * Plans the meta data rows of a Blueprint's fields on a background task when its editor is opened,
+ * so selecting a field only has to create widgets
+ */
+class FMDMetaDataEditorFieldPlanCache : public TSharedFromThis<FMDMetaDataEditorFieldPlanCache>
+{
+public:
+	~FMDMetaDataEditorFieldPlanCache();
+
+	void RequestPlans(UBlueprint* Blueprint);
+	void RequestAllPlans();
+
+	// Returns null if the field hasn't been planned yet or its plan is stale (its type or the config has changed)
+	const FMDMetaDataEditorFieldPlan* FindPlan(const UBlueprint* Blueprint, EMDMetaDataEditorFieldType FieldType, const FProperty* Property) const;
+
+	static void MakeGroupNames(FName FieldName, const TArray<FString>& CategoryPath, TArray<FName>& OutGroupNames);
+
+private:
+	struct FFieldKey
+	{
+		EMDMetaDataKeyUsage Usage = EMDMetaDataKeyUsage::None;
+		FName ScopeName = NAME_None;
+		FName FieldName = NAME_None;
+
+		bool operator==(const FFieldKey& Other) const
+		{
+			return Usage == Other.Usage && ScopeName == Other.ScopeName && FieldName == Other.FieldName;
+		}
+
+		friend uint32 GetTypeHash(const FFieldKey& Key)
+		{
+			return HashCombine(HashCombine(GetTypeHash(Key.Usage), GetTypeHash(Key.ScopeName)), GetTypeHash(Key.FieldName));
+		}
+	};
+
+	struct FFieldToPlan
+	{
+		FFieldToPlan(const FFieldKey& InKey, const FEdGraphPinType& InPinType)
+			: Key(InKey)
+			, PinType(InPinType)
+			, ResolvedPinType(InPinType)
+		{
+		}
+
+		FFieldKey Key;
+		FEdGraphPinType PinType;
+
+		// Resolved on the game thread so the task can match keys against it
+		FMDMetaDataResolvedPinType ResolvedPinType;
+	};
+
+	struct FBlueprintPlans
+	{
+		uint32 RequestId = 0;
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		TMap<FFieldKey, FMDMetaDataEditorFieldPlan> Plans;
+	};
+
+	static bool MakeFieldKey(EMDMetaDataEditorFieldType FieldType, const FProperty* Property, FFieldKey& OutKey);
+	static bool IsSamePinType(const FEdGraphPinType& A, const FEdGraphPinType& B);
+	static TMap<FFieldKey, FMDMetaDataEditorFieldPlan> PlanFields(const TSharedRef<const FMDMetaDataEditorConfigSnapshot>& Snapshot, const FMDMetaDataResolvedClass& BlueprintClass, const TArray<FFieldToPlan>& Fields);
+
+	void OnBlueprintCompiled(UBlueprint* Blueprint);
+	void PublishPlans(const TObjectKey<UBlueprint>& BlueprintKey, uint32 RequestId, TMap<FFieldKey, FMDMetaDataEditorFieldPlan>&& Plans);
+
+	TMap<TObjectKey<UBlueprint>, FBlueprintPlans> BlueprintPlans;
+	uint32 LastRequestId = 0;
+};
@@ -2,31 +2,51 @@
 
 #include "MDMetaDataEditorFieldView.h"
 
+#include "Algo/AllOf.h"
 #include "BlueprintActionDatabase.h"
 #include "Config/MDMetaDataEditorConfig.h"
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
 #include "Config/MDMetaDataEditorUserConfig.h"
 #include "Customizations/MDMetaDataEditorCustomizationBase.h"
+#include "Customizations/MDMetaDataEditorFieldPlanCache.h"
 #include "DetailLayoutBuilder.h"
 #include "DetailWidgetRow.h"
 #include "Engine/UserDefinedStruct.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "IDetailGroup.h"
 #include "K2Node_CustomEvent.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_Tunnel.h"
 #include "Kismet2/BlueprintEditorUtils.h"
+#include "MDEditConditionCache.h"
+#include "MDMetaDataChangeBus.h"
+#include "MDMetaDataEditorLibrary.h"
+#include "MDMetaDataEditorModule.h"
+#include "Modules/ModuleManager.h"
+#include "References/MDMetaDataReferenceIndex.h"
 #include "ScopedTransaction.h"
 #include "SlateOptMacros.h"
 #include "Styling/AppStyle.h"
+#include "Types/MDMetaDataClipboard.h"
+#include "Types/MDMetaDataEditorPropertyType.h"
 #include "Types/MDMetaDataKey.h"
+#include "Types/MDMetaDataPreset.h"
 #include "UObject/MetaData.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SComboButton.h"
 #include "Widgets/Input/SEditableTextBox.h"
 #include "Widgets/Input/SNumericEntryBox.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/SMDMetaDataDeferredWidget.h"
+#include "Widgets/SMDMetaDataEnumValuePicker.h"
 #include "Widgets/SMDMetaDataGameplayTagPicker.h"
+#include "Widgets/SMDMetaDataParamPicker.h"
 #include "Widgets/SMDMetaDataStringComboBox.h"
+#include "Widgets/SMDMetaDataTypePicker.h"
+#include "Widgets/SMDRawMetaDataEditor.h"
 #include "Widgets/Text/STextBlock.h"
 
 #if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
@@ -35,6 +55,13 @@
 
 namespace MDMDEFV_Private
 {
+	const FName EditConditionKey = TEXT("EditCondition");
+
+	TOptional<FMDMetaDataValue> MakePooledValue(const TOptional<FString>& Value)
+	{
+		return Value.IsSet() ? TOptional<FMDMetaDataValue>(FMDMetaDataValue(Value.GetValue())) : TOptional<FMDMetaDataValue>();
+	}
+
 	template<typename T, bool bExact>
 	T* FindNode(UObject* Object)
 	{
@@ -193,6 +220,14 @@ FMDMetaDataEditorFieldView::FMDMetaDataEditorFieldView(UK2Node_CustomEvent* InCu
 {
 }
 
+FMDMetaDataEditorFieldView::~FMDMetaDataEditorFieldView()
+{
+	if (ChangeBusHandle.IsValid())
+	{
+		FMDMetaDataChangeBus::Get().OnMetaDataChanged.Remove(ChangeBusHandle);
+	}
+}
+
 const TMap<FName, FString>* FMDMetaDataEditorFieldView::GetMetadataMap() const
 {
 	if (const FProperty* Property = MetadataProperty.Get())
@@ -253,12 +288,20 @@ void FMDMetaDataEditorFieldView::GenerateMetadataEditor(IDetailLayoutBuilder& De
 
 	FMDMetadataBuilderRow BuilderRow = InitCategories(DetailLayout, GroupMap);
 
-	auto AddMetaDataKey = [this, &GroupMap, &BuilderRow](const FMDMetaDataKey& Key)
+	if (!AddPlannedMetadataValueEditors(BuilderRow, GroupMap))
 	{
-		AddMetadataValueEditor(Key, BuilderRow, GroupMap);
-	};
+		auto AddMetaDataKey = [this, &GroupMap, &BuilderRow](const FMDMetaDataKey& Key)
+		{
+			AddMetadataValueEditor(Key, BuilderRow, GroupMap);
+		};
+
+		AddMetadataValueEditor(AddMetaDataKey);
+	}
 
-	AddMetadataValueEditor(AddMetaDataKey);
+	if (!bIsReadOnly && !GetDefault<UMDMetaDataEditorConfig>()->GetMetaDataPresets().IsEmpty())
+	{
+		AddPresetEditor(BuilderRow);
+	}
 
 	const UMDMetaDataEditorUserConfig* UserConfig = GetDefault<UMDMetaDataEditorUserConfig>();
 	const TMap<FName, FString>* MetadataMap = GetMetadataMap();
@@ -304,6 +347,7 @@ TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetaDataEditorFieldView::InitC
 			}
 			IDetailGroup& Group = ParamGroup->AddGroup(MetadataProperty->GetFName(), MetadataProperty->GetDisplayNameText());
 			Result.SetSubtype<IDetailGroup*>(&Group);
+			bStartsCollapsed = true;
 		}
 		break;
 	}
@@ -318,6 +362,7 @@ TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetaDataEditorFieldView::InitC
 			}
 
 			Result.SetSubtype<IDetailGroup*>(Group);
+			bStartsCollapsed = true;
 		}
 		break;
 	}
@@ -346,7 +391,7 @@ TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetaDataEditorFieldView::InitC
 	return Result;
 }
 
-void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const TFunctionRef<void(const FMDMetaDataKey&)>& Func)
+void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const
 {
 	const UMDMetaDataEditorConfig* Config = GetDefault<UMDMetaDataEditorConfig>();
 	switch (FieldType) {
@@ -364,17 +409,50 @@ void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const TFunctionRef<void(
 		Config->ForEachStructPropertyMetaDataKey(MetadataProperty.Get(), Func);
 		break;
 	case EMDMetaDataEditorFieldType::Function:
-	case EMDMetaDataEditorFieldType::Tunnel:
 	case EMDMetaDataEditorFieldType::CustomEvent:
 		Config->ForEachFunctionMetaDataKey(BlueprintPtr.Get(), Func);
 		break;
+	case EMDMetaDataEditorFieldType::Tunnel:
+		// Macro params aren't tracked by the reference index, so renaming one would leave Param values dangling
+		Config->ForEachFunctionMetaDataKey(BlueprintPtr.Get(), [&Func](const FMDMetaDataKey& Key)
+		{
+			if (Key.KeyType != EMDMetaDataEditorKeyType::Param)
+			{
+				Func(Key);
+			}
+		});
+		break;
 	case EMDMetaDataEditorFieldType::Struct:
 		Config->ForEachStructMetaDataKey(Func);
 		break;
 	}
 }
 
-BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
+bool FMDMetaDataEditorFieldView::AddPlannedMetadataValueEditors(FMDMetadataBuilderRow BuilderRow, TMap<FName, IDetailGroup*>& GroupMap)
+{
+	const FMDMetaDataEditorModule* Module = FModuleManager::GetModulePtr<FMDMetaDataEditorModule>(TEXT("MDMetaDataEditor"));
+	const FMDMetaDataEditorFieldPlanCache* PlanCache = (Module != nullptr) ? Module->GetFieldPlanCache() : nullptr;
+	const FMDMetaDataEditorFieldPlan* Plan = (PlanCache != nullptr) ? PlanCache->FindPlan(BlueprintPtr.Get(), FieldType, MetadataProperty.Get()) : nullptr;
+	if (Plan == nullptr)
+	{
+		return false;
+	}
+
+	const TMap<FName, FString>* MetadataMap = GetMetadataMap();
+	const TBitArray<> PresentKeys = Plan->Snapshot->GetPresentKeys(MetadataMap);
+
+	const TArray<FMDMetaDataEditorCompiledKey>& Keys = Plan->Snapshot->GetKeys();
+	for (const FMDMetaDataEditorPlannedKey& PlannedKey : Plan->Keys)
+	{
+		if (Plan->Snapshot->AreKeyConstraintsMet(PlannedKey.KeyIndex, PresentKeys, MetadataMap))
+		{
+			const FMDMetaDataEditorCompiledKey& CompiledKey = Keys[PlannedKey.KeyIndex];
+			AddMetadataValueEditor(CompiledKey.Key, PlannedKey.GroupNames, CompiledKey.CategoryPath, BuilderRow, GroupMap);
+		}
+	}
+
+	return true;
+}
 
 void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const FMDMetaDataKey& Key, FMDMetadataBuilderRow BuilderRow, TMap<FName, IDetailGroup*>& GroupMap)
 {
@@ -391,34 +469,43 @@ void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const FMDMetaDataKey& Ke
 		}
 	}
 
-	IDetailCategoryBuilder* Category = BuilderRow.HasSubtype<IDetailCategoryBuilder*>() ? BuilderRow.GetSubtype<IDetailCategoryBuilder*>() : nullptr;
-	IDetailGroup* Group = BuilderRow.HasSubtype<IDetailGroup*>() ? BuilderRow.GetSubtype<IDetailGroup*>() : nullptr;
-
-	FName GroupName = MetadataProperty.IsValid() ? MetadataProperty->GetFName() : NAME_None;
 	TArray<FString> Subgroups;
 	Key.Category.ParseIntoArray(Subgroups, TEXT("|"));
-	for (const FString& Subgroup : Subgroups)
+	Subgroups.RemoveAll([](const FString& Subgroup)
 	{
-		const FText DisplayName = FText::FromString(Subgroup);
-		if (DisplayName.IsEmptyOrWhitespace())
-		{
-			continue;
-		}
+		return FText::FromString(Subgroup).IsEmptyOrWhitespace();
+	});
+
+	TArray<FName> GroupNames;
+	FMDMetaDataEditorFieldPlanCache::MakeGroupNames(MetadataProperty.IsValid() ? MetadataProperty->GetFName() : NAME_None, Subgroups, GroupNames);
+
+	AddMetadataValueEditor(Key, GroupNames, Subgroups, BuilderRow, GroupMap);
+}
 
-		GroupName = (GroupName.IsNone()) ? *Subgroup : *FString::Printf(TEXT("%s|%s"), *GroupName.ToString(), *Subgroup);
+BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
-		if (GroupMap.Contains(GroupName))
+void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const FMDMetaDataKey& Key, const TArray<FName>& GroupNames, const TArray<FString>& Subgroups, FMDMetadataBuilderRow BuilderRow, TMap<FName, IDetailGroup*>& GroupMap)
+{
+	IDetailCategoryBuilder* Category = BuilderRow.HasSubtype<IDetailCategoryBuilder*>() ? BuilderRow.GetSubtype<IDetailCategoryBuilder*>() : nullptr;
+	IDetailGroup* Group = BuilderRow.HasSubtype<IDetailGroup*>() ? BuilderRow.GetSubtype<IDetailGroup*>() : nullptr;
+
+	check(GroupNames.Num() == Subgroups.Num());
+	for (int32 i = 0; i < GroupNames.Num(); ++i)
+	{
+		const FName& GroupName = GroupNames[i];
+
+		if (IDetailGroup* const* ExistingGroup = GroupMap.Find(GroupName))
 		{
-			Group = GroupMap.FindRef(GroupName);
+			Group = *ExistingGroup;
 		}
 		else if (Group != nullptr)
 		{
-			Group = &Group->AddGroup(GroupName, DisplayName, true);
+			Group = &Group->AddGroup(GroupName, FText::FromString(Subgroups[i]), true);
 			GroupMap.Add(GroupName, Group);
 		}
 		else if (Category != nullptr)
 		{
-			Group = &Category->AddGroup(GroupName, DisplayName, false, true);
+			Group = &Category->AddGroup(GroupName, FText::FromString(Subgroups[i]), false, true);
 			GroupMap.Add(GroupName, Group);
 		}
 	}
@@ -442,9 +529,18 @@ void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const FMDMetaDataKey& Ke
 		FCanExecuteAction::CreateSP(this, &FMDMetaDataEditorFieldView::CanPasteMetadata, Key.Key)
 	};
 
+	const FUIAction PasteAllAction = {
+		FExecuteAction::CreateSP(this, &FMDMetaDataEditorFieldView::PasteAllMetadata),
+		FCanExecuteAction::CreateSP(this, &FMDMetaDataEditorFieldView::CanPasteAllMetadata)
+	};
+
+	// Rows in collapsed groups (such as per-param groups) don't need their widgets until the group is first expanded
+	const bool bDeferWidgets = bStartsCollapsed || (Group != nullptr && !Group->GetExpansionState());
+
 	MetaDataRow
 		.CopyAction(CopyAction)
 		.PasteAction(PasteAction)
+		.AddCustomContextMenuAction(PasteAllAction, INVTEXT("Paste All Metadata"), INVTEXT("Set every Key=Value pair on the clipboard, such as a C++ meta=(...) specifier"))
 		.IsValueEnabled(!bIsReadOnly)
 		.NameContent()
 		[
@@ -455,23 +551,15 @@ void FMDMetaDataEditorFieldView::AddMetadataValueEditor(const FMDMetaDataKey& Ke
 		]
 		.ValueContent()
 		[
-			CreateMetaDataValueWidget(Key)
+			bDeferWidgets
+				? TSharedRef<SWidget>(SNew(SMDMetaDataDeferredWidget).OnGenerateContent(this, &FMDMetaDataEditorFieldView::CreateMetaDataValueWidget, Key))
+				: CreateMetaDataValueWidget(Key)
 		]
 		.ExtensionContent()
 		[
-			SNew(SButton)
-			.IsFocusable(false)
-			.ToolTipText(INVTEXT("Remove this metadata entry"))
-			.ButtonStyle(FAppStyle::Get(), "SimpleButton")
-			.ContentPadding(0)
-			.Visibility(this, &FMDMetaDataEditorFieldView::GetRemoveMetadataButtonVisibility, Key.Key)
-			.OnClicked(this, &FMDMetaDataEditorFieldView::OnRemoveMetadata, Key.Key)
-			.Content()
-			[
-				SNew(SImage)
-				.Image(FAppStyle::GetBrush("Icons.X"))
-				.ColorAndOpacity(FSlateColor::UseForeground())
-			]
+			bDeferWidgets
+				? TSharedRef<SWidget>(SNew(SMDMetaDataDeferredWidget).OnGenerateContent(this, &FMDMetaDataEditorFieldView::CreateRemoveMetadataButton, Key.Key))
+				: CreateRemoveMetadataButton(Key.Key)
 		];
 }
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
@@ -490,72 +578,66 @@ void FMDMetaDataEditorFieldView::AddRawMetadataEditor(FMDMetadataBuilderRow Buil
 		? Group->AddGroup(TEXT("RawMetadata"), INVTEXT("Raw Metadata"))
 		: Category->AddGroup(TEXT("RawMetadata"), INVTEXT("Raw Metadata"));
 
+	// Keep the raw meta data searchable from the details panel filter
+	FString FilterString = TEXT("Raw Meta Data");
 	if (const TMap<FName, FString>* MetadataMap = GetMetadataMap())
 	{
 		for (const TPair<FName, FString>& MetaDataPair : *MetadataMap)
 		{
-			DetailGroup.AddWidgetRow()
-				.FilterString(FText::Format(INVTEXT("{0}={1}"), FText::FromName(MetaDataPair.Key), FText::FromString(MetaDataPair.Value)))
-				.IsEnabled(!bIsReadOnly)
-				.NameContent()
-				.HAlign(HAlign_Fill)
-				[
-					SNew(SEditableTextBox)
-					.Text(FText::FromName(MetaDataPair.Key))
-					.OnTextCommitted(this, &FMDMetaDataEditorFieldView::OnMetadataKeyTextCommitted, MetaDataPair.Key)
-					.RevertTextOnEscape(true)
-				]
-				.ValueContent()
-				.HAlign(HAlign_Fill)
-				[
-					SNew(SEditableTextBox)
-					.Text(this, &FMDMetaDataEditorFieldView::GetMetadataValueText, MetaDataPair.Key)
-					.ToolTipText(this, &FMDMetaDataEditorFieldView::GetMetadataValueText, MetaDataPair.Key)
-					.OnTextCommitted(this, &FMDMetaDataEditorFieldView::OnMetadataValueTextCommittedAllowingEmpty, MetaDataPair.Key)
-					.RevertTextOnEscape(true)
-				]
-				.ExtensionContent()
-				[
-					SNew(SButton)
-					.IsFocusable(false)
-					.ToolTipText(INVTEXT("Remove this meta data"))
-					.ButtonStyle(FAppStyle::Get(), "SimpleButton")
-					.ContentPadding(0)
-					.Visibility(this, &FMDMetaDataEditorFieldView::GetRemoveMetadataButtonVisibility, MetaDataPair.Key)
-					.OnClicked(this, &FMDMetaDataEditorFieldView::OnRemoveMetadata, MetaDataPair.Key)
-					.Content()
-					[
-						SNew(SImage)
-						.Image(FAppStyle::GetBrush("Icons.X"))
-						.ColorAndOpacity(FSlateColor::UseForeground())
-					]
-				];
+			FilterString += FString::Printf(TEXT(" %s=%s"), *MetaDataPair.Key.ToString(), *MetaDataPair.Value);
 		}
 	}
 
-	// Add meta data row
-	if (!bIsReadOnly)
+	const FUIAction PasteAllAction = {
+		FExecuteAction::CreateSP(this, &FMDMetaDataEditorFieldView::PasteAllMetadata),
+		FCanExecuteAction::CreateSP(this, &FMDMetaDataEditorFieldView::CanPasteAllMetadata)
+	};
+
+	// The raw metadata group always starts collapsed, so defer creating the list until it's expanded
+	DetailGroup.AddWidgetRow()
+		.FilterString(FText::FromString(FilterString))
+		.AddCustomContextMenuAction(PasteAllAction, INVTEXT("Paste All Metadata"), INVTEXT("Set every Key=Value pair on the clipboard, such as a C++ meta=(...) specifier"))
+		.WholeRowContent()
+		.HAlign(HAlign_Fill)
+		[
+			SNew(SMDMetaDataDeferredWidget)
+			.OnGenerateContent(this, &FMDMetaDataEditorFieldView::CreateRawMetadataEditor)
+		];
+}
+
+void FMDMetaDataEditorFieldView::AddPresetEditor(FMDMetadataBuilderRow BuilderRow)
+{
+	IDetailCategoryBuilder* Category = BuilderRow.HasSubtype<IDetailCategoryBuilder*>() ? BuilderRow.GetSubtype<IDetailCategoryBuilder*>() : nullptr;
+	IDetailGroup* Group = BuilderRow.HasSubtype<IDetailGroup*>() ? BuilderRow.GetSubtype<IDetailGroup*>() : nullptr;
+
+	if (Category == nullptr && Group == nullptr)
 	{
-		DetailGroup.AddWidgetRow()
-			.FilterString(INVTEXT("Add Meta Data"))
-			.IsEnabled(!bIsReadOnly)
-			.NameContent()
-			.HAlign(HAlign_Fill)
+		return;
+	}
+
+	FDetailWidgetRow& PresetRow = (Group != nullptr)
+		? Group->AddWidgetRow().FilterString(INVTEXT("Preset"))
+		: Category->AddCustomRow(INVTEXT("Preset"));
+
+	PresetRow
+		.NameContent()
+		[
+			SNew(STextBlock)
+			.Font(IDetailLayoutBuilder::GetDetailFont())
+			.Text(INVTEXT("Preset"))
+			.ToolTipText(INVTEXT("Set several meta data values at once, presets are configured in the Meta Data Editor project settings"))
+		]
+		.ValueContent()
+		[
+			SNew(SComboButton)
+			.OnGetMenuContent(this, &FMDMetaDataEditorFieldView::CreatePresetMenu)
+			.ButtonContent()
 			[
-				SNew(SEditableTextBox)
-				.Text(FText::GetEmpty())
-				.HintText(INVTEXT("New Meta Data entry..."))
-				.OnTextCommitted(this, &FMDMetaDataEditorFieldView::OnMetadataKeyTextCommitted, FName(NAME_None))
-				.RevertTextOnEscape(true)
+				SNew(STextBlock)
+				.Font(IDetailLayoutBuilder::GetDetailFont())
+				.Text(INVTEXT("Apply Preset"))
 			]
-			.ValueContent()
-			.HAlign(HAlign_Fill)
-			[
-				SNew(SEditableTextBox)
-				.IsEnabled(false) // Always disabled, require that the key be entered first
-				.Text(FText::GetEmpty())
-			];
-	}
+		];
 }
 
 bool FMDMetaDataEditorFieldView::IsConfigEnabled() const
@@ -605,10 +687,32 @@ TSharedRef<SWidget> FMDMetaDataEditorFieldView::CreateMetaDataValueWidget(const
 	}
 	else if (Key.KeyType == EMDMetaDataEditorKeyType::String)
 	{
-		return SNew(SEditableTextBox)
+		TSharedRef<SWidget> TextBox = SNew(SEditableTextBox)
 			.Text(this, &FMDMetaDataEditorFieldView::GetMetadataValueText, Key.Key)
 			.OnTextCommitted(this, &FMDMetaDataEditorFieldView::OnMetadataValueTextCommitted, Key.Key)
 			.RevertTextOnEscape(true);
+
+		if (Key.Key != MDMDEFV_Private::EditConditionKey)
+		{
+			return TextBox;
+		}
+
+		return SNew(SHorizontalBox)
+			+SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				TextBox
+			]
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(4.f, 0.f, 0.f, 0.f)
+			[
+				SNew(SImage)
+				.Image(FAppStyle::GetBrush("Icons.Warning"))
+				.ToolTipText(this, &FMDMetaDataEditorFieldView::GetEditConditionErrorText)
+				.Visibility(this, &FMDMetaDataEditorFieldView::GetEditConditionErrorVisibility)
+			];
 	}
 	else if (Key.KeyType == EMDMetaDataEditorKeyType::Integer)
 	{
@@ -692,10 +796,85 @@ TSharedRef<SWidget> FMDMetaDataEditorFieldView::CreateMetaDataValueWidget(const
 			.OnSetMetaData(this, &FMDMetaDataEditorFieldView::SetMetadataValue)
 			.MetaDataValue(this, &FMDMetaDataEditorFieldView::GetMetadataValue, Key.Key);
 	}
+	else if (Key.KeyType == EMDMetaDataEditorKeyType::Struct || Key.KeyType == EMDMetaDataEditorKeyType::Class || Key.KeyType == EMDMetaDataEditorKeyType::Interface)
+	{
+		EMDMetaDataTypeKind Kind = EMDMetaDataTypeKind::Interface;
+		FString BasePath;
+		if (Key.KeyType == EMDMetaDataEditorKeyType::Struct)
+		{
+			Kind = EMDMetaDataTypeKind::Struct;
+			BasePath = Key.BaseStruct.ToString();
+		}
+		else if (Key.KeyType == EMDMetaDataEditorKeyType::Class)
+		{
+			Kind = EMDMetaDataTypeKind::Class;
+			BasePath = Key.BaseClass.ToString();
+		}
+
+		const FMDMetaDataEditorModule* Module = FModuleManager::GetModulePtr<FMDMetaDataEditorModule>(TEXT("MDMetaDataEditor"));
+		return SNew(SMDMetaDataTypePicker)
+			.Key(Key.Key)
+			.Kind(Kind)
+			.BasePath(BasePath)
+			.bMultiSelect(Key.bAllowMultipleValues)
+			.TypeIndex((Module != nullptr) ? Module->GetTypeIndex() : nullptr)
+			.OnRemoveMetaData(this, &FMDMetaDataEditorFieldView::RemoveMetadataKey)
+			.OnSetMetaData(this, &FMDMetaDataEditorFieldView::SetMetadataValue)
+			.MetaDataValue(this, &FMDMetaDataEditorFieldView::GetMetadataValue, Key.Key);
+	}
+	else if (Key.KeyType == EMDMetaDataEditorKeyType::EnumValue)
+	{
+		const FMDMetaDataEditorModule* Module = FModuleManager::GetModulePtr<FMDMetaDataEditorModule>(TEXT("MDMetaDataEditor"));
+		return SNew(SMDMetaDataEnumValuePicker)
+			.Key(Key.Key)
+			.Enum(FMDMetaDataEditorPropertyType::GetPropertyEnum(MetadataProperty.Get()))
+			.EnumCache((Module != nullptr) ? Module->GetEnumCache() : nullptr)
+			.OnRemoveMetaData(this, &FMDMetaDataEditorFieldView::RemoveMetadataKey)
+			.OnSetMetaData(this, &FMDMetaDataEditorFieldView::SetMetadataValue)
+			.MetaDataValue(this, &FMDMetaDataEditorFieldView::GetMetadataValue, Key.Key);
+	}
+	else if (Key.KeyType == EMDMetaDataEditorKeyType::Param)
+	{
+		return SNew(SMDMetaDataParamPicker)
+			.Key(Key.Key)
+			.bMultiSelect(Key.bAllowMultipleValues)
+			.OnGetParams(this, &FMDMetaDataEditorFieldView::GetFunctionParams)
+			.OnRemoveMetaData(this, &FMDMetaDataEditorFieldView::RemoveMetadataKey)
+			.OnSetMetaData(this, &FMDMetaDataEditorFieldView::SetMetadataValue)
+			.MetaDataValue(this, &FMDMetaDataEditorFieldView::GetMetadataValue, Key.Key);
+	}
 
 	return SNullWidget::NullWidget;
 }
 
+TSharedRef<SWidget> FMDMetaDataEditorFieldView::CreateRemoveMetadataButton(FName Key)
+{
+	return SNew(SButton)
+		.IsFocusable(false)
+		.ToolTipText(INVTEXT("Remove this metadata entry"))
+		.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+		.ContentPadding(0)
+		.Visibility(this, &FMDMetaDataEditorFieldView::GetRemoveMetadataButtonVisibility, Key)
+		.OnClicked(this, &FMDMetaDataEditorFieldView::OnRemoveMetadata, Key)
+		.Content()
+		[
+			SNew(SImage)
+			.Image(FAppStyle::GetBrush("Icons.X"))
+			.ColorAndOpacity(FSlateColor::UseForeground())
+		];
+}
+
+TSharedRef<SWidget> FMDMetaDataEditorFieldView::CreateRawMetadataEditor()
+{
+	return SNew(SMDRawMetaDataEditor)
+		.bIsReadOnly(bIsReadOnly)
+		.OnGetMetaDataMap(this, &FMDMetaDataEditorFieldView::GetMetadataMap)
+		.OnAddMetaData(this, &FMDMetaDataEditorFieldView::AddMetadataKey)
+		.OnRemoveMetaData(this, &FMDMetaDataEditorFieldView::RemoveMetadataKey)
+		.OnSetMetaData(this, &FMDMetaDataEditorFieldView::SetMetadataValue)
+		.OnRenameMetaData(this, &FMDMetaDataEditorFieldView::SetMetadataKey);
+}
+
 EVisibility FMDMetaDataEditorFieldView::GetRemoveMetadataButtonVisibility(FName Key) const
 {
 	return HasMetadataValue(Key) ? EVisibility::Visible : EVisibility::Collapsed;
@@ -708,25 +887,76 @@ FReply FMDMetaDataEditorFieldView::OnRemoveMetadata(FName Key)
 	return FReply::Handled();
 }
 
-void FMDMetaDataEditorFieldView::OnMetadataKeyTextCommitted(const FText& NewText, ETextCommit::Type InTextCommit, FName OldKey)
+FText FMDMetaDataEditorFieldView::GetMetadataValueText(FName Key) const
 {
-	if (!NewText.IsEmptyOrWhitespace() && (InTextCommit == ETextCommit::OnEnter || InTextCommit == ETextCommit::OnUserMovedFocus))
+	return FText::FromString(GetMetadataValue(Key).Get(TEXT("")));
+}
+
+const FMDEditConditionResult* FMDMetaDataEditorFieldView::FindEditConditionResult() const
+{
+	const uint32 Generation = FMDEditConditionCache::Get().GetGeneration();
+	if (CachedEditConditionGeneration.IsSet() && CachedEditConditionGeneration.GetValue() == Generation)
 	{
-		if (OldKey.IsNone())
-		{
-			AddMetadataKey(*NewText.ToString());
-			RequestRefresh.ExecuteIfBound();
-		}
-		else
+		return CachedEditConditionResult.Get();
+	}
+
+	CachedEditConditionGeneration = Generation;
+	CachedEditConditionResult.Reset();
+
+	if (!ChangeBusHandle.IsValid())
+	{
+		ChangeBusHandle = FMDMetaDataChangeBus::Get().OnMetaDataChanged.AddSP(this, &FMDMetaDataEditorFieldView::OnMetaDataChanged);
+	}
+
+	// EditConditions are resolved against the class or struct that owns the property, they do nothing on params and local variables
+	const FProperty* Property = MetadataProperty.Get();
+	const UStruct* Owner = (Property != nullptr) ? Property->GetOwnerStruct() : nullptr;
+	if (Owner == nullptr || Owner->IsA<UFunction>())
+	{
+		return nullptr;
+	}
+
+	const TOptional<FString> Value = GetMetadataValue(MDMDEFV_Private::EditConditionKey);
+	if (!Value.IsSet() || Value->IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// Copied since the cache's results move around as it grows
+	CachedEditConditionResult = MakeShared<FMDEditConditionResult>(FMDEditConditionCache::Get().FindOrCompile(Owner, Value.GetValue()));
+	return CachedEditConditionResult.Get();
+}
+
+void FMDMetaDataEditorFieldView::OnMetaDataChanged(TConstArrayView<FMDMetaDataChangeRecord> Records) const
+{
+	if (!CachedEditConditionGeneration.IsSet())
+	{
+		return;
+	}
+
+	const FMDMetaDataChangeTarget Target = MakeChangeTarget();
+	for (const FMDMetaDataChangeRecord& Record : Records)
+	{
+		const bool bIsEditCondition = Record.Key == MDMDEFV_Private::EditConditionKey || Record.RenamedFrom == MDMDEFV_Private::EditConditionKey;
+		if (bIsEditCondition && Record.Target == Target)
 		{
-			SetMetadataKey(OldKey, *NewText.ToString());
+			CachedEditConditionGeneration.Reset();
+			CachedEditConditionResult.Reset();
+			return;
 		}
 	}
 }
 
-FText FMDMetaDataEditorFieldView::GetMetadataValueText(FName Key) const
+EVisibility FMDMetaDataEditorFieldView::GetEditConditionErrorVisibility() const
 {
-	return FText::FromString(GetMetadataValue(Key).Get(TEXT("")));
+	const FMDEditConditionResult* Result = FindEditConditionResult();
+	return (Result != nullptr && !Result->IsValid()) ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+FText FMDMetaDataEditorFieldView::GetEditConditionErrorText() const
+{
+	const FMDEditConditionResult* Result = FindEditConditionResult();
+	return (Result != nullptr) ? FText::Join(FText::FromString(TEXT("\n")), Result->Errors) : FText::GetEmpty();
 }
 
 void FMDMetaDataEditorFieldView::OnMetadataValueTextCommitted(const FText& NewText, ETextCommit::Type InTextCommit, FName Key)
@@ -744,14 +974,6 @@ void FMDMetaDataEditorFieldView::OnMetadataValueTextCommitted(const FText& NewTe
 	}
 }
 
-void FMDMetaDataEditorFieldView::OnMetadataValueTextCommittedAllowingEmpty(const FText& NewText, ETextCommit::Type InTextCommit, FName Key)
-{
-	if (!Key.IsNone() && (InTextCommit == ETextCommit::OnEnter || InTextCommit == ETextCommit::OnUserMovedFocus))
-	{
-		SetMetadataValue(Key, NewText.ToString());
-	}
-}
-
 TOptional<int32> FMDMetaDataEditorFieldView::GetMetadataValueInt(FName Key) const
 {
 	TOptional<FString> Value = GetMetadataValue(Key);
@@ -849,7 +1071,7 @@ void FMDMetaDataEditorFieldView::AddMetadataKey(const FName& Key)
 
 void FMDMetaDataEditorFieldView::SetMetadataValue(const FName& Key, const FString& Value)
 {
-	TOptional<FString> CurrentValue = GetMetadataValue(Key);
+	const TOptional<FString> CurrentValue = GetMetadataValue(Key);
 	if (CurrentValue.IsSet() && CurrentValue->Equals(Value))
 	{
 		return;
@@ -913,9 +1135,21 @@ void FMDMetaDataEditorFieldView::SetMetadataValue(const FName& Key, const FStrin
 		Struct->SetMetaData(Key, *Value);
 	}
 
+	if (!bIsRenamingKey)
+	{
+		FMDMetaDataChangeBus::Get().Publish(MakeChangeTarget(), Key, MDMDEFV_Private::MakePooledValue(CurrentValue), FMDMetaDataValue(Value), EMDMetaDataChangeSource::Editor);
+	}
+
 	if (BlueprintPtr.IsValid())
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsModified(BlueprintPtr.Get());
+		if (FMDMetaDataEditorBatchScope::IsActive())
+		{
+			FMDMetaDataEditorBatchScope::AddModifiedBlueprint(BlueprintPtr.Get());
+		}
+		else
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsModified(BlueprintPtr.Get());
+		}
 	}
 	else
 	{
@@ -956,13 +1190,20 @@ void FMDMetaDataEditorFieldView::SetMetadataKey(const FName& OldKey, const FName
 	}
 
 	FScopedTransaction Transaction(FText::Format(INVTEXT("Changed Meta Data Key [{0} -> {1}]"), FText::FromName(OldKey), FText::FromName(NewKey)));
-	RemoveMetadataKey(OldKey);
-	SetMetadataValue(NewKey, Value.GetValue());
+	{
+		TGuardValue<bool> RenamingGuard(bIsRenamingKey, true);
+		RemoveMetadataKey(OldKey);
+		SetMetadataValue(NewKey, Value.GetValue());
+	}
+
+	const FMDMetaDataValue PooledValue(Value.GetValue());
+	FMDMetaDataChangeBus::Get().PublishRename(MakeChangeTarget(), OldKey, NewKey, PooledValue, PooledValue, EMDMetaDataChangeSource::Editor);
 }
 
 void FMDMetaDataEditorFieldView::RemoveMetadataKey(const FName& Key)
 {
-	if (!HasMetadataValue(Key))
+	const TOptional<FString> CurrentValue = GetMetadataValue(Key);
+	if (!CurrentValue.IsSet())
 	{
 		return;
 	}
@@ -1026,9 +1267,21 @@ void FMDMetaDataEditorFieldView::RemoveMetadataKey(const FName& Key)
 		Struct->RemoveMetaData(Key);
 	}
 
+	if (!bIsRenamingKey)
+	{
+		FMDMetaDataChangeBus::Get().Publish(MakeChangeTarget(), Key, MDMDEFV_Private::MakePooledValue(CurrentValue), TOptional<FMDMetaDataValue>(), EMDMetaDataChangeSource::Editor);
+	}
+
 	if (BlueprintPtr.IsValid())
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsModified(BlueprintPtr.Get());
+		if (FMDMetaDataEditorBatchScope::IsActive())
+		{
+			FMDMetaDataEditorBatchScope::AddModifiedBlueprint(BlueprintPtr.Get());
+		}
+		else
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsModified(BlueprintPtr.Get());
+		}
 	}
 	else
 	{
@@ -1036,12 +1289,76 @@ void FMDMetaDataEditorFieldView::RemoveMetadataKey(const FName& Key)
 	}
 }
 
+FString FMDMetaDataEditorFieldView::FormatMetadata(FName Key, const FString& Value)
+{
+	// Key=Value format, the same as C++
+	return FString::Printf(TEXT("%s=\"%s\""), *Key.ToString(), *Value.ReplaceCharWithEscapedChar());
+}
+
+FMDMetaDataChangeTarget FMDMetaDataEditorFieldView::MakeChangeTarget() const
+{
+	FMDMetaDataChangeTarget Target;
+	if (UBlueprint* Blueprint = BlueprintPtr.Get())
+	{
+		Target.Asset = Blueprint;
+	}
+	else if (UUserDefinedStruct* Struct = MetadataStruct.Get())
+	{
+		Target.Asset = Struct;
+	}
+
+	if (const FProperty* Property = MetadataProperty.Get())
+	{
+		Target.FieldName = Property->GetFName();
+		if (const UFunction* Function = Property->GetOwner<UFunction>())
+		{
+			Target.ScopeName = Function->GetFName();
+		}
+		else if (!Target.Asset.IsValid())
+		{
+			// Struct properties are owned by the struct itself
+			Target.Asset = Property->GetOwnerUObject();
+		}
+	}
+	else if (const UK2Node_FunctionEntry* FuncNode = MetadataFunctionEntry.Get())
+	{
+		Target.FieldName = FuncNode->FunctionReference.GetMemberName();
+	}
+	else if (const UK2Node_Tunnel* TunnelNode = MetadataTunnel.Get())
+	{
+		Target.FieldName = IsValid(TunnelNode->GetGraph()) ? TunnelNode->GetGraph()->GetFName() : NAME_None;
+	}
+	else if (const UK2Node_CustomEvent* EventNode = MetadataCustomEvent.Get())
+	{
+		Target.FieldName = EventNode->CustomFunctionName;
+	}
+
+	return Target;
+}
+
+TArray<FName> FMDMetaDataEditorFieldView::GetFunctionParams() const
+{
+	const UK2Node_EditablePinBase* Node = MetadataFunctionEntry.Get();
+	if (Node == nullptr)
+	{
+		Node = MetadataCustomEvent.Get();
+	}
+
+	const FMDMetaDataEditorModule* Module = FModuleManager::GetModulePtr<FMDMetaDataEditorModule>(TEXT("MDMetaDataEditor"));
+	FMDMetaDataReferenceIndex* ReferenceIndex = (Module != nullptr) ? Module->GetReferenceIndex() : nullptr;
+	if (Node == nullptr || ReferenceIndex == nullptr)
+	{
+		return {};
+	}
+
+	return TArray<FName>(ReferenceIndex->GetFunctionParams(Node));
+}
+
 void FMDMetaDataEditorFieldView::CopyMetadata(FName Key) const
 {
 	const TOptional<FString> Value = GetMetadataValue(Key);
 
-	// Copy in Key=Value format
-	FPlatformApplicationMisc::ClipboardCopy(*FString::Printf(TEXT("%s=\"%s\""), *Key.ToString(), *Value.Get(TEXT("")).ReplaceCharWithEscapedChar()));
+	FPlatformApplicationMisc::ClipboardCopy(*FormatMetadata(Key, Value.Get(TEXT(""))));
 }
 
 bool FMDMetaDataEditorFieldView::CanCopyMetadata(FName Key) const
@@ -1051,57 +1368,175 @@ bool FMDMetaDataEditorFieldView::CanCopyMetadata(FName Key) const
 
 void FMDMetaDataEditorFieldView::PasteMetadata(FName Key)
 {
-	FString Clipboard;
-	FPlatformApplicationMisc::ClipboardPaste(Clipboard);
-	Clipboard.TrimStartAndEndInline();
+	// Handles both the same metadata format used in C++ and the clipboard being just the value
+	const TOptional<FString> Value = FMDMetaDataClipboard::GetSnapshot().FindValueForKey(Key);
+	if (Value.IsSet())
+	{
+		SetMetadataValue(Key, Value.GetValue());
+	}
+}
+
+bool FMDMetaDataEditorFieldView::CanPasteMetadata(FName Key) const
+{
+	return FMDMetaDataClipboard::GetSnapshot().FindValueForKey(Key).IsSet();
+}
+
+void FMDMetaDataEditorFieldView::PasteAllMetadata()
+{
+	const FMDMetaDataClipboardSnapshot& Clipboard = FMDMetaDataClipboard::GetSnapshot();
+	if (bIsReadOnly || !Clipboard.HasSpecifierList())
+	{
+		return;
+	}
+
+	const TArray<FMDMetaDataSpecifier> Specifiers = Clipboard.List.Specifiers;
+
+	{
+		// Hold off refreshing until every key has been set
+		FSimpleDelegate Refresh = MoveTemp(RequestRefresh);
+		RequestRefresh.Unbind();
+
+		FMDMetaDataEditorBatchScope BatchScope(FText::Format(INVTEXT("Paste All Meta Data [{0} Keys]"), FText::AsNumber(Specifiers.Num())));
+		for (const FMDMetaDataSpecifier& Specifier : Specifiers)
+		{
+			SetMetadataValue(Specifier.Key, Specifier.Value);
+		}
+
+		RequestRefresh = MoveTemp(Refresh);
+	}
+
+	if (!BlueprintPtr.IsValid())
+	{
+		RequestRefresh.ExecuteIfBound();
+	}
+}
+
+bool FMDMetaDataEditorFieldView::CanPasteAllMetadata() const
+{
+	return !bIsReadOnly && FMDMetaDataClipboard::GetSnapshot().HasSpecifierList();
+}
+
+bool FMDMetaDataEditorFieldView::CanApplyPreset(const FMDMetaDataPreset& Preset) const
+{
+	if (bIsReadOnly || !IsConfigEnabled() || Preset.Values.IsEmpty())
+	{
+		return false;
+	}
+
+	// The configured keys have already been tested against this field's Blueprint and property type
+	TSet<FName> FieldKeys;
+	AddMetadataValueEditor([&FieldKeys](const FMDMetaDataKey& Key)
+	{
+		FieldKeys.Add(Key.Key);
+	});
+
+	return Algo::AllOf(Preset.Values, [&FieldKeys](const FMDMetaDataPresetValue& PresetValue)
+	{
+		return FieldKeys.Contains(PresetValue.Key);
+	});
+}
 
-	// Handle pasting the same metadata format used in C++
-	int32 EqualIndex = INDEX_NONE;
-	if (Clipboard.FindChar(TEXT('='), EqualIndex) && EqualIndex > 0)
+void FMDMetaDataEditorFieldView::ApplyPreset(const FMDMetaDataPreset& Preset)
+{
+	const TSharedPtr<FMDMetaDataEditorFieldView> FieldView = AsShared();
+	ApplyPresetToFields(Preset, MakeArrayView(&FieldView, 1));
+}
+
+int32 FMDMetaDataEditorFieldView::ApplyPresetToFields(const FMDMetaDataPreset& Preset, TConstArrayView<TSharedPtr<FMDMetaDataEditorFieldView>> FieldViews)
+{
+	// Skip the fields the preset can't be used on before anything is changed, so a bad selection doesn't leave a partial edit behind
+	TArray<TSharedPtr<FMDMetaDataEditorFieldView>> ValidFieldViews;
+	for (const TSharedPtr<FMDMetaDataEditorFieldView>& FieldView : FieldViews)
 	{
-		// Skip if the clipboard has != or == without starting with "Key=" (like a raw edit condition) but ending with = means a blank value
-		if (Clipboard[EqualIndex - 1] != TEXT('!') && (EqualIndex == (Clipboard.Len() - 1) || Clipboard[EqualIndex + 1] != TEXT('=')))
+		if (FieldView.IsValid() && FieldView->CanApplyPreset(Preset))
 		{
-			// Allow paste if the key matches
-			const FString ClipKey = Clipboard.Left(EqualIndex).TrimStartAndEnd();
-			if (*ClipKey != Key)
+			ValidFieldViews.Add(FieldView);
+		}
+	}
+
+	if (ValidFieldViews.IsEmpty())
+	{
+		return 0;
+	}
+
+	{
+		FMDMetaDataEditorBatchScope BatchScope(FText::Format(INVTEXT("Apply Meta Data Preset {0} [{1} Fields]"), Preset.GetDisplayText(), FText::AsNumber(ValidFieldViews.Num())));
+		for (const TSharedPtr<FMDMetaDataEditorFieldView>& FieldView : ValidFieldViews)
+		{
+			// Hold off refreshing until every field has been set
+			FSimpleDelegate Refresh = MoveTemp(FieldView->RequestRefresh);
+			FieldView->RequestRefresh.Unbind();
+
+			for (const FMDMetaDataPresetValue& PresetValue : Preset.Values)
 			{
-				return;
+				FieldView->SetMetadataValue(PresetValue.Key, PresetValue.Value);
 			}
 
-			const FString ClipValue = Clipboard.Mid(EqualIndex + 1).TrimStartAndEnd().TrimQuotes();
-			SetMetadataValue(Key, Clipboard.ReplaceEscapedCharWithChar());
+			FieldView->RequestRefresh = MoveTemp(Refresh);
 		}
 	}
 
-	// Clipboard is just the value
-	if (!Clipboard.IsEmpty())
+	// Blueprints refresh once they're marked as modified at the end of the batch, structs need to be refreshed once each
+	TSet<const UStruct*> RefreshedStructs;
+	for (const TSharedPtr<FMDMetaDataEditorFieldView>& FieldView : ValidFieldViews)
 	{
-		Clipboard.TrimQuotesInline();
-		SetMetadataValue(Key, Clipboard.ReplaceEscapedCharWithChar());
+		if (FieldView->BlueprintPtr.IsValid())
+		{
+			continue;
+		}
+
+		// Fields without an owning struct can't share a refresh
+		const UStruct* OwningStruct = FieldView->MetadataStruct.IsValid() ? FieldView->MetadataStruct.Get() : nullptr;
+		if (OwningStruct == nullptr && FieldView->MetadataProperty.IsValid())
+		{
+			OwningStruct = FieldView->MetadataProperty->GetOwnerStruct();
+		}
+
+		bool bIsAlreadyRefreshed = false;
+		if (OwningStruct != nullptr)
+		{
+			RefreshedStructs.Add(OwningStruct, &bIsAlreadyRefreshed);
+		}
+
+		if (!bIsAlreadyRefreshed)
+		{
+			FieldView->RequestRefresh.ExecuteIfBound();
+		}
 	}
+
+	return ValidFieldViews.Num();
 }
 
-bool FMDMetaDataEditorFieldView::CanPasteMetadata(FName Key) const
+TSharedRef<SWidget> FMDMetaDataEditorFieldView::CreatePresetMenu()
 {
-	FString Clipboard;
-	FPlatformApplicationMisc::ClipboardPaste(Clipboard);
-	Clipboard.TrimStartAndEndInline();
+	FMenuBuilder MenuBuilder(true, nullptr);
 
-	// Handle pasting the same metadata format used in C++
-	int32 EqualIndex = INDEX_NONE;
-	if (Clipboard.FindChar(TEXT('='), EqualIndex) && EqualIndex > 0)
+	for (const FMDMetaDataPreset& Preset : GetDefault<UMDMetaDataEditorConfig>()->GetMetaDataPresets())
 	{
-		// Skip if the clipboard has != or == without starting with "Key=" (like a raw edit condition) but ending with = means a blank value
-		if (Clipboard[EqualIndex - 1] != TEXT('!') && (EqualIndex == (Clipboard.Len() - 1) || Clipboard[EqualIndex + 1] != TEXT('=')))
-		{
-			// Allow paste if the key matches
-			Clipboard.LeftInline(EqualIndex);
-			Clipboard.TrimStartAndEndInline();
-			return *Clipboard == Key;
-		}
+		MenuBuilder.AddMenuEntry(
+			Preset.GetDisplayText(),
+			Preset.GetToolTipText(),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateSP(this, &FMDMetaDataEditorFieldView::ApplyPresetByName, Preset.PresetName),
+				FCanExecuteAction::CreateSP(this, &FMDMetaDataEditorFieldView::CanApplyPresetByName, Preset.PresetName)
+			)
+		);
 	}
 
-	// Clipboard is just the value
-	return !Clipboard.IsEmpty();
+	return MenuBuilder.MakeWidget();
+}
+
+void FMDMetaDataEditorFieldView::ApplyPresetByName(FName PresetName)
+{
+	if (const FMDMetaDataPreset* Preset = GetDefault<UMDMetaDataEditorConfig>()->FindMetaDataPreset(PresetName))
+	{
+		ApplyPreset(*Preset);
+	}
+}
+
+bool FMDMetaDataEditorFieldView::CanApplyPresetByName(FName PresetName) const
+{
+	const FMDMetaDataPreset* Preset = GetDefault<UMDMetaDataEditorConfig>()->FindMetaDataPreset(PresetName);
+	return Preset != nullptr && CanApplyPreset(*Preset);
 }
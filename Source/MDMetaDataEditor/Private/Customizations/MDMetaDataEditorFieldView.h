@@ -2,7 +2,9 @@
 
 #pragma once
 
+#include "Containers/ArrayView.h"
 #include "Containers/Union.h"
+#include "Delegates/IDelegateInstance.h"
 #include "Input/Reply.h"
 #include "Layout/Visibility.h"
 #include "SCheckBoxList.h"
@@ -14,7 +16,11 @@ class UK2Node_EditablePinBase;
 class IDetailCategoryBuilder;
 class IDetailLayoutBuilder;
 struct FMDMetaDataKey;
+struct FMDMetaDataPreset;
 struct FKismetUserDeclaredFunctionMetadata;
+struct FMDMetaDataChangeRecord;
+struct FMDMetaDataChangeTarget;
+struct FMDEditConditionResult;
 
 namespace ETextCommit
 {
@@ -52,9 +58,13 @@ public:
 	FMDMetaDataEditorFieldView(UK2Node_FunctionEntry* InFunctionEntry, UBlueprint* InBlueprint);
 	FMDMetaDataEditorFieldView(UK2Node_Tunnel* InTunnel, UBlueprint* InBlueprint);
 	FMDMetaDataEditorFieldView(UK2Node_CustomEvent* InCustomEvent, UBlueprint* InBlueprint);
+	~FMDMetaDataEditorFieldView();
 
 	static const FString MultipleValues;
 
+	// Formats a single key the way it's copied to the clipboard, eg. `ClampMin="0"`
+	static FString FormatMetadata(FName Key, const FString& Value);
+
 	const TMap<FName, FString>* GetMetadataMap() const;
 	FKismetUserDeclaredFunctionMetadata* GetFunctionMetadataWithModify() const;
 
@@ -63,25 +73,54 @@ public:
 	typedef TUnion<IDetailCategoryBuilder*, IDetailGroup*> FMDMetadataBuilderRow;
 	FMDMetadataBuilderRow InitCategories(IDetailLayoutBuilder& DetailLayout, TMap<FName, IDetailGroup*>& GroupMap);
 
-	void AddMetadataValueEditor(const TFunctionRef<void(const FMDMetaDataKey&)>& Func);
+	void AddMetadataValueEditor(const TFunctionRef<void(const FMDMetaDataKey&)>& Func) const;
 	void AddMetadataValueEditor(const FMDMetaDataKey& Key, FMDMetadataBuilderRow BuilderRow, TMap<FName, IDetailGroup*>& GroupMap);
 	void AddRawMetadataEditor(FMDMetadataBuilderRow BuilderRow);
+	void AddPresetEditor(FMDMetadataBuilderRow BuilderRow);
 
 	bool IsConfigEnabled() const;
+	bool IsReadOnly() const { return bIsReadOnly; }
+
+	void AddMetadataKey(const FName& Key);
+	void SetMetadataValue(const FName& Key, const FString& Value);
+	bool HasMetadataValue(const FName& Key) const;
+	TOptional<FString> GetMetadataValue(FName Key) const;
+	void SetMetadataKey(const FName& OldKey, const FName& NewKey);
+	void RemoveMetadataKey(const FName& Key);
+
+	// The variable or param being edited, null for functions, events and structs
+	const FProperty* GetProperty() const { return MetadataProperty.Get(); }
+
+	// The widgets of a single key's row, also used outside of details panels
+	TSharedRef<SWidget> CreateMetaDataValueWidget(const FMDMetaDataKey& Key);
+	TSharedRef<SWidget> CreateRemoveMetadataButton(FName Key);
+
+	// Whether every key of the preset is configured for this field, checked before anything is changed
+	bool CanApplyPreset(const FMDMetaDataPreset& Preset) const;
+	void ApplyPreset(const FMDMetaDataPreset& Preset);
+
+	// Sets the preset on every field it can be applied to under one transaction, returns the number of fields it was applied to
+	static int32 ApplyPresetToFields(const FMDMetaDataPreset& Preset, TConstArrayView<TSharedPtr<FMDMetaDataEditorFieldView>> FieldViews);
 
 	FSimpleDelegate RequestRefresh;
 
 private:
-	TSharedRef<SWidget> CreateMetaDataValueWidget(const FMDMetaDataKey& Key);
+	// Adds the rows planned ahead of time by FMDMetaDataEditorFieldPlanCache, returns false if there's no valid plan for this field
+	bool AddPlannedMetadataValueEditors(FMDMetadataBuilderRow BuilderRow, TMap<FName, IDetailGroup*>& GroupMap);
+	void AddMetadataValueEditor(const FMDMetaDataKey& Key, const TArray<FName>& GroupNames, const TArray<FString>& Subgroups, FMDMetadataBuilderRow BuilderRow, TMap<FName, IDetailGroup*>& GroupMap);
+
+	TSharedRef<SWidget> CreateRawMetadataEditor();
 
 	EVisibility GetRemoveMetadataButtonVisibility(FName Key) const;
 	FReply OnRemoveMetadata(FName Key);
 
-	void OnMetadataKeyTextCommitted(const FText& NewText, ETextCommit::Type InTextCommit, FName OldKey);
+	const FMDEditConditionResult* FindEditConditionResult() const;
+	void OnMetaDataChanged(TConstArrayView<FMDMetaDataChangeRecord> Records) const;
+	EVisibility GetEditConditionErrorVisibility() const;
+	FText GetEditConditionErrorText() const;
 
 	FText GetMetadataValueText(FName Key) const;
 	void OnMetadataValueTextCommitted(const FText& NewText, ETextCommit::Type InTextCommit, FName Key);
-	void OnMetadataValueTextCommittedAllowingEmpty(const FText& NewText, ETextCommit::Type InTextCommit, FName Key);
 
 	TOptional<int32> GetMetadataValueInt(FName Key) const;
 	void OnMetadataValueIntCommitted(int32 Value, ETextCommit::Type InTextCommit, FName Key);
@@ -96,17 +135,21 @@ private:
 	template<bool bIsBoolean>
 	FText GetCheckBoxToolTip(FName Key) const;
 
-	void AddMetadataKey(const FName& Key);
-	void SetMetadataValue(const FName& Key, const FString& Value);
-	bool HasMetadataValue(const FName& Key) const;
-	TOptional<FString> GetMetadataValue(FName Key) const;
-	void SetMetadataKey(const FName& OldKey, const FName& NewKey);
-	void RemoveMetadataKey(const FName& Key);
+	FMDMetaDataChangeTarget MakeChangeTarget() const;
+
+	// The params of the function, custom event or macro being edited
+	TArray<FName> GetFunctionParams() const;
 
 	void CopyMetadata(FName Key) const;
 	bool CanCopyMetadata(FName Key) const;
 	void PasteMetadata(FName Key);
 	bool CanPasteMetadata(FName Key) const;
+	void PasteAllMetadata();
+	bool CanPasteAllMetadata() const;
+
+	TSharedRef<SWidget> CreatePresetMenu();
+	void ApplyPresetByName(FName PresetName);
+	bool CanApplyPresetByName(FName PresetName) const;
 
 	TWeakFieldPtr<FProperty> MetadataProperty;
 	TWeakObjectPtr<UUserDefinedStruct> MetadataStruct;
@@ -115,6 +158,15 @@ private:
 	TWeakObjectPtr<UK2Node_CustomEvent> MetadataCustomEvent;
 	TWeakObjectPtr<UBlueprint> BlueprintPtr;
 
+	// The EditCondition row's warning is polled every frame, so its result is kept until the key changes or the cache invalidates it
+	mutable TSharedPtr<const FMDEditConditionResult> CachedEditConditionResult;
+	mutable TOptional<uint32> CachedEditConditionGeneration;
+	mutable FDelegateHandle ChangeBusHandle;
+
 	bool bIsReadOnly = false;
+	// Set while SetMetadataKey moves a value, so it's published as one rename instead of a removal and an add
+	bool bIsRenamingKey = false;
+	// True if this field's rows are added to a group that starts collapsed
+	bool bStartsCollapsed = false;
 	EMDMetaDataEditorFieldType FieldType = EMDMetaDataEditorFieldType::Unknown;
 };
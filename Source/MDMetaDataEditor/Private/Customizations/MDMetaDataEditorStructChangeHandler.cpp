@@ -3,10 +3,41 @@
 
 #include "MDMetaDataEditorStructChangeHandler.h"
 
+#include "Engine/UserDefinedStruct.h"
+#include "MDEditConditionCache.h"
+#include "MDMetaDataChangeBus.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "UObject/MetaData.h"
 #include "UObject/Package.h"
 
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
+#include "StructUtils/UserDefinedStruct.h"
+#endif
+
+namespace MDMDSCH_Private
+{
+	// Publishes the keys a recreated property or the struct has that it didn't have before the change, everything else is restored from the cache
+	void PublishAddedMetaData(const UUserDefinedStruct* Struct, FName FieldName, const TMap<FName, FString>* MetaData, const TMap<FName, FMDMetaDataValue>* CachedMetaData)
+	{
+		if (MetaData == nullptr)
+		{
+			return;
+		}
+
+		FMDMetaDataChangeTarget Target;
+		Target.Asset = const_cast<UUserDefinedStruct*>(Struct);
+		Target.FieldName = FieldName;
+
+		for (const TPair<FName, FString>& MetaDataPair : *MetaData)
+		{
+			if (CachedMetaData == nullptr || !CachedMetaData->Contains(MetaDataPair.Key))
+			{
+				FMDMetaDataChangeBus::Get().Publish(Target, MetaDataPair.Key, TOptional<FMDMetaDataValue>(), FMDMetaDataValue(MetaDataPair.Value), EMDMetaDataChangeSource::StructChange);
+			}
+		}
+	}
+}
+
 void FMDMetaDataEditorStructChangeHandler::PreChange(const UUserDefinedStruct* Struct, FStructureEditorUtils::EStructureEditorChangeInfo Info)
 {
 	if (IsValid(Struct))
@@ -20,14 +51,14 @@ void FMDMetaDataEditorStructChangeHandler::PreChange(const UUserDefinedStruct* S
 			if (TMap<FName, FString>* MetaDataMap = UMetaData::GetMapForObject(Struct))
 #endif
 			{
-				Cache.StructMetadata = *MetaDataMap;
+				FMDMetaDataValuePool::Get().InternMap(*MetaDataMap, Cache.StructMetadata);
 			}
 
 			for (TFieldIterator<FProperty> PropertyIter(Struct); PropertyIter; ++PropertyIter)
 			{
 				if (const TMap<FName, FString>* PropertyMetaDataMap = PropertyIter->GetMetaDataMap())
 				{
-					Cache.PropertyMetadata.FindOrAdd(PropertyIter->GetFName()) = *PropertyMetaDataMap;
+					FMDMetaDataValuePool::Get().InternMap(*PropertyMetaDataMap, Cache.PropertyMetadata.FindOrAdd(PropertyIter->GetFName()));
 				}
 			}
 		}
@@ -38,6 +69,9 @@ void FMDMetaDataEditorStructChangeHandler::PostChange(const UUserDefinedStruct*
 {
 	if (IsValid(Struct))
 	{
+		// The struct's properties were recreated
+		FMDEditConditionCache::Get().Invalidate(Struct);
+
 		if (FMDMetaDataEditorCachedStructMetadata* Cache = CachedStructMetadata.Find(Struct))
 		{
 			if (--Cache->Count == 0)
@@ -47,13 +81,37 @@ void FMDMetaDataEditorStructChangeHandler::PostChange(const UUserDefinedStruct*
 #else // Pre UE 5.6
 				TMap<FName, FString>& MetaDataMap = Struct->GetOutermost()->GetMetaData()->ObjectMetaDataMap.FindOrAdd(Struct);
 #endif
-				MetaDataMap.Append(MoveTemp(Cache->StructMetadata));
+				MDMDSCH_Private::PublishAddedMetaData(Struct, NAME_None, &MetaDataMap, &Cache->StructMetadata);
+				for (const TPair<FName, FMDMetaDataValue>& MetaDataPair : Cache->StructMetadata)
+				{
+					MetaDataMap.Add(MetaDataPair.Key, MetaDataPair.Value.ToString());
+				}
 
 				for (TFieldIterator<FProperty> PropertyIter(Struct); PropertyIter; ++PropertyIter)
 				{
-					if (TMap<FName, FString>* PropertyMetaDataMap = Cache->PropertyMetadata.Find(PropertyIter->GetFName()))
+					const TMap<FName, FMDMetaDataValue>* PropertyMetaDataMap = Cache->PropertyMetadata.Find(PropertyIter->GetFName());
+					MDMDSCH_Private::PublishAddedMetaData(Struct, PropertyIter->GetFName(), PropertyIter->GetMetaDataMap(), PropertyMetaDataMap);
+					if (PropertyMetaDataMap != nullptr)
+					{
+						for (const TPair<FName, FMDMetaDataValue>& MetaDataPair : *PropertyMetaDataMap)
+						{
+							PropertyIter->SetMetaData(MetaDataPair.Key, *MetaDataPair.Value.ToString());
+						}
+
+						Cache->PropertyMetadata.Remove(PropertyIter->GetFName());
+					}
+				}
+
+				// Anything left over belonged to properties that were removed or renamed by the change
+				for (const TPair<FName, TMap<FName, FMDMetaDataValue>>& PropertyMetaData : Cache->PropertyMetadata)
+				{
+					FMDMetaDataChangeTarget Target;
+					Target.Asset = const_cast<UUserDefinedStruct*>(Struct);
+					Target.FieldName = PropertyMetaData.Key;
+
+					for (const TPair<FName, FMDMetaDataValue>& MetaData : PropertyMetaData.Value)
 					{
-						PropertyIter->AppendMetaData(*PropertyMetaDataMap);
+						FMDMetaDataChangeBus::Get().Publish(Target, MetaData.Key, MetaData.Value, TOptional<FMDMetaDataValue>(), EMDMetaDataChangeSource::StructChange);
 					}
 				}
 
@@ -3,13 +3,15 @@
 #pragma once
 
 #include "Kismet2/StructureEditorUtils.h"
+#include "MDMetaDataValuePool.h"
 #include "UObject/ObjectKey.h"
 
 struct FMDMetaDataEditorCachedStructMetadata
 {
 	int32 Count = 0;
-	TMap<FName, FString> StructMetadata;
-	TMap<FName, TMap<FName, FString>> PropertyMetadata;
+	// Interned, since the same values repeat across a struct's members and are published again for the members a change removes
+	TMap<FName, FMDMetaDataValue> StructMetadata;
+	TMap<FName, TMap<FName, FMDMetaDataValue>> PropertyMetadata;
 };
 
 // Structs recreate their properties when compiled (just like classes) so this object will cache the metadata before compiling and
@@ -0,0 +1,373 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataDiff.h"
+
+#include "Algo/AllOf.h"
+#include "ContentBrowserMenuContexts.h"
+#include "Customizations/MDMetaDataEditorFieldView.h"
+#include "DiffUtils.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "ISourceControlModule.h"
+#include "ISourceControlProvider.h"
+#include "ISourceControlRevision.h"
+#include "Logging/MessageLog.h"
+#include "Logging/TokenizedMessage.h"
+#include "SourceControlHelpers.h"
+#include "SourceControlOperations.h"
+#include "Styling/AppStyle.h"
+#include "ToolMenus.h"
+#include "Validation/MDMetaDataProjectValidator.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
+#include "StructUtils/UserDefinedStruct.h"
+#endif
+
+namespace MDMDDF_Private
+{
+	const FName MenuOwner = TEXT("MDMetaDataDiff");
+
+	const TMap<FName, FString> EmptyMetaData;
+
+	bool IsDiffableAsset(const FAssetData& AssetData)
+	{
+		return AssetData.IsInstanceOf(UBlueprint::StaticClass()) || AssetData.IsInstanceOf(UUserDefinedStruct::StaticClass());
+	}
+
+	void SortMetaData(const TMap<FName, FString>& MetaData, TArray<const TPair<FName, FString>*>& OutPairs)
+	{
+		OutPairs.Reserve(MetaData.Num());
+		for (const TPair<FName, FString>& Pair : MetaData)
+		{
+			OutPairs.Add(&Pair);
+		}
+
+		OutPairs.Sort([](const TPair<FName, FString>& A, const TPair<FName, FString>& B)
+		{
+			return A.Key.LexicalLess(B.Key);
+		});
+	}
+
+	// Orders fields by usage, then scope, then name
+	int32 CompareFields(const FMDMetaDataFieldSummary& A, const FMDMetaDataFieldSummary& B)
+	{
+		if (A.Usage != B.Usage)
+		{
+			return (A.Usage < B.Usage) ? -1 : 1;
+		}
+
+		if (A.ScopeName != B.ScopeName)
+		{
+			return A.ScopeName.Compare(B.ScopeName);
+		}
+
+		return A.FieldName.Compare(B.FieldName);
+	}
+
+	void GatherSortedFields(const UObject* Asset, TArray<FMDMetaDataFieldSummary>& OutFields)
+	{
+		if (Asset == nullptr)
+		{
+			return;
+		}
+
+		FMDMetaDataProjectValidator::GatherFields(Asset, OutFields);
+
+		for (FMDMetaDataFieldSummary& Field : OutFields)
+		{
+			// The struct itself is named after the asset, which is different when comparing two assets
+			if (Field.Usage == EMDMetaDataKeyUsage::Structs)
+			{
+				Field.FieldName = NAME_None;
+			}
+		}
+
+		OutFields.Sort([](const FMDMetaDataFieldSummary& A, const FMDMetaDataFieldSummary& B)
+		{
+			return CompareFields(A, B) < 0;
+		});
+	}
+}
+
+void FMDMetaDataDiff::DiffAssets(const UObject* OldAsset, const UObject* NewAsset, TArray<FMDMetaDataFieldDiff>& OutFieldDiffs)
+{
+	using namespace MDMDDF_Private;
+
+	check(IsInGameThread());
+
+	TArray<FMDMetaDataFieldSummary> OldFields;
+	TArray<FMDMetaDataFieldSummary> NewFields;
+	GatherSortedFields(OldAsset, OldFields);
+	GatherSortedFields(NewAsset, NewFields);
+
+	auto AddFieldDiff = [&OutFieldDiffs](const FMDMetaDataFieldSummary& Field, const TMap<FName, FString>& OldMetaData, const TMap<FName, FString>& NewMetaData)
+	{
+		FMDMetaDataFieldDiff FieldDiff;
+		FieldDiff.Usage = Field.Usage;
+		FieldDiff.ScopeName = Field.ScopeName;
+		FieldDiff.FieldName = Field.FieldName;
+		DiffMetaData(OldMetaData, NewMetaData, FieldDiff.Keys);
+
+		if (!FieldDiff.Keys.IsEmpty())
+		{
+			OutFieldDiffs.Add(MoveTemp(FieldDiff));
+		}
+	};
+
+	// Fields without meta data aren't gathered, so a field that's missing on one side has every key added or removed
+	int32 OldIndex = 0;
+	int32 NewIndex = 0;
+	while (OldIndex < OldFields.Num() || NewIndex < NewFields.Num())
+	{
+		const int32 Comparison = (OldIndex >= OldFields.Num()) ? 1
+			: (NewIndex >= NewFields.Num()) ? -1
+			: CompareFields(OldFields[OldIndex], NewFields[NewIndex]);
+
+		if (Comparison < 0)
+		{
+			AddFieldDiff(OldFields[OldIndex], OldFields[OldIndex].MetaData, EmptyMetaData);
+			++OldIndex;
+		}
+		else if (Comparison > 0)
+		{
+			AddFieldDiff(NewFields[NewIndex], EmptyMetaData, NewFields[NewIndex].MetaData);
+			++NewIndex;
+		}
+		else
+		{
+			AddFieldDiff(NewFields[NewIndex], OldFields[OldIndex].MetaData, NewFields[NewIndex].MetaData);
+			++OldIndex;
+			++NewIndex;
+		}
+	}
+}
+
+void FMDMetaDataDiff::DiffMetaData(const TMap<FName, FString>& OldMetaData, const TMap<FName, FString>& NewMetaData, TArray<FMDMetaDataKeyDiff>& OutKeyDiffs)
+{
+	TArray<const TPair<FName, FString>*> OldPairs;
+	TArray<const TPair<FName, FString>*> NewPairs;
+	MDMDDF_Private::SortMetaData(OldMetaData, OldPairs);
+	MDMDDF_Private::SortMetaData(NewMetaData, NewPairs);
+
+	int32 OldIndex = 0;
+	int32 NewIndex = 0;
+	while (OldIndex < OldPairs.Num() || NewIndex < NewPairs.Num())
+	{
+		const TPair<FName, FString>* OldPair = OldPairs.IsValidIndex(OldIndex) ? OldPairs[OldIndex] : nullptr;
+		const TPair<FName, FString>* NewPair = NewPairs.IsValidIndex(NewIndex) ? NewPairs[NewIndex] : nullptr;
+
+		if (NewPair == nullptr || (OldPair != nullptr && OldPair->Key.LexicalLess(NewPair->Key)))
+		{
+			OutKeyDiffs.Add({ EMDMetaDataDiffType::Removed, OldPair->Key, OldPair->Value, FString() });
+			++OldIndex;
+		}
+		else if (OldPair == nullptr || NewPair->Key.LexicalLess(OldPair->Key))
+		{
+			OutKeyDiffs.Add({ EMDMetaDataDiffType::Added, NewPair->Key, FString(), NewPair->Value });
+			++NewIndex;
+		}
+		else
+		{
+			if (!OldPair->Value.Equals(NewPair->Value, ESearchCase::CaseSensitive))
+			{
+				OutKeyDiffs.Add({ EMDMetaDataDiffType::Changed, NewPair->Key, OldPair->Value, NewPair->Value });
+			}
+
+			++OldIndex;
+			++NewIndex;
+		}
+	}
+}
+
+FText FMDMetaDataDiff::DescribeField(const FMDMetaDataFieldDiff& FieldDiff)
+{
+	switch (FieldDiff.Usage)
+	{
+	case EMDMetaDataKeyUsage::Variables:
+		return FText::Format(INVTEXT("Variable {0}"), FText::FromName(FieldDiff.FieldName));
+	case EMDMetaDataKeyUsage::LocalVariables:
+		return FText::Format(INVTEXT("Local Variable {0}.{1}"), FText::FromName(FieldDiff.ScopeName), FText::FromName(FieldDiff.FieldName));
+	case EMDMetaDataKeyUsage::FunctionParameters:
+		return FText::Format(INVTEXT("Param {0}.{1}"), FText::FromName(FieldDiff.ScopeName), FText::FromName(FieldDiff.FieldName));
+	case EMDMetaDataKeyUsage::Functions:
+		return FText::Format(INVTEXT("Function {0}"), FText::FromName(FieldDiff.FieldName));
+	case EMDMetaDataKeyUsage::Structs:
+		return INVTEXT("Struct");
+	default:
+		return FText::Format(INVTEXT("Struct Member {0}"), FText::FromName(FieldDiff.FieldName));
+	}
+}
+
+FText FMDMetaDataDiff::DescribeKey(const FMDMetaDataKeyDiff& KeyDiff)
+{
+	switch (KeyDiff.Type)
+	{
+	case EMDMetaDataDiffType::Added:
+		return FText::Format(INVTEXT("Added {0}"), FText::FromString(FMDMetaDataEditorFieldView::FormatMetadata(KeyDiff.Key, KeyDiff.NewValue)));
+	case EMDMetaDataDiffType::Removed:
+		return FText::Format(INVTEXT("Removed {0}"), FText::FromString(FMDMetaDataEditorFieldView::FormatMetadata(KeyDiff.Key, KeyDiff.OldValue)));
+	default:
+		return FText::Format(INVTEXT("Changed {0} to {1}"),
+			FText::FromString(FMDMetaDataEditorFieldView::FormatMetadata(KeyDiff.Key, KeyDiff.OldValue)),
+			FText::FromString(FMDMetaDataEditorFieldView::FormatMetadata(KeyDiff.Key, KeyDiff.NewValue)));
+	}
+}
+
+void FMDMetaDataDiff::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(MDMDDF_Private::MenuOwner);
+
+	UToolMenu* Menu = UToolMenus::Get()->ExtendMenu(TEXT("ContentBrowser.AssetContextMenu"));
+	FToolMenuSection& Section = Menu->FindOrAddSection(TEXT("GetAssetActions"));
+	Section.AddDynamicEntry(TEXT("MDMetaDataDiff"), FNewToolMenuSectionDelegate::CreateLambda([](FToolMenuSection& InSection)
+	{
+		const UContentBrowserAssetContextMenuContext* Context = InSection.FindContext<UContentBrowserAssetContextMenuContext>();
+		if (Context == nullptr || Context->SelectedAssets.IsEmpty() || !Algo::AllOf(Context->SelectedAssets, &MDMDDF_Private::IsDiffableAsset))
+		{
+			return;
+		}
+
+		if (ISourceControlModule::Get().IsEnabled())
+		{
+			InSection.AddMenuEntry(
+				TEXT("MDDiffMetaDataAgainstRevisionControl"),
+				INVTEXT("Diff Meta Data Against Revision Control"),
+				INVTEXT("List the meta data that changed on each field since the latest revision of the selected assets"),
+				FSlateIcon(FAppStyle::GetAppStyleSetName(), TEXT("SourceControl.Actions.Diff")),
+				FUIAction(FExecuteAction::CreateStatic(&FMDMetaDataDiff::DiffAgainstRevisionControl, Context->SelectedAssets))
+			);
+		}
+
+		if (Context->SelectedAssets.Num() == 2 && Context->SelectedAssets[0].AssetClassPath == Context->SelectedAssets[1].AssetClassPath)
+		{
+			InSection.AddMenuEntry(
+				TEXT("MDDiffSelectedMetaData"),
+				INVTEXT("Diff Meta Data of Selected"),
+				INVTEXT("List the meta data that's different on each field of the two selected assets"),
+				FSlateIcon(FAppStyle::GetAppStyleSetName(), TEXT("SourceControl.Actions.Diff")),
+				FUIAction(FExecuteAction::CreateStatic(&FMDMetaDataDiff::DiffSelectedAssets, Context->SelectedAssets))
+			);
+		}
+	}));
+}
+
+void FMDMetaDataDiff::UnregisterMenus()
+{
+	if (UToolMenus* ToolMenus = UToolMenus::TryGet())
+	{
+		ToolMenus->UnregisterOwnerByName(MDMDDF_Private::MenuOwner);
+	}
+}
+
+int32 FMDMetaDataDiff::AddDiffMessages(FMessageLog& MessageLog, const FString& AssetPath, const UObject* OldAsset, const UObject* NewAsset)
+{
+	TArray<FMDMetaDataFieldDiff> FieldDiffs;
+	DiffAssets(OldAsset, NewAsset, FieldDiffs);
+
+	int32 NumChanges = 0;
+	for (const FMDMetaDataFieldDiff& FieldDiff : FieldDiffs)
+	{
+		const FText FieldText = DescribeField(FieldDiff);
+		for (const FMDMetaDataKeyDiff& KeyDiff : FieldDiff.Keys)
+		{
+			MessageLog.Info()
+				->AddToken(FAssetNameToken::Create(AssetPath))
+				->AddToken(FTextToken::Create(FText::Format(INVTEXT("{0}: {1}"), FieldText, DescribeKey(KeyDiff))));
+			++NumChanges;
+		}
+	}
+
+	return NumChanges;
+}
+
+void FMDMetaDataDiff::ShowResults(FMessageLog& MessageLog, int32 NumChanges)
+{
+	if (MessageLog.NumMessages(EMessageSeverity::Info) > 0)
+	{
+		constexpr bool bForce = true;
+		MessageLog.Open(EMessageSeverity::Info, bForce);
+	}
+
+	FNotificationInfo Info(NumChanges > 0
+		? FText::Format(INVTEXT("Found {0} meta data changes"), FText::AsNumber(NumChanges))
+		: INVTEXT("No meta data changes"));
+	Info.ExpireDuration = 5.f;
+	FSlateNotificationManager::Get().AddNotification(Info);
+}
+
+void FMDMetaDataDiff::DiffSelectedAssets(TArray<FAssetData> Assets)
+{
+	if (Assets.Num() != 2)
+	{
+		return;
+	}
+
+	const UObject* OldAsset = Assets[0].GetAsset();
+	const UObject* NewAsset = Assets[1].GetAsset();
+	if (!IsValid(OldAsset) || !IsValid(NewAsset))
+	{
+		return;
+	}
+
+	FMessageLog AssetCheck(TEXT("AssetCheck"));
+	AssetCheck.NewPage(FText::Format(INVTEXT("Meta Data Diff: {0} and {1}"), FText::FromName(Assets[0].AssetName), FText::FromName(Assets[1].AssetName)));
+
+	const int32 NumChanges = AddDiffMessages(AssetCheck, Assets[1].GetObjectPathString(), OldAsset, NewAsset);
+	ShowResults(AssetCheck, NumChanges);
+}
+
+void FMDMetaDataDiff::DiffAgainstRevisionControl(TArray<FAssetData> Assets)
+{
+	ISourceControlProvider& Provider = ISourceControlModule::Get().GetProvider();
+
+	FMessageLog AssetCheck(TEXT("AssetCheck"));
+	AssetCheck.NewPage(INVTEXT("Meta Data Diff"));
+
+	int32 NumChanges = 0;
+	for (const FAssetData& AssetData : Assets)
+	{
+		const UObject* Asset = AssetData.GetAsset();
+		if (!IsValid(Asset))
+		{
+			continue;
+		}
+
+		const FString PackageName = AssetData.PackageName.ToString();
+		const FString PackageFilename = SourceControlHelpers::PackageFilename(PackageName);
+
+		TSharedRef<FUpdateStatus, ESPMode::ThreadSafe> UpdateStatus = ISourceControlOperation::Create<FUpdateStatus>();
+		UpdateStatus->SetUpdateHistory(true);
+		Provider.Execute(UpdateStatus, PackageFilename);
+
+		const FSourceControlStatePtr State = Provider.GetState(PackageFilename, EStateCacheUsage::Use);
+		if (!State.IsValid() || !State->IsSourceControlled() || State->GetHistorySize() == 0)
+		{
+			AssetCheck.Warning()
+				->AddToken(FAssetNameToken::Create(AssetData.GetObjectPathString()))
+				->AddToken(FTextToken::Create(INVTEXT("Has no revision history to compare against")));
+			continue;
+		}
+
+		// Compare against the latest revision, the same one the editor's Diff Against Depot uses
+		const TSharedPtr<ISourceControlRevision, ESPMode::ThreadSafe> Revision = State->GetHistoryItem(0);
+		FString TempFileName;
+		UPackage* TempPackage = (Revision.IsValid() && Revision->Get(TempFileName))
+			? DiffUtils::LoadPackageForDiff(FPackagePath::FromLocalPath(TempFileName), FPackagePath::FromPackageNameChecked(PackageName))
+			: nullptr;
+		const UObject* OldAsset = (TempPackage != nullptr) ? FindObject<UObject>(TempPackage, *AssetData.AssetName.ToString()) : nullptr;
+		if (OldAsset == nullptr)
+		{
+			AssetCheck.Warning()
+				->AddToken(FAssetNameToken::Create(AssetData.GetObjectPathString()))
+				->AddToken(FTextToken::Create(INVTEXT("Couldn't load the latest revision")));
+			continue;
+		}
+
+		NumChanges += AddDiffMessages(AssetCheck, AssetData.GetObjectPathString(), OldAsset, Asset);
+	}
+
+	ShowResults(AssetCheck, NumChanges);
+}
@@ -0,0 +1,61 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
+
+class FMessageLog;
+
+enum class EMDMetaDataDiffType : uint8
+{
+	Added,
+	Removed,
+	Changed
+};
+
+struct FMDMetaDataKeyDiff
+{
+	EMDMetaDataDiffType Type = EMDMetaDataDiffType::Changed;
+	FName Key = NAME_None;
+	FString OldValue;
+	FString NewValue;
+};
+
+// The changed keys of a single field, fields are identified the same way as in FMDMetaDataFieldSummary
+struct FMDMetaDataFieldDiff
+{
+	EMDMetaDataKeyUsage Usage = EMDMetaDataKeyUsage::None;
+	FName ScopeName = NAME_None;
+	FName FieldName = NAME_None;
+
+	TArray<FMDMetaDataKeyDiff> Keys;
+};
+
+/**
+ * Compares the meta data of two versions of a Blueprint or User Defined Struct.
+ * Fields and keys are sorted once and merged in a single pass, so large assets don't pay for a lookup per key.
+ */
+class FMDMetaDataDiff
+{
+public:
+	// Must be called on the game thread
+	static void DiffAssets(const UObject* OldAsset, const UObject* NewAsset, TArray<FMDMetaDataFieldDiff>& OutFieldDiffs);
+
+	// Appends the differences in key order
+	static void DiffMetaData(const TMap<FName, FString>& OldMetaData, const TMap<FName, FString>& NewMetaData, TArray<FMDMetaDataKeyDiff>& OutKeyDiffs);
+
+	static FText DescribeField(const FMDMetaDataFieldDiff& FieldDiff);
+	static FText DescribeKey(const FMDMetaDataKeyDiff& KeyDiff);
+
+	static void RegisterMenus();
+	static void UnregisterMenus();
+
+private:
+	// Adds a message per changed key, returns the number of changed keys
+	static int32 AddDiffMessages(FMessageLog& MessageLog, const FString& AssetPath, const UObject* OldAsset, const UObject* NewAsset);
+	static void ShowResults(FMessageLog& MessageLog, int32 NumChanges);
+
+	static void DiffSelectedAssets(TArray<FAssetData> Assets);
+	static void DiffAgainstRevisionControl(TArray<FAssetData> Assets);
+};
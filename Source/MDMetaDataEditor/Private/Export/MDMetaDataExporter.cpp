@@ -0,0 +1,402 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataExporter.h"
+
+#include "Algo/Transform.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Async/ParallelFor.h"
+#include "ContentBrowserMenuContexts.h"
+#include "Customizations/MDMetaDataEditorFieldView.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformApplicationMisc.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_FunctionEntry.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Misc/StringBuilder.h"
+#include "Styling/AppStyle.h"
+#include "ToolMenus.h"
+#include "UObject/MetaData.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
+#include "StructUtils/UserDefinedStruct.h"
+#endif
+
+namespace MDMDEX_Private
+{
+	// Assets are loaded and formatted in batches, the ones a batch loaded are collected before the next so a whole project is never in memory at once
+	constexpr int32 BatchSize = 64;
+
+	const FName MenuOwner = TEXT("MDMetaDataExporter");
+
+	const TMap<FName, FString>* GetStructMetaData(const UUserDefinedStruct* Struct)
+	{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6) // On or after UE 5.6
+		return FMetaData::GetMapForObject(Struct);
+#else // Pre UE 5.6
+		return UMetaData::GetMapForObject(Struct);
+#endif
+	}
+
+	FName GetFunctionName(const UK2Node_FunctionEntry* EntryNode)
+	{
+		return (EntryNode->CustomGeneratedFunctionName != NAME_None) ? EntryNode->CustomGeneratedFunctionName : EntryNode->GetGraph()->GetFName();
+	}
+}
+
+void FMDMetaDataExporter::GatherAssets(const TArray<FString>& PackagePaths, TArray<FAssetData>& OutAssets)
+{
+	FARFilter Filter;
+	Filter.bRecursivePaths = true;
+	Filter.bRecursiveClasses = true;
+	Algo::Transform(PackagePaths, Filter.PackagePaths, [](const FString& Path) { return FName(*Path); });
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UUserDefinedStruct::StaticClass()->GetClassPathName());
+
+	const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	AssetRegistry.GetAssets(Filter, OutAssets);
+
+	OutAssets.Sort([](const FAssetData& A, const FAssetData& B)
+	{
+		return A.PackageName.LexicalLess(B.PackageName);
+	});
+}
+
+bool FMDMetaDataExporter::ExportToFile(const TArray<FAssetData>& Assets, const FString& FilePath)
+{
+	const TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*FilePath));
+	if (!Writer.IsValid())
+	{
+		return false;
+	}
+
+	ExportAssets(Assets, [&Writer](FStringView Text)
+	{
+		const FTCHARToUTF8 Utf8(Text.GetData(), Text.Len());
+		Writer->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+	});
+
+	return Writer->Close();
+}
+
+void FMDMetaDataExporter::ExportToClipboard(const TArray<FAssetData>& Assets)
+{
+	FString Export;
+	ExportAssets(Assets, [&Export](FStringView Text)
+	{
+		Export.Append(Text.GetData(), Text.Len());
+	});
+
+	FPlatformApplicationMisc::ClipboardCopy(*Export);
+}
+
+FString FMDMetaDataExporter::FormatSpecifier(const TMap<FName, FString>& MetaData)
+{
+	TArray<FName> Keys;
+	MetaData.GenerateKeyArray(Keys);
+	Keys.Sort(FNameLexicalLess());
+
+	TStringBuilder<256> Builder;
+	Builder << TEXT("meta=(");
+	for (int32 i = 0; i < Keys.Num(); ++i)
+	{
+		if (i > 0)
+		{
+			Builder << TEXT(", ");
+		}
+
+		Builder << FMDMetaDataEditorFieldView::FormatMetadata(Keys[i], MetaData.FindChecked(Keys[i]));
+	}
+	Builder << TEXT(")");
+
+	return FString(Builder.ToView());
+}
+
+void FMDMetaDataExporter::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(MDMDEX_Private::MenuOwner);
+
+	UToolMenu* Menu = UToolMenus::Get()->ExtendMenu(TEXT("ContentBrowser.FolderContextMenu"));
+	FToolMenuSection& Section = Menu->FindOrAddSection(TEXT("PathContextBulkOperations"));
+	Section.AddDynamicEntry(TEXT("MDMetaDataExport"), FNewToolMenuSectionDelegate::CreateLambda([](FToolMenuSection& InSection)
+	{
+		const UContentBrowserFolderContext* Context = InSection.FindContext<UContentBrowserFolderContext>();
+		if (Context == nullptr || Context->GetSelectedPackagePaths().Num() == 0)
+		{
+			return;
+		}
+
+		const TArray<FString> PackagePaths = Context->GetSelectedPackagePaths();
+
+		InSection.AddMenuEntry(
+			TEXT("MDCopyMetaDataAsCpp"),
+			INVTEXT("Copy Meta Data as C++"),
+			INVTEXT("Copy the meta data of every Blueprint and User Defined Struct in the selected folders as C++ specifiers"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), TEXT("GenericCommands.Copy")),
+			FUIAction(FExecuteAction::CreateStatic(&FMDMetaDataExporter::ExportFolders, PackagePaths, true))
+		);
+
+		InSection.AddMenuEntry(
+			TEXT("MDExportMetaDataAsCpp"),
+			INVTEXT("Export Meta Data as C++"),
+			INVTEXT("Write the meta data of every Blueprint and User Defined Struct in the selected folders as C++ specifiers to a file in the project's Saved folder"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), TEXT("Icons.Save")),
+			FUIAction(FExecuteAction::CreateStatic(&FMDMetaDataExporter::ExportFolders, PackagePaths, false))
+		);
+	}));
+}
+
+void FMDMetaDataExporter::UnregisterMenus()
+{
+	if (UToolMenus* ToolMenus = UToolMenus::TryGet())
+	{
+		ToolMenus->UnregisterOwnerByName(MDMDEX_Private::MenuOwner);
+	}
+}
+
+void FMDMetaDataExporter::ExportAssets(const TArray<FAssetData>& Assets, TFunctionRef<void(FStringView)> Output)
+{
+	FScopedSlowTask SlowTask(Assets.Num(), INVTEXT("Exporting Meta Data..."));
+	SlowTask.MakeDialogDelayed(0.5f);
+
+	for (int32 BatchStart = 0; BatchStart < Assets.Num(); BatchStart += MDMDEX_Private::BatchSize)
+	{
+		const int32 BatchNum = FMath::Min(MDMDEX_Private::BatchSize, Assets.Num() - BatchStart);
+		SlowTask.EnterProgressFrame(BatchNum);
+
+		// Loading and walking the fields has to happen on the game thread
+		TArray<FExportAsset> BatchAssets;
+		BatchAssets.SetNum(BatchNum);
+		bool bDidLoadAssets = false;
+		for (int32 i = 0; i < BatchNum; ++i)
+		{
+			const FAssetData& AssetData = Assets[BatchStart + i];
+			FExportAsset& ExportAsset = BatchAssets[i];
+			ExportAsset.Header = FString::Printf(TEXT("// %s (%s)\n"), *AssetData.AssetName.ToString(), *AssetData.GetObjectPathString());
+			bDidLoadAssets |= !AssetData.IsAssetLoaded();
+
+			UObject* Asset = AssetData.GetAsset();
+			if (const UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+			{
+				GatherBlueprintFields(Blueprint, ExportAsset);
+			}
+			else if (const UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Asset))
+			{
+				GatherStructFields(Struct, ExportAsset);
+			}
+		}
+
+		// The game thread is blocked until the formatting finishes, so the meta data can't change or be collected underneath it
+		TArray<FString> Texts;
+		Texts.SetNum(BatchNum);
+		ParallelFor(BatchNum, [&BatchAssets, &Texts](int32 Index)
+		{
+			Texts[Index] = FormatAsset(BatchAssets[Index]);
+		});
+
+		for (const FString& Text : Texts)
+		{
+			if (!Text.IsEmpty())
+			{
+				Output(Text);
+			}
+		}
+
+		// The batch only points at meta data, once it's written out nothing keeps the assets it loaded
+		BatchAssets.Empty();
+		if (bDidLoadAssets)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+}
+
+void FMDMetaDataExporter::GatherBlueprintFields(const UBlueprint* Blueprint, FExportAsset& OutAsset)
+{
+	const UClass* SkeletonClass = Blueprint->SkeletonGeneratedClass;
+	const UClass* GeneratedClass = Blueprint->GeneratedClass;
+	if (SkeletonClass == nullptr)
+	{
+		return;
+	}
+
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		if (const FProperty* Property = FindFProperty<FProperty>(SkeletonClass, Variable.VarName))
+		{
+			FExportField& Field = OutAsset.Fields.AddDefaulted_GetRef();
+			Field.Label = FString::Printf(TEXT("Variable %s"), *Variable.VarName.ToString());
+			Field.Macro = TEXT("UPROPERTY");
+			Field.Declaration = FString::Printf(TEXT("%s %s;"), *Property->GetCPPType(), *Property->GetName());
+			Field.MetaData = Property->GetMetaDataMap();
+		}
+	}
+
+	for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		TArray<UK2Node_FunctionEntry*> EntryNodes;
+		Graph->GetNodesOfClass(EntryNodes);
+		if (EntryNodes.Num() == 0 || !EntryNodes[0]->bIsEditable)
+		{
+			continue;
+		}
+
+		const UK2Node_FunctionEntry* EntryNode = EntryNodes[0];
+		const FName FunctionName = MDMDEX_Private::GetFunctionName(EntryNode);
+
+		FExportField& FunctionField = OutAsset.Fields.AddDefaulted_GetRef();
+		FunctionField.Label = FString::Printf(TEXT("Function %s"), *FunctionName.ToString());
+		FunctionField.Macro = TEXT("UFUNCTION");
+		FunctionField.MetaData = &EntryNode->MetaData.GetMetaDataMap();
+
+		// Params come from the generated class, which is where UMDMetaDataEditorBlueprintCompilerExtension keeps their meta data
+		if (const UFunction* Function = (GeneratedClass != nullptr) ? GeneratedClass->FindFunctionByName(FunctionName) : nullptr)
+		{
+			for (TFieldIterator<FProperty> PropIt(Function); PropIt && PropIt->HasAnyPropertyFlags(CPF_Parm); ++PropIt)
+			{
+				FExportField& ParamField = OutAsset.Fields.AddDefaulted_GetRef();
+				ParamField.Label = FString::Printf(TEXT("Param %s::%s"), *FunctionName.ToString(), *PropIt->GetName());
+				ParamField.Macro = TEXT("UPARAM");
+				ParamField.Declaration = FString::Printf(TEXT("%s %s"), *PropIt->GetCPPType(), *PropIt->GetName());
+				ParamField.MetaData = PropIt->GetMetaDataMap();
+			}
+		}
+
+		if (const UFunction* SkeletonFunction = SkeletonClass->FindFunctionByName(FunctionName))
+		{
+			for (const FBPVariableDescription& LocalVariable : EntryNode->LocalVariables)
+			{
+				if (const FProperty* Property = FindFProperty<FProperty>(SkeletonFunction, LocalVariable.VarName))
+				{
+					FExportField& LocalField = OutAsset.Fields.AddDefaulted_GetRef();
+					LocalField.Label = FString::Printf(TEXT("Local Variable %s::%s"), *FunctionName.ToString(), *LocalVariable.VarName.ToString());
+					LocalField.MetaData = Property->GetMetaDataMap();
+				}
+			}
+		}
+	}
+
+	TArray<UK2Node_CustomEvent*> EventNodes;
+	FBlueprintEditorUtils::GetAllNodesOfClass(Blueprint, EventNodes);
+	for (UK2Node_CustomEvent* EventNode : EventNodes)
+	{
+		FExportField& EventField = OutAsset.Fields.AddDefaulted_GetRef();
+		EventField.Label = FString::Printf(TEXT("Custom Event %s"), *EventNode->CustomFunctionName.ToString());
+		EventField.Macro = TEXT("UFUNCTION");
+		EventField.MetaData = &EventNode->GetUserDefinedMetaData().GetMetaDataMap();
+
+		if (const UFunction* Function = (GeneratedClass != nullptr) ? GeneratedClass->FindFunctionByName(EventNode->CustomFunctionName) : nullptr)
+		{
+			for (TFieldIterator<FProperty> PropIt(Function); PropIt && PropIt->HasAnyPropertyFlags(CPF_Parm); ++PropIt)
+			{
+				FExportField& ParamField = OutAsset.Fields.AddDefaulted_GetRef();
+				ParamField.Label = FString::Printf(TEXT("Param %s::%s"), *EventNode->CustomFunctionName.ToString(), *PropIt->GetName());
+				ParamField.Macro = TEXT("UPARAM");
+				ParamField.Declaration = FString::Printf(TEXT("%s %s"), *PropIt->GetCPPType(), *PropIt->GetName());
+				ParamField.MetaData = PropIt->GetMetaDataMap();
+			}
+		}
+	}
+}
+
+void FMDMetaDataExporter::GatherStructFields(const UUserDefinedStruct* Struct, FExportAsset& OutAsset)
+{
+	FExportField& StructField = OutAsset.Fields.AddDefaulted_GetRef();
+	StructField.Label = FString::Printf(TEXT("Struct %s"), *Struct->GetName());
+	StructField.Macro = TEXT("USTRUCT");
+	StructField.MetaData = MDMDEX_Private::GetStructMetaData(Struct);
+
+	for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+	{
+		// User Defined Struct property names are mangled, export the name the user sees
+		const FString MemberName = PropIt->GetAuthoredName();
+
+		FExportField& MemberField = OutAsset.Fields.AddDefaulted_GetRef();
+		MemberField.Label = FString::Printf(TEXT("Member %s"), *MemberName);
+		MemberField.Macro = TEXT("UPROPERTY");
+		MemberField.Declaration = FString::Printf(TEXT("%s %s;"), *PropIt->GetCPPType(), *MemberName);
+		MemberField.MetaData = PropIt->GetMetaDataMap();
+	}
+}
+
+FString FMDMetaDataExporter::FormatAsset(const FExportAsset& Asset)
+{
+	TStringBuilder<4096> Builder;
+
+	for (const FExportField& Field : Asset.Fields)
+	{
+		if (Field.MetaData == nullptr || Field.MetaData->Num() == 0)
+		{
+			continue;
+		}
+
+		if (Builder.Len() == 0)
+		{
+			Builder << Asset.Header;
+		}
+
+		Builder << TEXT("\n// ") << Field.Label << TEXT("\n");
+
+		if (Field.Macro != nullptr)
+		{
+			Builder << Field.Macro << TEXT("(") << FormatSpecifier(*Field.MetaData) << TEXT(")\n");
+		}
+		else
+		{
+			// No C++ equivalent, but keep the specifier text so it can still be copied
+			Builder << TEXT("// ") << FormatSpecifier(*Field.MetaData) << TEXT("\n");
+		}
+
+		if (!Field.Declaration.IsEmpty())
+		{
+			Builder << Field.Declaration << TEXT("\n");
+		}
+	}
+
+	if (Builder.Len() > 0)
+	{
+		Builder << TEXT("\n");
+	}
+
+	return FString(Builder.ToView());
+}
+
+void FMDMetaDataExporter::ExportFolders(TArray<FString> PackagePaths, bool bToClipboard)
+{
+	TArray<FAssetData> Assets;
+	GatherAssets(PackagePaths, Assets);
+
+	FText Message;
+	SNotificationItem::ECompletionState CompletionState = SNotificationItem::CS_Success;
+	if (bToClipboard)
+	{
+		ExportToClipboard(Assets);
+		Message = FText::Format(INVTEXT("Copied the meta data of {0} assets"), FText::AsNumber(Assets.Num()));
+	}
+	else
+	{
+		const FString FilePath = FPaths::ConvertRelativePathToFull(FPaths::ProjectSavedDir() / TEXT("MDMetaDataEditor") / TEXT("MetaDataExport.h"));
+		if (ExportToFile(Assets, FilePath))
+		{
+			Message = FText::Format(INVTEXT("Exported the meta data of {0} assets to {1}"), FText::AsNumber(Assets.Num()), FText::FromString(FilePath));
+		}
+		else
+		{
+			Message = FText::Format(INVTEXT("Failed to write {0}"), FText::FromString(FilePath));
+			CompletionState = SNotificationItem::CS_Fail;
+		}
+	}
+
+	FNotificationInfo Info(Message);
+	Info.ExpireDuration = 5.f;
+	if (TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info))
+	{
+		Notification->SetCompletionState(CompletionState);
+	}
+}
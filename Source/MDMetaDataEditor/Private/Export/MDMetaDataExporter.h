@@ -0,0 +1,60 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+#include "Containers/StringView.h"
+#include "Templates/Function.h"
+
+class UBlueprint;
+class UUserDefinedStruct;
+
+/**
+ * Exports the meta data of Blueprints and User Defined Structs as C++ UPROPERTY/UFUNCTION/UPARAM/USTRUCT specifiers,
+ * using the same Key="Value" format as copying a single meta data row
+ */
+class FMDMetaDataExporter
+{
+public:
+	// Finds every Blueprint and User Defined Struct under the package paths, including sub-folders
+	static void GatherAssets(const TArray<FString>& PackagePaths, TArray<FAssetData>& OutAssets);
+
+	// Writes each batch of assets to the file as soon as it's formatted
+	static bool ExportToFile(const TArray<FAssetData>& Assets, const FString& FilePath);
+	// The clipboard takes the whole text at once, so it's built up in memory
+	static void ExportToClipboard(const TArray<FAssetData>& Assets);
+
+	// Formats the whole map as `meta=(KeyA="A", KeyB="B")`, with keys sorted so exports are stable
+	static FString FormatSpecifier(const TMap<FName, FString>& MetaData);
+
+	static void RegisterMenus();
+	static void UnregisterMenus();
+
+private:
+	struct FExportField
+	{
+		// Describes the field, written as a comment above the specifier
+		FString Label;
+		// The specifier macro, empty if the field has no C++ equivalent (like local variables)
+		const TCHAR* Macro = nullptr;
+		// The C++ declaration written after the specifier
+		FString Declaration;
+		const TMap<FName, FString>* MetaData = nullptr;
+	};
+
+	struct FExportAsset
+	{
+		FString Header;
+		TArray<FExportField> Fields;
+	};
+
+	static void ExportAssets(const TArray<FAssetData>& Assets, TFunctionRef<void(FStringView)> Output);
+
+	// Must be called on the game thread, only gathers pointers to the meta data so formatting can run in parallel
+	static void GatherBlueprintFields(const UBlueprint* Blueprint, FExportAsset& OutAsset);
+	static void GatherStructFields(const UUserDefinedStruct* Struct, FExportAsset& OutAsset);
+
+	static FString FormatAsset(const FExportAsset& Asset);
+
+	static void ExportFolders(TArray<FString> PackagePaths, bool bToClipboard);
+};
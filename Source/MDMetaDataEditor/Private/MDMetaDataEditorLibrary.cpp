@@ -0,0 +1,458 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEditorLibrary.h"
+
+#include "Config/MDMetaDataEditorConfig.h"
+#include "Customizations/MDMetaDataEditorFieldView.h"
+#include "Diff/MDMetaDataDiff.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Export/MDMetaDataExporter.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_FunctionResult.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "ScopedTransaction.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
+#include "StructUtils/UserDefinedStruct.h"
+#endif
+
+int32 FMDMetaDataEditorBatchScope::Depth = 0;
+bool FMDMetaDataEditorBatchScope::bCompileBlueprints = false;
+TArray<TWeakObjectPtr<UBlueprint>> FMDMetaDataEditorBatchScope::ModifiedBlueprints;
+
+namespace MDMDEL_Private
+{
+	UK2Node_FunctionEntry* FindFunctionEntry(UBlueprint* Blueprint, FName FunctionName)
+	{
+		for (UEdGraph* Graph : Blueprint->FunctionGraphs)
+		{
+			TArray<UK2Node_FunctionEntry*> EntryNodes;
+			Graph->GetNodesOfClass(EntryNodes);
+			for (UK2Node_FunctionEntry* EntryNode : EntryNodes)
+			{
+				const FName EntryName = (EntryNode->CustomGeneratedFunctionName != NAME_None) ? EntryNode->CustomGeneratedFunctionName : Graph->GetFName();
+				if (EntryName == FunctionName)
+				{
+					return EntryNode;
+				}
+			}
+		}
+
+		return nullptr;
+	}
+
+	UK2Node_CustomEvent* FindCustomEvent(UBlueprint* Blueprint, FName EventName)
+	{
+		TArray<UK2Node_CustomEvent*> EventNodes;
+		FBlueprintEditorUtils::GetAllNodesOfClass(Blueprint, EventNodes);
+		for (UK2Node_CustomEvent* EventNode : EventNodes)
+		{
+			if (EventNode->CustomFunctionName == EventName)
+			{
+				return EventNode;
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool HasUserPin(const UK2Node_EditablePinBase* Node, FName PinName)
+	{
+		return Node->UserDefinedPins.ContainsByPredicate([PinName](const TSharedPtr<FUserPinInfo>& PinInfo)
+		{
+			return PinInfo.IsValid() && PinInfo->PinName == PinName;
+		});
+	}
+
+	// Finds the entry, result or custom event node that declares the param
+	UK2Node_EditablePinBase* FindParamNode(UBlueprint* Blueprint, FName FunctionName, FName ParamName)
+	{
+		if (UK2Node_FunctionEntry* EntryNode = FindFunctionEntry(Blueprint, FunctionName))
+		{
+			if (HasUserPin(EntryNode, ParamName))
+			{
+				return EntryNode;
+			}
+
+			TArray<UK2Node_FunctionResult*> ResultNodes;
+			EntryNode->GetGraph()->GetNodesOfClass(ResultNodes);
+			for (UK2Node_FunctionResult* ResultNode : ResultNodes)
+			{
+				if (HasUserPin(ResultNode, ParamName))
+				{
+					return ResultNode;
+				}
+			}
+
+			return nullptr;
+		}
+
+		return FindCustomEvent(Blueprint, FunctionName);
+	}
+
+	FProperty* FindStructMember(const UUserDefinedStruct* Struct, FName MemberName)
+	{
+		// User Defined Struct property names are mangled, so match against the name shown to the user too
+		const FString MemberString = MemberName.ToString();
+		for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+		{
+			if (PropIt->GetFName() == MemberName || PropIt->GetAuthoredName() == MemberString)
+			{
+				return *PropIt;
+			}
+		}
+
+		return nullptr;
+	}
+}
+
+FMDMetaDataEditorBatchScope::FMDMetaDataEditorBatchScope(const FText& Description, bool bCompileModifiedBlueprints)
+{
+	if (Depth++ == 0)
+	{
+		Transaction = MakeUnique<FScopedTransaction>(Description);
+		bCompileBlueprints = bCompileModifiedBlueprints;
+	}
+	else
+	{
+		bCompileBlueprints |= bCompileModifiedBlueprints;
+	}
+}
+
+FMDMetaDataEditorBatchScope::~FMDMetaDataEditorBatchScope()
+{
+	if (--Depth > 0)
+	{
+		return;
+	}
+
+	TArray<TWeakObjectPtr<UBlueprint>> Blueprints = MoveTemp(ModifiedBlueprints);
+	for (const TWeakObjectPtr<UBlueprint>& WeakBlueprint : Blueprints)
+	{
+		if (UBlueprint* Blueprint = WeakBlueprint.Get())
+		{
+			FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+
+			if (bCompileBlueprints)
+			{
+				FKismetEditorUtilities::CompileBlueprint(Blueprint);
+			}
+		}
+	}
+
+	bCompileBlueprints = false;
+	Transaction.Reset();
+}
+
+void FMDMetaDataEditorBatchScope::AddModifiedBlueprint(UBlueprint* Blueprint)
+{
+	if (ensure(IsActive()) && IsValid(Blueprint))
+	{
+		ModifiedBlueprints.AddUnique(Blueprint);
+	}
+}
+
+void UMDMetaDataEditorLibrary::GetMetaDataFields(UObject* Asset, TArray<FMDMetaDataFieldReference>& OutFields)
+{
+	OutFields.Reset();
+
+	auto AddField = [Asset, &OutFields](EMDMetaDataFieldType FieldType, FName FunctionName, FName FieldName)
+	{
+		FMDMetaDataFieldReference& Field = OutFields.AddDefaulted_GetRef();
+		Field.Asset = Asset;
+		Field.FieldType = FieldType;
+		Field.FunctionName = FunctionName;
+		Field.FieldName = FieldName;
+	};
+
+	if (const UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Asset))
+	{
+		AddField(EMDMetaDataFieldType::Struct, NAME_None, NAME_None);
+		for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+		{
+			AddField(EMDMetaDataFieldType::StructMember, NAME_None, PropIt->GetFName());
+		}
+		return;
+	}
+
+	const UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
+	if (!IsValid(Blueprint) || Blueprint->SkeletonGeneratedClass == nullptr)
+	{
+		return;
+	}
+
+	auto AddParams = [Blueprint, &AddField](FName FunctionName)
+	{
+		const UFunction* Function = (Blueprint->GeneratedClass != nullptr) ? Blueprint->GeneratedClass->FindFunctionByName(FunctionName) : nullptr;
+		if (Function != nullptr)
+		{
+			for (TFieldIterator<FProperty> PropIt(Function); PropIt && PropIt->HasAnyPropertyFlags(CPF_Parm); ++PropIt)
+			{
+				AddField(EMDMetaDataFieldType::FunctionParameter, FunctionName, PropIt->GetFName());
+			}
+		}
+	};
+
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		AddField(EMDMetaDataFieldType::Variable, NAME_None, Variable.VarName);
+	}
+
+	for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		TArray<UK2Node_FunctionEntry*> EntryNodes;
+		Graph->GetNodesOfClass(EntryNodes);
+		if (EntryNodes.Num() == 0)
+		{
+			continue;
+		}
+
+		const UK2Node_FunctionEntry* EntryNode = EntryNodes[0];
+		const FName FunctionName = (EntryNode->CustomGeneratedFunctionName != NAME_None) ? EntryNode->CustomGeneratedFunctionName : Graph->GetFName();
+		AddField(EMDMetaDataFieldType::Function, NAME_None, FunctionName);
+		AddParams(FunctionName);
+
+		for (const FBPVariableDescription& LocalVariable : EntryNode->LocalVariables)
+		{
+			AddField(EMDMetaDataFieldType::LocalVariable, FunctionName, LocalVariable.VarName);
+		}
+	}
+
+	TArray<UK2Node_CustomEvent*> EventNodes;
+	FBlueprintEditorUtils::GetAllNodesOfClass(Blueprint, EventNodes);
+	for (const UK2Node_CustomEvent* EventNode : EventNodes)
+	{
+		AddField(EMDMetaDataFieldType::CustomEvent, NAME_None, EventNode->CustomFunctionName);
+		AddParams(EventNode->CustomFunctionName);
+	}
+}
+
+bool UMDMetaDataEditorLibrary::GetMetaData(const FMDMetaDataFieldReference& Field, FName Key, FString& OutValue)
+{
+	const TSharedPtr<FMDMetaDataEditorFieldView> FieldView = MakeFieldView(Field);
+	const TOptional<FString> Value = FieldView.IsValid() ? FieldView->GetMetadataValue(Key) : TOptional<FString>();
+	if (!Value.IsSet())
+	{
+		return false;
+	}
+
+	OutValue = Value.GetValue();
+	return true;
+}
+
+bool UMDMetaDataEditorLibrary::GetAllMetaData(const FMDMetaDataFieldReference& Field, TMap<FName, FString>& OutMetaData)
+{
+	const TSharedPtr<FMDMetaDataEditorFieldView> FieldView = MakeFieldView(Field);
+	const TMap<FName, FString>* MetaDataMap = FieldView.IsValid() ? FieldView->GetMetadataMap() : nullptr;
+	if (MetaDataMap == nullptr)
+	{
+		OutMetaData.Reset();
+		return false;
+	}
+
+	OutMetaData = *MetaDataMap;
+	return true;
+}
+
+bool UMDMetaDataEditorLibrary::SetMetaData(const FMDMetaDataFieldReference& Field, FName Key, const FString& Value)
+{
+	FMDMetaDataOperation Operation;
+	Operation.Field = Field;
+	Operation.Operation = EMDMetaDataOperationType::Set;
+	Operation.Key = Key;
+	Operation.Value = Value;
+	return ApplyOperation(Operation);
+}
+
+bool UMDMetaDataEditorLibrary::RemoveMetaData(const FMDMetaDataFieldReference& Field, FName Key)
+{
+	FMDMetaDataOperation Operation;
+	Operation.Field = Field;
+	Operation.Operation = EMDMetaDataOperationType::Remove;
+	Operation.Key = Key;
+	return ApplyOperation(Operation);
+}
+
+bool UMDMetaDataEditorLibrary::RenameMetaData(const FMDMetaDataFieldReference& Field, FName OldKey, FName NewKey)
+{
+	FMDMetaDataOperation Operation;
+	Operation.Field = Field;
+	Operation.Operation = EMDMetaDataOperationType::Rename;
+	Operation.Key = OldKey;
+	Operation.NewKey = NewKey;
+	return ApplyOperation(Operation);
+}
+
+int32 UMDMetaDataEditorLibrary::ApplyMetaDataOperations(const TArray<FMDMetaDataOperation>& Operations, bool bCompileModifiedBlueprints)
+{
+	FMDMetaDataEditorBatchScope BatchScope(FText::Format(INVTEXT("Edit Meta Data [{0} Operations]"), FText::AsNumber(Operations.Num())), bCompileModifiedBlueprints);
+
+	int32 NumApplied = 0;
+	for (const FMDMetaDataOperation& Operation : Operations)
+	{
+		if (ApplyOperation(Operation))
+		{
+			++NumApplied;
+		}
+	}
+
+	return NumApplied;
+}
+
+int32 UMDMetaDataEditorLibrary::ApplyMetaDataPreset(const TArray<FMDMetaDataFieldReference>& Fields, FName PresetName)
+{
+	const FMDMetaDataPreset* Preset = GetDefault<UMDMetaDataEditorConfig>()->FindMetaDataPreset(PresetName);
+	if (Preset == nullptr)
+	{
+		return 0;
+	}
+
+	TArray<TSharedPtr<FMDMetaDataEditorFieldView>> FieldViews;
+	FieldViews.Reserve(Fields.Num());
+	for (const FMDMetaDataFieldReference& Field : Fields)
+	{
+		FieldViews.Add(MakeFieldView(Field));
+	}
+
+	return FMDMetaDataEditorFieldView::ApplyPresetToFields(*Preset, FieldViews);
+}
+
+bool UMDMetaDataEditorLibrary::ExportMetaDataAsCpp(const TArray<FString>& PackagePaths, const FString& FilePath)
+{
+	TArray<FAssetData> Assets;
+	FMDMetaDataExporter::GatherAssets(PackagePaths, Assets);
+	return FMDMetaDataExporter::ExportToFile(Assets, FilePath);
+}
+
+void UMDMetaDataEditorLibrary::DiffMetaData(UObject* OldAsset, UObject* NewAsset, TArray<FString>& OutChanges)
+{
+	OutChanges.Reset();
+
+	TArray<FMDMetaDataFieldDiff> FieldDiffs;
+	FMDMetaDataDiff::DiffAssets(OldAsset, NewAsset, FieldDiffs);
+	for (const FMDMetaDataFieldDiff& FieldDiff : FieldDiffs)
+	{
+		const FString FieldString = FMDMetaDataDiff::DescribeField(FieldDiff).ToString();
+		for (const FMDMetaDataKeyDiff& KeyDiff : FieldDiff.Keys)
+		{
+			OutChanges.Add(FString::Printf(TEXT("%s: %s"), *FieldString, *FMDMetaDataDiff::DescribeKey(KeyDiff).ToString()));
+		}
+	}
+}
+
+TSharedPtr<FMDMetaDataEditorFieldView> UMDMetaDataEditorLibrary::MakeFieldView(const FMDMetaDataFieldReference& Field)
+{
+	if (UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Field.Asset))
+	{
+		if (Field.FieldType == EMDMetaDataFieldType::Struct)
+		{
+			return MakeShared<FMDMetaDataEditorFieldView>(Struct);
+		}
+
+		if (Field.FieldType == EMDMetaDataFieldType::StructMember)
+		{
+			if (FProperty* Property = MDMDEL_Private::FindStructMember(Struct, Field.FieldName))
+			{
+				return MakeShared<FMDMetaDataEditorFieldView>(Property, Struct);
+			}
+		}
+
+		return nullptr;
+	}
+
+	UBlueprint* Blueprint = Cast<UBlueprint>(Field.Asset);
+	if (!IsValid(Blueprint) || Blueprint->SkeletonGeneratedClass == nullptr)
+	{
+		return nullptr;
+	}
+
+	switch (Field.FieldType)
+	{
+	case EMDMetaDataFieldType::Variable:
+		if (FProperty* Property = FindFProperty<FProperty>(Blueprint->SkeletonGeneratedClass, Field.FieldName))
+		{
+			return MakeShared<FMDMetaDataEditorFieldView>(Property, Blueprint);
+		}
+		break;
+	case EMDMetaDataFieldType::LocalVariable:
+		if (const UFunction* Function = Blueprint->SkeletonGeneratedClass->FindFunctionByName(Field.FunctionName))
+		{
+			if (FProperty* Property = FindFProperty<FProperty>(Function, Field.FieldName))
+			{
+				return MakeShared<FMDMetaDataEditorFieldView>(Property, Blueprint);
+			}
+		}
+		break;
+	case EMDMetaDataFieldType::FunctionParameter:
+	{
+		// Params are edited on the generated class so that UMDMetaDataEditorBlueprintCompilerExtension can grab the meta data after the BP is compiled
+		const UFunction* Function = (Blueprint->GeneratedClass != nullptr) ? Blueprint->GeneratedClass->FindFunctionByName(Field.FunctionName) : nullptr;
+		FProperty* Property = (Function != nullptr) ? Function->FindPropertyByName(Field.FieldName) : nullptr;
+		if (Property != nullptr && Property->HasAnyPropertyFlags(CPF_Parm))
+		{
+			if (UK2Node_EditablePinBase* Node = MDMDEL_Private::FindParamNode(Blueprint, Field.FunctionName, Field.FieldName))
+			{
+				return MakeShared<FMDMetaDataEditorFieldView>(Property, Node);
+			}
+		}
+		break;
+	}
+	case EMDMetaDataFieldType::Function:
+		if (UK2Node_FunctionEntry* EntryNode = MDMDEL_Private::FindFunctionEntry(Blueprint, Field.FieldName))
+		{
+			return MakeShared<FMDMetaDataEditorFieldView>(EntryNode, Blueprint);
+		}
+		break;
+	case EMDMetaDataFieldType::CustomEvent:
+		if (UK2Node_CustomEvent* EventNode = MDMDEL_Private::FindCustomEvent(Blueprint, Field.FieldName))
+		{
+			return MakeShared<FMDMetaDataEditorFieldView>(EventNode, Blueprint);
+		}
+		break;
+	default:
+		break;
+	}
+
+	return nullptr;
+}
+
+bool UMDMetaDataEditorLibrary::ApplyOperation(const FMDMetaDataOperation& Operation)
+{
+	if (Operation.Key.IsNone())
+	{
+		return false;
+	}
+
+	const TSharedPtr<FMDMetaDataEditorFieldView> FieldView = MakeFieldView(Operation.Field);
+	if (!FieldView.IsValid() || FieldView->IsReadOnly())
+	{
+		return false;
+	}
+
+	switch (Operation.Operation)
+	{
+	case EMDMetaDataOperationType::Set:
+		FieldView->SetMetadataValue(Operation.Key, Operation.Value);
+		return true;
+	case EMDMetaDataOperationType::Remove:
+		if (!FieldView->HasMetadataValue(Operation.Key))
+		{
+			return false;
+		}
+		FieldView->RemoveMetadataKey(Operation.Key);
+		return true;
+	case EMDMetaDataOperationType::Rename:
+		if (Operation.NewKey.IsNone() || !FieldView->HasMetadataValue(Operation.Key) || FieldView->HasMetadataValue(Operation.NewKey))
+		{
+			return false;
+		}
+		FieldView->SetMetadataKey(Operation.Key, Operation.NewKey);
+		return true;
+	default:
+		return false;
+	}
+}
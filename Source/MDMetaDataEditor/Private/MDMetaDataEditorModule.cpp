@@ -4,64 +4,86 @@
 
 #include "BlueprintEditorModule.h"
 #include "Config/MDMetaDataEditorConfig.h"
+#include "Customizations/MDMetaDataEditorFieldPlanCache.h"
 #include "Customizations/MDMetaDataEditorFunctionCustomization.h"
 #include "Customizations/MDMetaDataEditorPropertyTypeCustomization.h"
 #include "Customizations/MDMetaDataEditorStructChangeHandler.h"
 #include "Customizations/MDMetaDataEditorVariableCustomization.h"
+#include "Engine/Blueprint.h"
+#include "Diff/MDMetaDataDiff.h"
 #include "Engine/UserDefinedStruct.h"
+#include "Export/MDMetaDataExporter.h"
 #include "K2Node_CustomEvent.h"
 #include "K2Node_FunctionEntry.h"
 #include "K2Node_Tunnel.h"
+#include "MDMetaDataCompilerHooks.h"
 #include "Modules/ModuleManager.h"
 #include "PropertyEditorModule.h"
+#include "References/MDMetaDataReferenceIndex.h"
+#include "References/MDMetaDataTagRedirector.h"
+#include "ToolMenus.h"
+#include "Types/MDMetaDataEnumCache.h"
+#include "Types/MDMetaDataRuntimeTableBaker.h"
+#include "Types/MDMetaDataTypeIndex.h"
+#include "Validation/MDMetaDataProjectValidator.h"
+#include "Validation/MDMetaDataValidator.h"
 #include "Widgets/Docking/SDockTab.h"
+#include "Widgets/SMDMetaDataMatrix.h"
 #include "Widgets/SMDUserStructMetaDataEditor.h"
+#include "WorkspaceMenuStructure.h"
+#include "WorkspaceMenuStructureModule.h"
 
 void FMDMetaDataEditorModule::StartupModule()
 {
-	const UMDMetaDataEditorConfig* Config = GetDefault<UMDMetaDataEditorConfig>();
+	ApplyConfig();
 
-	FBlueprintEditorModule& BlueprintEditorModule = FModuleManager::LoadModuleChecked<FBlueprintEditorModule>("Kismet");
+	ReferenceIndex = MakeShared<FMDMetaDataReferenceIndex>();
+	RuntimeTableBaker = MakeShared<FMDMetaDataRuntimeTableBaker>();
+	TypeIndex = MakeShared<FMDMetaDataTypeIndex>();
+	EnumCache = MakeShared<FMDMetaDataEnumCache>();
 
-	if (Config->bEnableMetaDataEditorForVariables)
-	{
-		VariableCustomizationHandle = BlueprintEditorModule.RegisterVariableCustomization(FProperty::StaticClass(), FOnGetVariableCustomizationInstance::CreateStatic(&FMDMetaDataEditorVariableCustomization::MakeInstance));
-	}
+	FPropertyEditorModule& PropertyEditorModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
+	PropertyEditorModule.RegisterCustomPropertyTypeLayout(FMDMetaDataEditorPropertyType::StaticStruct()->GetFName(), FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FMDMetaDataEditorPropertyTypeCustomization::MakeInstance));
 
-	if (Config->bEnableMetaDataEditorForLocalVariables)
-	{
-		LocalVariableCustomizationHandle = BlueprintEditorModule.RegisterLocalVariableCustomization(FProperty::StaticClass(), FOnGetVariableCustomizationInstance::CreateStatic(&FMDMetaDataEditorVariableCustomization::MakeInstance));
-	}
+	GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OnAssetEditorOpened().AddRaw(this, &FMDMetaDataEditorModule::OnAssetEditorOpened);
 
-	if (Config->bEnableMetaDataEditorForFunctions || Config->bEnableMetaDataEditorForFunctionParameters)
-	{
-		FunctionCustomizationHandle = BlueprintEditorModule.RegisterFunctionCustomization(UK2Node_FunctionEntry::StaticClass(), FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
-	}
+	GetMutableDefault<UMDMetaDataEditorConfig>()->OnMetaDataKeysChanged.AddRaw(this, &FMDMetaDataEditorModule::OnMetaDataKeysChanged);
 
-	if (Config->bEnableMetaDataEditorForTunnels)
-	{
-		TunnelCustomizationHandle = BlueprintEditorModule.RegisterFunctionCustomization(UK2Node_Tunnel::StaticClass(), FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
-	}
+	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateStatic(&FMDMetaDataExporter::RegisterMenus));
 
-	if (Config->bEnableMetaDataEditorForCustomEvents || Config->bEnableMetaDataEditorForFunctionParameters)
-	{
-		EventCustomizationHandle = BlueprintEditorModule.RegisterFunctionCustomization(UK2Node_CustomEvent::StaticClass(), FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
-	}
+	FMDMetaDataProjectValidator::RegisterSummaryTag();
 
-	FPropertyEditorModule& PropertyEditorModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
-	PropertyEditorModule.RegisterCustomPropertyTypeLayout(FMDMetaDataEditorPropertyType::StaticStruct()->GetFName(), FOnGetPropertyTypeCustomizationInstance::CreateStatic(&FMDMetaDataEditorPropertyTypeCustomization::MakeInstance));
+	FMDMetaDataCompilerHooks::Get().IsRuntimeMetaDataKey.BindStatic(&FMDMetaDataEditorModule::IsRuntimeMetaDataKey);
+	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateStatic(&FMDMetaDataProjectValidator::RegisterMenus));
 
-	GEditor->GetEditorSubsystem<UAssetEditorSubsystem>()->OnAssetEditorOpened().AddRaw(this, &FMDMetaDataEditorModule::OnAssetEditorOpened);
+	FGlobalTabmanager::Get()->RegisterNomadTabSpawner(SMDMetaDataMatrix::TabId, FOnSpawnTab::CreateStatic(&SMDMetaDataMatrix::SpawnTab))
+		.SetDisplayName(INVTEXT("Metadata Matrix"))
+		.SetTooltipText(INVTEXT("Edit the meta data of many Blueprints and User Defined Structs in a spreadsheet"))
+		.SetGroup(WorkspaceMenu::GetMenuStructure().GetToolsCategory())
+		.SetIcon(FSlateIcon(FAppStyle::GetAppStyleSetName(), "PropertyEditor.Grid.TabIcon"));
+	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateStatic(&SMDMetaDataMatrix::RegisterMenus));
 
-	if (Config->bEnableMetaDataEditorForStructs)
-	{
-		StructChangeHandler = MakeShared<FMDMetaDataEditorStructChangeHandler>();
-	}
+	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateStatic(&FMDMetaDataDiff::RegisterMenus));
+
+	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateStatic(&FMDMetaDataTagRedirector::RegisterMenus));
 }
 
 void FMDMetaDataEditorModule::ShutdownModule()
 {
 	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SMDUserStructMetaDataEditor::TabId);
+	FGlobalTabmanager::Get()->UnregisterNomadTabSpawner(SMDMetaDataMatrix::TabId);
+	SMDMetaDataMatrix::UnregisterMenus();
+
+	FMDMetaDataDiff::UnregisterMenus();
+
+	FMDMetaDataTagRedirector::UnregisterMenus();
+
+	FMDMetaDataExporter::UnregisterMenus();
+
+	FMDMetaDataProjectValidator::UnregisterMenus();
+	FMDMetaDataProjectValidator::UnregisterSummaryTag();
+
+	FMDMetaDataCompilerHooks::Get().IsRuntimeMetaDataKey.Unbind();
 
 	// These StaticClasses aren't valid during engine shutdown, gate the unregistration similarly to the logic in FRigVMEditorModule::ShutdownModule()
 	if (!IsEngineExitRequested())
@@ -74,8 +96,19 @@ void FMDMetaDataEditorModule::ShutdownModule()
 			BlueprintEditorModule->UnregisterFunctionCustomization(UK2Node_Tunnel::StaticClass(), TunnelCustomizationHandle);
 			BlueprintEditorModule->UnregisterFunctionCustomization(UK2Node_CustomEvent::StaticClass(), EventCustomizationHandle);
 		}
+
+		if (UMDMetaDataEditorConfig* Config = GetMutableDefault<UMDMetaDataEditorConfig>())
+		{
+			Config->OnMetaDataKeysChanged.RemoveAll(this);
+		}
 	}
 
+	VariableCustomizationHandle.Reset();
+	LocalVariableCustomizationHandle.Reset();
+	FunctionCustomizationHandle.Reset();
+	TunnelCustomizationHandle.Reset();
+	EventCustomizationHandle.Reset();
+
 	if (GEditor)
 	{
 		if (UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>())
@@ -90,17 +123,136 @@ void FMDMetaDataEditorModule::ShutdownModule()
 	}
 
 	StructChangeHandler.Reset();
+	FieldPlanCache.Reset();
+	ReferenceIndex.Reset();
+	RuntimeTableBaker.Reset();
+	TypeIndex.Reset();
+	EnumCache.Reset();
+	Validator.Reset();
 }
 
-void FMDMetaDataEditorModule::RestartModule()
+void FMDMetaDataEditorModule::ApplyConfig()
 {
-	ShutdownModule();
-	StartupModule();
+	const UMDMetaDataEditorConfig* Config = GetDefault<UMDMetaDataEditorConfig>();
+
+	FBlueprintEditorModule& BlueprintEditorModule = FModuleManager::LoadModuleChecked<FBlueprintEditorModule>("Kismet");
+
+	// Only touch the customizations whose enabled state doesn't match what's currently registered
+	const bool bEnableVariables = Config->bEnableMetaDataEditorForVariables;
+	if (bEnableVariables != VariableCustomizationHandle.IsValid())
+	{
+		if (bEnableVariables)
+		{
+			VariableCustomizationHandle = BlueprintEditorModule.RegisterVariableCustomization(FProperty::StaticClass(), FOnGetVariableCustomizationInstance::CreateStatic(&FMDMetaDataEditorVariableCustomization::MakeInstance));
+		}
+		else
+		{
+			BlueprintEditorModule.UnregisterVariableCustomization(FProperty::StaticClass(), VariableCustomizationHandle);
+			VariableCustomizationHandle.Reset();
+		}
+	}
+
+	const bool bEnableLocalVariables = Config->bEnableMetaDataEditorForLocalVariables;
+	if (bEnableLocalVariables != LocalVariableCustomizationHandle.IsValid())
+	{
+		if (bEnableLocalVariables)
+		{
+			LocalVariableCustomizationHandle = BlueprintEditorModule.RegisterLocalVariableCustomization(FProperty::StaticClass(), FOnGetVariableCustomizationInstance::CreateStatic(&FMDMetaDataEditorVariableCustomization::MakeInstance));
+		}
+		else
+		{
+			BlueprintEditorModule.UnregisterLocalVariableCustomization(FProperty::StaticClass(), LocalVariableCustomizationHandle);
+			LocalVariableCustomizationHandle.Reset();
+		}
+	}
+
+	ApplyFunctionCustomization(BlueprintEditorModule, UK2Node_FunctionEntry::StaticClass(), Config->bEnableMetaDataEditorForFunctions || Config->bEnableMetaDataEditorForFunctionParameters, FunctionCustomizationHandle);
+	ApplyFunctionCustomization(BlueprintEditorModule, UK2Node_Tunnel::StaticClass(), Config->bEnableMetaDataEditorForTunnels, TunnelCustomizationHandle);
+	ApplyFunctionCustomization(BlueprintEditorModule, UK2Node_CustomEvent::StaticClass(), Config->bEnableMetaDataEditorForCustomEvents || Config->bEnableMetaDataEditorForFunctionParameters, EventCustomizationHandle);
+
+	if (!Config->bEnableMetaDataEditorForStructs)
+	{
+		StructChangeHandler.Reset();
+	}
+	else if (!StructChangeHandler.IsValid())
+	{
+		StructChangeHandler = MakeShared<FMDMetaDataEditorStructChangeHandler>();
+	}
+
+	if (!Config->bEnableMetaDataEditorForVariables && !Config->bEnableMetaDataEditorForLocalVariables && !Config->bEnableMetaDataEditorForFunctionParameters)
+	{
+		FieldPlanCache.Reset();
+	}
+	else if (!FieldPlanCache.IsValid())
+	{
+		FieldPlanCache = MakeShared<FMDMetaDataEditorFieldPlanCache>();
+	}
+
+	if (!Config->bValidateMetaDataOnCompile)
+	{
+		Validator.Reset();
+	}
+	else if (!Validator.IsValid())
+	{
+		Validator = MakeShared<FMDMetaDataValidator>();
+	}
+}
+
+void FMDMetaDataEditorModule::ApplyFunctionCustomization(FBlueprintEditorModule& BlueprintEditorModule, UClass* NodeClass, bool bEnable, FDelegateHandle& Handle)
+{
+	if (bEnable == Handle.IsValid())
+	{
+		return;
+	}
+
+	if (bEnable)
+	{
+		Handle = BlueprintEditorModule.RegisterFunctionCustomization(NodeClass, FOnGetFunctionCustomizationInstance::CreateStatic(&FMDMetaDataEditorFunctionCustomization::MakeInstance));
+	}
+	else
+	{
+		BlueprintEditorModule.UnregisterFunctionCustomization(NodeClass, Handle);
+		Handle.Reset();
+	}
+}
+
+void FMDMetaDataEditorModule::OnMetaDataKeysChanged()
+{
+	if (FieldPlanCache.IsValid())
+	{
+		FieldPlanCache->RequestAllPlans();
+	}
+}
+
+bool FMDMetaDataEditorModule::IsRuntimeMetaDataKey(FName Key)
+{
+	return GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot()->IsRuntimeKey(Key);
 }
 
 void FMDMetaDataEditorModule::OnAssetEditorOpened(UObject* Asset)
 {
-	UUserDefinedStruct* UserDefinedStruct = Cast<UUserDefinedStruct>(Asset);
+	if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+	{
+		GetMutableDefault<UMDMetaDataEditorConfig>()->LoadKeyPacksForBlueprint(Blueprint);
+
+		if (ReferenceIndex.IsValid())
+		{
+			ReferenceIndex->TrackBlueprint(Blueprint);
+		}
+
+		if (FieldPlanCache.IsValid())
+		{
+			FieldPlanCache->RequestPlans(Blueprint);
+		}
+	}
+	else if (UUserDefinedStruct* UserDefinedStruct = Cast<UUserDefinedStruct>(Asset))
+	{
+		OnStructEditorOpened(UserDefinedStruct);
+	}
+}
+
+void FMDMetaDataEditorModule::OnStructEditorOpened(UUserDefinedStruct* UserDefinedStruct)
+{
 	UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
 	if (!IsValid(AssetEditorSubsystem) || !IsValid(UserDefinedStruct))
 	{
@@ -109,7 +261,7 @@ void FMDMetaDataEditorModule::OnAssetEditorOpened(UObject* Asset)
 
 	static const FName StructEditorName = TEXT("UserDefinedStructureEditor");
 	constexpr bool bFocus = false;
-	IAssetEditorInstance* Editor = AssetEditorSubsystem->FindEditorForAsset(Asset, bFocus);
+	IAssetEditorInstance* Editor = AssetEditorSubsystem->FindEditorForAsset(UserDefinedStruct, bFocus);
 	if (Editor == nullptr || Editor->GetEditorName() != StructEditorName)
 	{
 		return;
@@ -6,7 +6,15 @@
 #include "Modules/ModuleInterface.h"
 #include "Templates/SharedPointer.h"
 
+class FBlueprintEditorModule;
+class FMDMetaDataEditorFieldPlanCache;
+class FMDMetaDataReferenceIndex;
+class FMDMetaDataRuntimeTableBaker;
+class FMDMetaDataTypeIndex;
 class FMDMetaDataEditorStructChangeHandler;
+class FMDMetaDataEnumCache;
+class FMDMetaDataValidator;
+class UUserDefinedStruct;
 
 class FMDMetaDataEditorModule : public IModuleInterface
 {
@@ -15,12 +23,30 @@ public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 
-	void RestartModule();
+	// Register or unregister only the parts of the module whose enabled state changed in the config
+	void ApplyConfig();
+
+	const FMDMetaDataEditorFieldPlanCache* GetFieldPlanCache() const { return FieldPlanCache.Get(); }
+	FMDMetaDataReferenceIndex* GetReferenceIndex() const { return ReferenceIndex.Get(); }
+	TSharedPtr<FMDMetaDataTypeIndex> GetTypeIndex() const { return TypeIndex; }
+	TSharedPtr<FMDMetaDataEnumCache> GetEnumCache() const { return EnumCache; }
 
 private:
+	void ApplyFunctionCustomization(FBlueprintEditorModule& BlueprintEditorModule, UClass* NodeClass, bool bEnable, FDelegateHandle& Handle);
+	void OnMetaDataKeysChanged();
+
+	static bool IsRuntimeMetaDataKey(FName Key);
+
 	void OnAssetEditorOpened(UObject* Asset);
+	void OnStructEditorOpened(UUserDefinedStruct* UserDefinedStruct);
 
 	TSharedPtr<FMDMetaDataEditorStructChangeHandler> StructChangeHandler;
+	TSharedPtr<FMDMetaDataEditorFieldPlanCache> FieldPlanCache;
+	TSharedPtr<FMDMetaDataReferenceIndex> ReferenceIndex;
+	TSharedPtr<FMDMetaDataRuntimeTableBaker> RuntimeTableBaker;
+	TSharedPtr<FMDMetaDataTypeIndex> TypeIndex;
+	TSharedPtr<FMDMetaDataEnumCache> EnumCache;
+	TSharedPtr<FMDMetaDataValidator> Validator;
 
 	FDelegateHandle VariableCustomizationHandle;
 	FDelegateHandle LocalVariableCustomizationHandle;
@@ -0,0 +1,594 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataReferenceIndex.h"
+
+#include "Config/MDMetaDataEditorConfig.h"
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_FunctionEntry.h"
+#include "K2Node_FunctionResult.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "MDEditConditionCache.h"
+#include "MDMetaDataChangeBus.h"
+#include "Misc/Char.h"
+
+namespace MDMDRI_Private
+{
+	const FName EditConditionKey = TEXT("EditCondition");
+
+	// Keys whose values are the names of sibling properties, params or functions
+	const TSet<FName> ReferenceKeys = {
+		TEXT("AdvancedDisplay"),
+		TEXT("ArrayClamp"),
+		TEXT("ArrayParm"),
+		TEXT("AutoCreateRefTerm"),
+		TEXT("DefaultToSelf"),
+		TEXT("DeterminesOutputType"),
+		TEXT("DisplayAfter"),
+		TEXT("DynamicOutputParam"),
+		TEXT("EditCondition"),
+		TEXT("ExpandBoolAsExecs"),
+		TEXT("ExpandEnumAsExecs"),
+		TEXT("GetOptions"),
+		TEXT("HidePin"),
+		TEXT("WorldContext")
+	};
+
+	bool IsIdentifierChar(TCHAR Char)
+	{
+		return FChar::IsAlnum(Char) || Char == TEXT('_');
+	}
+
+	FName GetFunctionName(const UK2Node_FunctionEntry* EntryNode)
+	{
+		return (EntryNode->CustomGeneratedFunctionName != NAME_None) ? EntryNode->CustomGeneratedFunctionName : EntryNode->GetGraph()->GetFName();
+	}
+}
+
+FMDMetaDataReferenceIndex::FMDMetaDataReferenceIndex()
+{
+	FMDMetaDataChangeBus::Get().OnMetaDataChanged.AddRaw(this, &FMDMetaDataReferenceIndex::OnMetaDataChanged);
+}
+
+FMDMetaDataReferenceIndex::~FMDMetaDataReferenceIndex()
+{
+	FMDMetaDataChangeBus::Get().OnMetaDataChanged.RemoveAll(this);
+
+	for (const TPair<TObjectKey<UBlueprint>, FBlueprintIndex>& Pair : BlueprintIndices)
+	{
+		if (UBlueprint* Blueprint = Pair.Value.Blueprint.Get())
+		{
+			Blueprint->OnChanged().RemoveAll(this);
+			Blueprint->OnCompiled().RemoveAll(this);
+		}
+	}
+}
+
+void FMDMetaDataReferenceIndex::TrackBlueprint(UBlueprint* Blueprint)
+{
+	if (!IsValid(Blueprint))
+	{
+		return;
+	}
+
+	// Drop anything indexed for Blueprints that have since been unloaded
+	for (auto It = BlueprintIndices.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.Blueprint.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	FBlueprintIndex& Index = BlueprintIndices.FindOrAdd(Blueprint);
+	if (!Index.Blueprint.IsValid())
+	{
+		Index.Blueprint = Blueprint;
+		Blueprint->OnChanged().AddSP(this, &FMDMetaDataReferenceIndex::OnBlueprintChanged);
+		Blueprint->OnCompiled().AddSP(this, &FMDMetaDataReferenceIndex::OnBlueprintCompiled);
+	}
+
+	GatherTrackedNames(Blueprint, Index.TrackedNames);
+	Index.FunctionParams.Reset();
+	Index.bIsDirty = true;
+}
+
+void FMDMetaDataReferenceIndex::FindReferences(UBlueprint* Blueprint, FName ScopeName, FName MemberName, TArray<FMDMetaDataReference>& OutReferences)
+{
+	OutReferences.Reset();
+
+	FBlueprintIndex* Index = FindIndex(Blueprint);
+	if (Index == nullptr)
+	{
+		return;
+	}
+
+	EnsureBuilt(*Index);
+	if (const TArray<FSource>* Sources = Index->References.Find(FScopedName(ScopeName, MemberName)))
+	{
+		for (const FSource& Source : *Sources)
+		{
+			OutReferences.Add(FMDMetaDataReference{ Index->Fields[Source.FieldIndex], Source.Key });
+		}
+	}
+}
+
+TConstArrayView<FName> FMDMetaDataReferenceIndex::GetFunctionParams(const UK2Node_EditablePinBase* Node)
+{
+	if (!IsValid(Node))
+	{
+		return {};
+	}
+
+	UBlueprint* Blueprint = FBlueprintEditorUtils::FindBlueprintForNode(Node);
+	FBlueprintIndex* Index = FindIndex(Blueprint);
+	if (Index == nullptr)
+	{
+		TrackBlueprint(Blueprint);
+		Index = FindIndex(Blueprint);
+		if (Index == nullptr)
+		{
+			return {};
+		}
+	}
+
+	if (const TArray<FName>* Params = Index->FunctionParams.Find(Node))
+	{
+		return *Params;
+	}
+
+	TArray<FName>& Params = Index->FunctionParams.Add(Node);
+	Params.Reserve(Node->UserDefinedPins.Num());
+	for (const TSharedPtr<FUserPinInfo>& PinInfo : Node->UserDefinedPins)
+	{
+		if (PinInfo.IsValid() && PinInfo->PinType.PinCategory != UEdGraphSchema_K2::PC_Exec)
+		{
+			Params.Add(PinInfo->PinName);
+		}
+	}
+
+	return Params;
+}
+
+bool FMDMetaDataReferenceIndex::IsReferenceKey(FName Key)
+{
+	return MDMDRI_Private::ReferenceKeys.Contains(Key) || GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot()->IsParamKey(Key);
+}
+
+void FMDMetaDataReferenceIndex::ForEachIdentifier(FStringView Value, TFunctionRef<void(int32, int32)> Func)
+{
+	int32 Index = 0;
+	while (Index < Value.Len())
+	{
+		if (!MDMDRI_Private::IsIdentifierChar(Value[Index]))
+		{
+			++Index;
+			continue;
+		}
+
+		const int32 Start = Index;
+		while (Index < Value.Len() && MDMDRI_Private::IsIdentifierChar(Value[Index]))
+		{
+			++Index;
+		}
+
+		// Skip numbers, and qualified names like EMyEnum::Value or Class.Function since they don't name a member of this Blueprint
+		const bool bIsNumber = FChar::IsDigit(Value[Start]);
+		const bool bIsQualified = (Start > 0 && (Value[Start - 1] == TEXT('.') || Value[Start - 1] == TEXT(':')))
+			|| (Index < Value.Len() && (Value[Index] == TEXT('.') || Value[Index] == TEXT(':')));
+		if (bIsNumber || bIsQualified)
+		{
+			continue;
+		}
+
+		const FStringView Identifier = Value.Mid(Start, Index - Start);
+		if (Identifier.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Identifier.Equals(TEXT("false"), ESearchCase::IgnoreCase) || Identifier.Equals(TEXT("nullptr")))
+		{
+			continue;
+		}
+
+		Func(Start, Index - Start);
+	}
+}
+
+FString FMDMetaDataReferenceIndex::RenameIdentifier(const FString& Value, FName OldName, FName NewName)
+{
+	const FString OldString = OldName.ToString();
+	const FString NewString = NewName.ToString();
+
+	FString Result;
+	int32 Copied = 0;
+	ForEachIdentifier(Value, [&](int32 Start, int32 Len)
+	{
+		if (FStringView(Value).Mid(Start, Len).Equals(OldString, ESearchCase::IgnoreCase))
+		{
+			Result.Append(*Value + Copied, Start - Copied);
+			Result.Append(NewString);
+			Copied = Start + Len;
+		}
+	});
+
+	Result.Append(*Value + Copied, Value.Len() - Copied);
+	return Result;
+}
+
+FName FMDMetaDataReferenceIndex::GetFieldScope(const FMDMetaDataFieldReference& Field)
+{
+	const bool bIsScoped = Field.FieldType == EMDMetaDataFieldType::LocalVariable || Field.FieldType == EMDMetaDataFieldType::FunctionParameter;
+	return bIsScoped ? Field.FunctionName : NAME_None;
+}
+
+FName FMDMetaDataReferenceIndex::GetReferenceScope(const FMDMetaDataFieldReference& Field)
+{
+	// Function meta data such as DefaultToSelf names the function's own params
+	const bool bIsFunction = Field.FieldType == EMDMetaDataFieldType::Function || Field.FieldType == EMDMetaDataFieldType::CustomEvent;
+	return bIsFunction ? Field.FieldName : GetFieldScope(Field);
+}
+
+void FMDMetaDataReferenceIndex::GatherTrackedNames(const UBlueprint* Blueprint, TMap<FGuid, FTrackedName>& OutNames)
+{
+	OutNames.Reset();
+
+	auto AddParams = [&OutNames](const UK2Node_EditablePinBase* Node, FName FunctionName)
+	{
+		for (const TSharedPtr<FUserPinInfo>& PinInfo : Node->UserDefinedPins)
+		{
+			// Pin IDs survive renames, FUserPinInfo has no ID of its own
+			const UEdGraphPin* Pin = PinInfo.IsValid() ? Node->FindPin(PinInfo->PinName) : nullptr;
+			if (Pin != nullptr)
+			{
+				OutNames.Add(Pin->PinId, FTrackedName{ EMDMetaDataFieldType::FunctionParameter, FunctionName, PinInfo->PinName });
+			}
+		}
+	};
+
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		OutNames.Add(Variable.VarGuid, FTrackedName{ EMDMetaDataFieldType::Variable, NAME_None, Variable.VarName, Variable.VarType });
+	}
+
+	for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		TArray<UK2Node_FunctionEntry*> EntryNodes;
+		Graph->GetNodesOfClass(EntryNodes);
+		if (EntryNodes.Num() == 0)
+		{
+			continue;
+		}
+
+		const UK2Node_FunctionEntry* EntryNode = EntryNodes[0];
+		const FName FunctionName = MDMDRI_Private::GetFunctionName(EntryNode);
+		OutNames.Add(Graph->GraphGuid, FTrackedName{ EMDMetaDataFieldType::Function, NAME_None, FunctionName });
+
+		for (const FBPVariableDescription& LocalVariable : EntryNode->LocalVariables)
+		{
+			OutNames.Add(LocalVariable.VarGuid, FTrackedName{ EMDMetaDataFieldType::LocalVariable, FunctionName, LocalVariable.VarName });
+		}
+
+		AddParams(EntryNode, FunctionName);
+
+		TArray<UK2Node_FunctionResult*> ResultNodes;
+		Graph->GetNodesOfClass(ResultNodes);
+		for (const UK2Node_FunctionResult* ResultNode : ResultNodes)
+		{
+			AddParams(ResultNode, FunctionName);
+		}
+	}
+
+	TArray<UK2Node_CustomEvent*> EventNodes;
+	FBlueprintEditorUtils::GetAllNodesOfClass(Blueprint, EventNodes);
+	for (const UK2Node_CustomEvent* EventNode : EventNodes)
+	{
+		OutNames.Add(EventNode->NodeGuid, FTrackedName{ EMDMetaDataFieldType::CustomEvent, NAME_None, EventNode->CustomFunctionName });
+		AddParams(EventNode, EventNode->CustomFunctionName);
+	}
+}
+
+FMDMetaDataReferenceIndex::FBlueprintIndex* FMDMetaDataReferenceIndex::FindIndex(UBlueprint* Blueprint)
+{
+	FBlueprintIndex* Index = BlueprintIndices.Find(Blueprint);
+	return (Index != nullptr && Index->Blueprint.IsValid()) ? Index : nullptr;
+}
+
+void FMDMetaDataReferenceIndex::EnsureBuilt(FBlueprintIndex& Index)
+{
+	if (!Index.bIsDirty)
+	{
+		return;
+	}
+
+	Index.bIsDirty = false;
+	Index.References.Reset();
+	Index.ReferencedNames.Reset();
+
+	UMDMetaDataEditorLibrary::GetMetaDataFields(Index.Blueprint.Get(), Index.Fields);
+	RebuildFieldIndices(Index);
+
+	TMap<FName, FString> MetaData;
+	for (int32 FieldIndex = 0; FieldIndex < Index.Fields.Num(); ++FieldIndex)
+	{
+		if (!UMDMetaDataEditorLibrary::GetAllMetaData(Index.Fields[FieldIndex], MetaData))
+		{
+			continue;
+		}
+
+		for (const TPair<FName, FString>& Pair : MetaData)
+		{
+			if (IsReferenceKey(Pair.Key))
+			{
+				IndexFieldKey(Index, FieldIndex, Pair.Key, &Pair.Value);
+			}
+		}
+	}
+}
+
+void FMDMetaDataReferenceIndex::IndexFieldKey(FBlueprintIndex& Index, int32 FieldIndex, FName Key, const FString* Value)
+{
+	const FSource Source = { FieldIndex, Key };
+	const TPair<int32, FName> SourceKey(FieldIndex, Key);
+
+	// Forget what the old value referenced
+	if (const TArray<FScopedName>* OldNames = Index.ReferencedNames.Find(SourceKey))
+	{
+		for (const FScopedName& OldName : *OldNames)
+		{
+			if (TArray<FSource>* Sources = Index.References.Find(OldName))
+			{
+				Sources->Remove(Source);
+				if (Sources->Num() == 0)
+				{
+					Index.References.Remove(OldName);
+				}
+			}
+		}
+
+		Index.ReferencedNames.Remove(SourceKey);
+	}
+
+	if (Value == nullptr)
+	{
+		return;
+	}
+
+	const FName ScopeName = GetReferenceScope(Index.Fields[FieldIndex]);
+	TArray<FScopedName> NewNames;
+	ForEachIdentifier(*Value, [&](int32 Start, int32 Len)
+	{
+		const FScopedName Name(ScopeName, FName(Len, **Value + Start));
+		if (!NewNames.Contains(Name))
+		{
+			NewNames.Add(Name);
+			Index.References.FindOrAdd(Name).AddUnique(Source);
+		}
+	});
+
+	if (NewNames.Num() > 0)
+	{
+		Index.ReferencedNames.Add(SourceKey, MoveTemp(NewNames));
+	}
+}
+
+void FMDMetaDataReferenceIndex::RebuildFieldIndices(FBlueprintIndex& Index)
+{
+	Index.FieldIndices.Reset();
+	for (int32 FieldIndex = 0; FieldIndex < Index.Fields.Num(); ++FieldIndex)
+	{
+		const FMDMetaDataFieldReference& Field = Index.Fields[FieldIndex];
+		Index.FieldIndices.Add(FScopedName(GetFieldScope(Field), Field.FieldName), FieldIndex);
+	}
+}
+
+void FMDMetaDataReferenceIndex::RenameMember(FBlueprintIndex& Index, const FTrackedName& OldName, FName NewName)
+{
+	const bool bIsFunction = OldName.FieldType == EMDMetaDataFieldType::Function || OldName.FieldType == EMDMetaDataFieldType::CustomEvent;
+
+	// Update the renamed fields first so the values below can be written. Params are left alone, they're found on the generated class which keeps the old names until the next compile.
+	for (FMDMetaDataFieldReference& Field : Index.Fields)
+	{
+		if (Field.FieldType == OldName.FieldType && OldName.FieldType != EMDMetaDataFieldType::FunctionParameter
+			&& GetFieldScope(Field) == OldName.ScopeName && Field.FieldName == OldName.Name)
+		{
+			Field.FieldName = NewName;
+		}
+		else if (bIsFunction && Field.FieldType == EMDMetaDataFieldType::LocalVariable && Field.FunctionName == OldName.Name)
+		{
+			Field.FunctionName = NewName;
+		}
+	}
+
+	RebuildFieldIndices(Index);
+
+	TArray<FSource> Sources;
+	Index.References.RemoveAndCopyValue(FScopedName(OldName.ScopeName, OldName.Name), Sources);
+
+	for (const FSource& Source : Sources)
+	{
+		const FMDMetaDataFieldReference& Field = Index.Fields[Source.FieldIndex];
+
+		FString Value;
+		if (UMDMetaDataEditorLibrary::GetMetaData(Field, Source.Key, Value))
+		{
+			const FString NewValue = RenameIdentifier(Value, OldName.Name, NewName);
+			if (!NewValue.Equals(Value, ESearchCase::CaseSensitive))
+			{
+				UMDMetaDataEditorLibrary::SetMetaData(Field, Source.Key, NewValue);
+			}
+
+			IndexFieldKey(Index, Source.FieldIndex, Source.Key, &NewValue);
+		}
+	}
+
+	if (bIsFunction)
+	{
+		// Everything scoped to the function moves with it
+		Index.bIsDirty = true;
+	}
+}
+
+void FMDMetaDataReferenceIndex::InvalidateEditConditions(FBlueprintIndex& Index, const TMap<FGuid, FTrackedName>& NewNames)
+{
+	TArray<FName> ChangedVariables;
+	for (const TPair<FGuid, FTrackedName>& Pair : Index.TrackedNames)
+	{
+		if (Pair.Value.FieldType != EMDMetaDataFieldType::Variable)
+		{
+			continue;
+		}
+
+		const FTrackedName* NewName = NewNames.Find(Pair.Key);
+		if (NewName == nullptr || !NewName->Name.IsEqual(Pair.Value.Name, ENameCase::CaseSensitive) || NewName->PinType != Pair.Value.PinType)
+		{
+			ChangedVariables.AddUnique(Pair.Value.Name);
+		}
+	}
+
+	for (const TPair<FGuid, FTrackedName>& Pair : NewNames)
+	{
+		const FTrackedName* OldName = Index.TrackedNames.Find(Pair.Key);
+		if (Pair.Value.FieldType == EMDMetaDataFieldType::Variable && (OldName == nullptr || !OldName->Name.IsEqual(Pair.Value.Name, ENameCase::CaseSensitive)))
+		{
+			ChangedVariables.AddUnique(Pair.Value.Name);
+		}
+	}
+
+	if (ChangedVariables.Num() == 0)
+	{
+		return;
+	}
+
+	const UStruct* Owner = Index.Blueprint->SkeletonGeneratedClass;
+	if (Index.bIsDirty)
+	{
+		// Nothing says which values name the variables until the index is built
+		FMDEditConditionCache::Get().Invalidate(Owner);
+		return;
+	}
+
+	for (const FName& VariableName : ChangedVariables)
+	{
+		const TArray<FSource>* Sources = Index.References.Find(FScopedName(NAME_None, VariableName));
+		if (Sources == nullptr)
+		{
+			continue;
+		}
+
+		for (const FSource& Source : *Sources)
+		{
+			FString Value;
+			if (Source.Key == MDMDRI_Private::EditConditionKey && UMDMetaDataEditorLibrary::GetMetaData(Index.Fields[Source.FieldIndex], Source.Key, Value))
+			{
+				FMDEditConditionCache::Get().Invalidate(Owner, Value);
+			}
+		}
+	}
+}
+
+void FMDMetaDataReferenceIndex::OnBlueprintChanged(UBlueprint* Blueprint)
+{
+	FBlueprintIndex* Index = FindIndex(Blueprint);
+	if (Index == nullptr)
+	{
+		// Properties may have been added, removed or retyped
+		FMDEditConditionCache::Get().Invalidate(Blueprint->SkeletonGeneratedClass);
+		return;
+	}
+
+	// Pins may have been added, removed, renamed or reordered
+	Index->FunctionParams.Reset();
+
+	if (bIsApplyingRenames)
+	{
+		return;
+	}
+
+	TMap<FGuid, FTrackedName> NewNames;
+	GatherTrackedNames(Blueprint, NewNames);
+	InvalidateEditConditions(*Index, NewNames);
+
+	// Multiple result nodes share the same outputs, so the same rename can show up more than once
+	TArray<TPair<FTrackedName, FName>> Renames;
+	for (const TPair<FGuid, FTrackedName>& Pair : NewNames)
+	{
+		const FTrackedName* OldName = Index->TrackedNames.Find(Pair.Key);
+		if (OldName == nullptr || OldName->Name.IsEqual(Pair.Value.Name, ENameCase::CaseSensitive))
+		{
+			continue;
+		}
+
+		const bool bIsDuplicate = Renames.ContainsByPredicate([OldName, &Pair](const TPair<FTrackedName, FName>& Rename)
+		{
+			return Rename.Key.FieldType == OldName->FieldType && Rename.Key.ScopeName == OldName->ScopeName && Rename.Key.Name == OldName->Name && Rename.Value == Pair.Value.Name;
+		});
+
+		if (!bIsDuplicate)
+		{
+			Renames.Emplace(*OldName, Pair.Value.Name);
+		}
+	}
+
+	Index->TrackedNames = MoveTemp(NewNames);
+	if (Renames.Num() == 0)
+	{
+		return;
+	}
+
+	// The values haven't changed yet, so if the index needs building it still finds the references to the old names
+	EnsureBuilt(*Index);
+
+	TGuardValue<bool> ApplyingGuard(bIsApplyingRenames, true);
+	FMDMetaDataEditorBatchScope BatchScope(INVTEXT("Update Meta Data References"));
+	for (const TPair<FTrackedName, FName>& Rename : Renames)
+	{
+		RenameMember(*Index, Rename.Key, Rename.Value);
+	}
+}
+
+void FMDMetaDataReferenceIndex::OnBlueprintCompiled(UBlueprint* Blueprint)
+{
+	// Params are found on the generated class, which may now have new names
+	if (FBlueprintIndex* Index = FindIndex(Blueprint))
+	{
+		Index->bIsDirty = true;
+	}
+}
+
+void FMDMetaDataReferenceIndex::OnMetaDataChanged(TConstArrayView<FMDMetaDataChangeRecord> Records)
+{
+	for (const FMDMetaDataChangeRecord& Record : Records)
+	{
+		const bool bIsReferenceKey = IsReferenceKey(Record.Key);
+		const bool bWasReferenceKey = !Record.RenamedFrom.IsNone() && IsReferenceKey(Record.RenamedFrom);
+		if (!bIsReferenceKey && !bWasReferenceKey)
+		{
+			continue;
+		}
+
+		UBlueprint* Blueprint = Cast<UBlueprint>(Record.Target.Asset.Get());
+		FBlueprintIndex* Index = (Blueprint != nullptr) ? FindIndex(Blueprint) : nullptr;
+		if (Index == nullptr || Index->bIsDirty)
+		{
+			// Nothing to keep up to date, it'll see the change when it's built
+			continue;
+		}
+
+		const int32* FieldIndex = Index->FieldIndices.Find(FScopedName(Record.Target.ScopeName, Record.Target.FieldName));
+		if (FieldIndex == nullptr)
+		{
+			// A field that didn't exist when the index was built
+			Index->bIsDirty = true;
+			continue;
+		}
+
+		if (bWasReferenceKey)
+		{
+			IndexFieldKey(*Index, *FieldIndex, Record.RenamedFrom, nullptr);
+		}
+
+		if (bIsReferenceKey)
+		{
+			IndexFieldKey(*Index, *FieldIndex, Record.Key, Record.NewValue.IsSet() ? &Record.NewValue->ToString() : nullptr);
+		}
+	}
+}
@@ -0,0 +1,106 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "EdGraph/EdGraphPin.h"
+#include "MDMetaDataEditorLibrary.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
+
+class UBlueprint;
+class UK2Node_EditablePinBase;
+struct FMDMetaDataChangeRecord;
+
+// A meta data key on a field whose value names another member, such as EditCondition="bFoo"
+struct FMDMetaDataReference
+{
+	FMDMetaDataFieldReference Field;
+	FName Key = NAME_None;
+};
+
+/**
+ * Per-Blueprint reverse index from a member name to the meta data values that reference it (EditCondition, DisplayAfter, DefaultToSelf, etc.),
+ * kept up to date from the meta data change bus. When a variable, local variable, param or function is renamed, the values that reference it are rewritten.
+ */
+class FMDMetaDataReferenceIndex : public TSharedFromThis<FMDMetaDataReferenceIndex>
+{
+public:
+	FMDMetaDataReferenceIndex();
+	~FMDMetaDataReferenceIndex();
+
+	void TrackBlueprint(UBlueprint* Blueprint);
+
+	// ScopeName is the function for params and local variables, otherwise None
+	void FindReferences(UBlueprint* Blueprint, FName ScopeName, FName MemberName, TArray<FMDMetaDataReference>& OutReferences);
+
+	// The params of a function, custom event or macro in pin order, cached until the Blueprint's pins change
+	TConstArrayView<FName> GetFunctionParams(const UK2Node_EditablePinBase* Node);
+
+	// Whether the key's values name members, either a built in key like EditCondition or a configured Param key
+	static bool IsReferenceKey(FName Key);
+
+	// Calls Func with the start and length of each unqualified identifier in a meta data value
+	static void ForEachIdentifier(FStringView Value, TFunctionRef<void(int32, int32)> Func);
+	static FString RenameIdentifier(const FString& Value, FName OldName, FName NewName);
+
+private:
+	typedef TPair<FName, FName> FScopedName;
+
+	struct FTrackedName
+	{
+		EMDMetaDataFieldType FieldType = EMDMetaDataFieldType::Variable;
+		FName ScopeName = NAME_None;
+		FName Name = NAME_None;
+		// Only set for variables, EditConditions that name them are validated against it
+		FEdGraphPinType PinType;
+	};
+
+	struct FSource
+	{
+		int32 FieldIndex = INDEX_NONE;
+		FName Key = NAME_None;
+
+		bool operator==(const FSource& Other) const { return FieldIndex == Other.FieldIndex && Key == Other.Key; }
+	};
+
+	struct FBlueprintIndex
+	{
+		TWeakObjectPtr<UBlueprint> Blueprint;
+		bool bIsDirty = true;
+
+		TArray<FMDMetaDataFieldReference> Fields;
+		TMap<FScopedName, int32> FieldIndices;
+
+		// Referenced member -> the meta data that references it
+		TMap<FScopedName, TArray<FSource>> References;
+		// The reverse of References, for updating a single key when its value changes
+		TMap<TPair<int32, FName>, TArray<FScopedName>> ReferencedNames;
+
+		// Stable IDs (variable, graph, node and pin guids) to names, for detecting renames
+		TMap<FGuid, FTrackedName> TrackedNames;
+
+		// Entry node -> its params, built when first asked for
+		TMap<TObjectKey<UK2Node_EditablePinBase>, TArray<FName>> FunctionParams;
+	};
+
+	static FName GetFieldScope(const FMDMetaDataFieldReference& Field);
+	static FName GetReferenceScope(const FMDMetaDataFieldReference& Field);
+	static void GatherTrackedNames(const UBlueprint* Blueprint, TMap<FGuid, FTrackedName>& OutNames);
+
+	FBlueprintIndex* FindIndex(UBlueprint* Blueprint);
+	void EnsureBuilt(FBlueprintIndex& Index);
+	void IndexFieldKey(FBlueprintIndex& Index, int32 FieldIndex, FName Key, const FString* Value);
+	void RebuildFieldIndices(FBlueprintIndex& Index);
+
+	void RenameMember(FBlueprintIndex& Index, const FTrackedName& OldName, FName NewName);
+	// Invalidates the cached EditConditions that name a variable that was added, removed, renamed or retyped
+	void InvalidateEditConditions(FBlueprintIndex& Index, const TMap<FGuid, FTrackedName>& NewNames);
+
+	void OnBlueprintChanged(UBlueprint* Blueprint);
+	void OnBlueprintCompiled(UBlueprint* Blueprint);
+	void OnMetaDataChanged(TConstArrayView<FMDMetaDataChangeRecord> Records);
+
+	TMap<TObjectKey<UBlueprint>, FBlueprintIndex> BlueprintIndices;
+	bool bIsApplyingRenames = false;
+};
@@ -0,0 +1,391 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataTagRedirector.h"
+
+#include "Config/MDMetaDataEditorConfig.h"
+#include "ContentBrowserMenuContexts.h"
+#include "Customizations/MDMetaDataEditorFieldView.h"
+#include "Export/MDMetaDataExporter.h"
+#include "FileHelpers.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "GameplayTagsSettings.h"
+#include "Logging/MessageLog.h"
+#include "Logging/TokenizedMessage.h"
+#include "MDMetaDataEditorLibrary.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Styling/AppStyle.h"
+#include "ToolMenus.h"
+#include "UObject/Package.h"
+#include "Validation/MDMetaDataProjectValidator.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+namespace MDMDTR_Private
+{
+	const FName MenuOwner = TEXT("MDMetaDataTagRedirector");
+
+	// How many assets are loaded, and rewritten under one transaction, at a time
+	constexpr int32 BatchSize = 64;
+
+	void ParseTags(const FString& Value, TArray<FString>& OutTags)
+	{
+		Value.ParseIntoArray(OutTags, TEXT(","));
+		for (FString& Tag : OutTags)
+		{
+			Tag.TrimStartAndEndInline();
+		}
+	}
+}
+
+void FMDMetaDataTagIndex::Build(TConstArrayView<FAssetData> Assets)
+{
+	check(IsInGameThread());
+
+	TagValues.Reset();
+	TagValueIndices.Reset();
+
+	const TSharedRef<const FMDMetaDataEditorConfigSnapshot> Snapshot = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot();
+	TSet<FName> TagKeys;
+	FMDMetaDataTagRedirector::GatherTagKeys(*Snapshot, TagKeys);
+	if (TagKeys.IsEmpty())
+	{
+		return;
+	}
+
+	FMDMetaDataProjectValidator::GatherAssetFields(*Snapshot, Assets, true, INVTEXT("Finding Gameplay Tags in Meta Data..."), [this, &TagKeys](TArrayView<FMDMetaDataAssetFields> Batch)
+	{
+		for (const FMDMetaDataAssetFields& AssetFields : Batch)
+		{
+			AddTagValues(AssetFields.AssetPath, AssetFields.Fields, TagKeys);
+		}
+	});
+}
+
+void FMDMetaDataTagIndex::FindRewrites(const TMap<FName, FName>& Redirects, TArray<FMDMetaDataTagRewrite>& OutRewrites) const
+{
+	// A value can name several redirected tags but only needs to be rewritten once
+	TSet<int32> RedirectedValues;
+	TArray<int32> ValueIndices;
+	for (const TPair<FName, FName>& Redirect : Redirects)
+	{
+		ValueIndices.Reset();
+		TagValueIndices.MultiFind(Redirect.Key, ValueIndices);
+		RedirectedValues.Append(ValueIndices);
+	}
+
+	// Values were added asset by asset, so keep that order for the report
+	ValueIndices = RedirectedValues.Array();
+	ValueIndices.Sort();
+
+	for (const int32 ValueIndex : ValueIndices)
+	{
+		TOptional<FString> NewValue = FMDMetaDataTagRedirector::RedirectValue(TagValues[ValueIndex].Value.ToString(), Redirects);
+		if (NewValue.IsSet())
+		{
+			FMDMetaDataTagRewrite& Rewrite = OutRewrites.AddDefaulted_GetRef();
+			Rewrite.TagValue = TagValues[ValueIndex];
+			Rewrite.NewValue = MoveTemp(NewValue.GetValue());
+		}
+	}
+}
+
+void FMDMetaDataTagIndex::AddTagValues(const FSoftObjectPath& AssetPath, TConstArrayView<FMDMetaDataFieldSummary> Fields, const TSet<FName>& TagKeys)
+{
+	TArray<FString> Tags;
+	for (const FMDMetaDataFieldSummary& Field : Fields)
+	{
+		for (const TPair<FName, FString>& MetaDataPair : Field.MetaData)
+		{
+			if (!TagKeys.Contains(MetaDataPair.Key))
+			{
+				continue;
+			}
+
+			const int32 ValueIndex = TagValues.Num();
+			FMDMetaDataTagValue& TagValue = TagValues.AddDefaulted_GetRef();
+			TagValue.AssetPath = AssetPath;
+			TagValue.Usage = Field.Usage;
+			TagValue.ScopeName = Field.ScopeName;
+			TagValue.FieldName = Field.FieldName;
+			TagValue.Key = MetaDataPair.Key;
+			TagValue.Value = FMDMetaDataValue(MetaDataPair.Value);
+
+			Tags.Reset();
+			MDMDTR_Private::ParseTags(MetaDataPair.Value, Tags);
+			for (const FString& Tag : Tags)
+			{
+				if (!Tag.IsEmpty())
+				{
+					TagValueIndices.AddUnique(FName(*Tag), ValueIndex);
+				}
+			}
+		}
+	}
+}
+
+void FMDMetaDataTagRedirector::GatherRedirects(TMap<FName, FName>& OutRedirects)
+{
+	TMap<FName, FName> DirectRedirects;
+	for (const FGameplayTagRedirect& Redirect : GetDefault<UGameplayTagsSettings>()->GameplayTagRedirects)
+	{
+		// Redirects without a new tag remove the tag, which would leave keys like Categories matching everything
+		if (!Redirect.OldTagName.IsNone() && !Redirect.NewTagName.IsNone() && Redirect.OldTagName != Redirect.NewTagName)
+		{
+			DirectRedirects.Add(Redirect.OldTagName, Redirect.NewTagName);
+		}
+	}
+
+	for (const TPair<FName, FName>& Redirect : DirectRedirects)
+	{
+		FName NewTagName = Redirect.Value;
+		int32 NumSteps = 0;
+		while (const FName* NextTagName = DirectRedirects.Find(NewTagName))
+		{
+			// A cycle of redirects has no tag to end at
+			if (++NumSteps > DirectRedirects.Num())
+			{
+				NewTagName = NAME_None;
+				break;
+			}
+
+			NewTagName = *NextTagName;
+		}
+
+		if (!NewTagName.IsNone() && NewTagName != Redirect.Key)
+		{
+			OutRedirects.Add(Redirect.Key, NewTagName);
+		}
+	}
+}
+
+void FMDMetaDataTagRedirector::GatherTagKeys(const FMDMetaDataEditorConfigSnapshot& Snapshot, TSet<FName>& OutTagKeys)
+{
+	for (const FMDMetaDataEditorCompiledKey& CompiledKey : Snapshot.GetKeys())
+	{
+		if (CompiledKey.Key.KeyType == EMDMetaDataEditorKeyType::GameplayTag || CompiledKey.Key.KeyType == EMDMetaDataEditorKeyType::GameplayTagContainer)
+		{
+			OutTagKeys.Add(CompiledKey.Key.Key);
+		}
+	}
+}
+
+TOptional<FString> FMDMetaDataTagRedirector::RedirectValue(const FString& Value, const TMap<FName, FName>& Redirects)
+{
+	TArray<FString> Tags;
+	MDMDTR_Private::ParseTags(Value, Tags);
+
+	bool bWasRedirected = false;
+	for (FString& Tag : Tags)
+	{
+		// Tags that were never made into names can't have been redirected
+		const FName TagName(*Tag, FNAME_Find);
+		if (const FName* NewTagName = TagName.IsNone() ? nullptr : Redirects.Find(TagName))
+		{
+			Tag = NewTagName->ToString();
+			bWasRedirected = true;
+		}
+	}
+
+	if (!bWasRedirected)
+	{
+		return {};
+	}
+
+	return FString::Join(Tags, TEXT(","));
+}
+
+int32 FMDMetaDataTagRedirector::ApplyRewrites(TConstArrayView<FMDMetaDataTagRewrite> Rewrites, const TMap<FName, FName>& Redirects, bool bSavePackages, bool* bOutSaveFailed)
+{
+	check(IsInGameThread());
+
+	// Rewrites are grouped by asset
+	TArray<FSoftObjectPath> AssetPaths;
+	for (const FMDMetaDataTagRewrite& Rewrite : Rewrites)
+	{
+		if (AssetPaths.IsEmpty() || AssetPaths.Last() != Rewrite.TagValue.AssetPath)
+		{
+			AssetPaths.Add(Rewrite.TagValue.AssetPath);
+		}
+	}
+
+	TSet<FName> TagKeys;
+	GatherTagKeys(*GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot(), TagKeys);
+
+	FScopedSlowTask SlowTask(AssetPaths.Num(), INVTEXT("Redirecting Gameplay Tags in Meta Data..."));
+	SlowTask.MakeDialogDelayed(0.5f);
+
+	int32 NumChangedAssets = 0;
+	bool bSaveFailed = false;
+	for (int32 BatchStart = 0; BatchStart < AssetPaths.Num(); BatchStart += MDMDTR_Private::BatchSize)
+	{
+		const int32 BatchNum = FMath::Min(MDMDTR_Private::BatchSize, AssetPaths.Num() - BatchStart);
+		SlowTask.EnterProgressFrame(BatchNum);
+
+		TArray<UPackage*> ChangedPackages;
+		{
+			FMDMetaDataEditorBatchScope BatchScope(FText::Format(INVTEXT("Redirect Gameplay Tags in Meta Data [{0} Assets]"), FText::AsNumber(BatchNum)));
+			for (int32 Index = BatchStart; Index < BatchStart + BatchNum; ++Index)
+			{
+				UObject* Asset = AssetPaths[Index].TryLoad();
+				if (IsValid(Asset) && RewriteAsset(Asset, TagKeys, Redirects) > 0)
+				{
+					ChangedPackages.Add(Asset->GetPackage());
+				}
+			}
+		}
+
+		NumChangedAssets += ChangedPackages.Num();
+
+		if (bSavePackages && !ChangedPackages.IsEmpty() && !UEditorLoadingAndSavingUtils::SavePackages(ChangedPackages, true))
+		{
+			bSaveFailed = true;
+		}
+
+		// Rewritten assets are kept by the transaction, every other asset the batch loaded can go
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	if (bOutSaveFailed != nullptr)
+	{
+		*bOutSaveFailed = bSaveFailed;
+	}
+
+	return NumChangedAssets;
+}
+
+FText FMDMetaDataTagRedirector::DescribeRewrite(const FMDMetaDataTagRewrite& Rewrite)
+{
+	const FMDMetaDataTagValue& TagValue = Rewrite.TagValue;
+	const FText FieldText = TagValue.ScopeName.IsNone()
+		? FText::FromName(TagValue.FieldName)
+		: FText::Format(INVTEXT("{0}.{1}"), FText::FromName(TagValue.ScopeName), FText::FromName(TagValue.FieldName));
+
+	return FText::Format(INVTEXT("{0}: {1} \"{2}\" -> \"{3}\""), FieldText, FText::FromName(TagValue.Key), FText::FromString(TagValue.Value.ToString()), FText::FromString(Rewrite.NewValue));
+}
+
+void FMDMetaDataTagRedirector::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(MDMDTR_Private::MenuOwner);
+
+	UToolMenu* Menu = UToolMenus::Get()->ExtendMenu(TEXT("ContentBrowser.FolderContextMenu"));
+	FToolMenuSection& Section = Menu->FindOrAddSection(TEXT("PathContextBulkOperations"));
+	Section.AddDynamicEntry(TEXT("MDMetaDataTagRedirector"), FNewToolMenuSectionDelegate::CreateLambda([](FToolMenuSection& InSection)
+	{
+		const UContentBrowserFolderContext* Context = InSection.FindContext<UContentBrowserFolderContext>();
+		if (Context == nullptr || Context->GetSelectedPackagePaths().Num() == 0 || GetDefault<UGameplayTagsSettings>()->GameplayTagRedirects.IsEmpty())
+		{
+			return;
+		}
+
+		InSection.AddMenuEntry(
+			TEXT("MDPreviewMetaDataTagRedirects"),
+			INVTEXT("Preview Gameplay Tag Redirects in Meta Data"),
+			INVTEXT("List the GameplayTag meta data values, such as Categories, in the selected folders that name a redirected tag without changing them"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), TEXT("Icons.Search")),
+			FUIAction(FExecuteAction::CreateStatic(&FMDMetaDataTagRedirector::RedirectFolders, Context->GetSelectedPackagePaths(), true))
+		);
+
+		InSection.AddMenuEntry(
+			TEXT("MDApplyMetaDataTagRedirects"),
+			INVTEXT("Apply Gameplay Tag Redirects to Meta Data"),
+			INVTEXT("Rewrite the GameplayTag meta data values, such as Categories, in the selected folders that name a redirected tag"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), TEXT("Icons.Refresh")),
+			FUIAction(FExecuteAction::CreateStatic(&FMDMetaDataTagRedirector::RedirectFolders, Context->GetSelectedPackagePaths(), false))
+		);
+	}));
+}
+
+void FMDMetaDataTagRedirector::UnregisterMenus()
+{
+	if (UToolMenus* ToolMenus = UToolMenus::TryGet())
+	{
+		ToolMenus->UnregisterOwnerByName(MDMDTR_Private::MenuOwner);
+	}
+}
+
+int32 FMDMetaDataTagRedirector::RewriteAsset(UObject* Asset, const TSet<FName>& TagKeys, const TMap<FName, FName>& Redirects)
+{
+	int32 NumChangedFields = 0;
+
+	TArray<FMDMetaDataFieldReference> Fields;
+	UMDMetaDataEditorLibrary::GetMetaDataFields(Asset, Fields);
+
+	TArray<TPair<FName, FString>> NewValues;
+	for (const FMDMetaDataFieldReference& Field : Fields)
+	{
+		const TSharedPtr<FMDMetaDataEditorFieldView> FieldView = UMDMetaDataEditorLibrary::MakeFieldView(Field);
+		const TMap<FName, FString>* MetaDataMap = FieldView.IsValid() ? FieldView->GetMetadataMap() : nullptr;
+		if (MetaDataMap == nullptr || FieldView->IsReadOnly())
+		{
+			continue;
+		}
+
+		// Setting values can reallocate the map, so find them all first
+		NewValues.Reset();
+		for (const TPair<FName, FString>& MetaDataPair : *MetaDataMap)
+		{
+			if (TagKeys.Contains(MetaDataPair.Key))
+			{
+				if (TOptional<FString> NewValue = RedirectValue(MetaDataPair.Value, Redirects))
+				{
+					NewValues.Emplace(MetaDataPair.Key, MoveTemp(NewValue.GetValue()));
+				}
+			}
+		}
+
+		for (const TPair<FName, FString>& NewValue : NewValues)
+		{
+			FieldView->SetMetadataValue(NewValue.Key, NewValue.Value);
+		}
+
+		if (!NewValues.IsEmpty())
+		{
+			++NumChangedFields;
+		}
+	}
+
+	return NumChangedFields;
+}
+
+void FMDMetaDataTagRedirector::RedirectFolders(TArray<FString> PackagePaths, bool bDryRun)
+{
+	TMap<FName, FName> Redirects;
+	GatherRedirects(Redirects);
+
+	TArray<FAssetData> Assets;
+	FMDMetaDataExporter::GatherAssets(PackagePaths, Assets);
+
+	FMDMetaDataTagIndex TagIndex;
+	TagIndex.Build(Assets);
+
+	TArray<FMDMetaDataTagRewrite> Rewrites;
+	TagIndex.FindRewrites(Redirects, Rewrites);
+
+	FMessageLog AssetCheck(TEXT("AssetCheck"));
+	AssetCheck.NewPage(bDryRun ? INVTEXT("Gameplay Tag Redirects in Meta Data (Preview)") : INVTEXT("Gameplay Tag Redirects in Meta Data"));
+	for (const FMDMetaDataTagRewrite& Rewrite : Rewrites)
+	{
+		AssetCheck.Info()
+			->AddToken(FAssetNameToken::Create(Rewrite.TagValue.AssetPath.ToString()))
+			->AddToken(FTextToken::Create(DescribeRewrite(Rewrite)));
+	}
+
+	FText Message;
+	if (bDryRun)
+	{
+		Message = FText::Format(INVTEXT("Found {0} meta data values to redirect"), FText::AsNumber(Rewrites.Num()));
+	}
+	else
+	{
+		const int32 NumChangedAssets = ApplyRewrites(Rewrites, Redirects, false);
+		Message = FText::Format(INVTEXT("Redirected {0} meta data values in {1} assets"), FText::AsNumber(Rewrites.Num()), FText::AsNumber(NumChangedAssets));
+	}
+
+	if (!Rewrites.IsEmpty())
+	{
+		AssetCheck.Open(EMessageSeverity::Info);
+	}
+
+	FNotificationInfo Info(Message);
+	Info.ExpireDuration = 5.f;
+	FSlateNotificationManager::Get().AddNotification(Info);
+}
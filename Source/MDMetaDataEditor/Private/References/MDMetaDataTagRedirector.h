@@ -0,0 +1,83 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
+#include "MDMetaDataValuePool.h"
+
+class FMessageLog;
+
+// The value of a GameplayTag or GameplayTagContainer key on a single field, fields are identified the same way as in FMDMetaDataFieldSummary
+struct FMDMetaDataTagValue
+{
+	FSoftObjectPath AssetPath;
+	EMDMetaDataKeyUsage Usage = EMDMetaDataKeyUsage::None;
+	FName ScopeName = NAME_None;
+	FName FieldName = NAME_None;
+
+	FName Key = NAME_None;
+	// Interned, tag lists like Categories repeat across most of the fields that use them
+	FMDMetaDataValue Value;
+};
+
+struct FMDMetaDataTagRewrite
+{
+	FMDMetaDataTagValue TagValue;
+	FString NewValue;
+};
+
+/**
+ * Every tag-valued meta data value of a set of assets, indexed by the tags they name so applying redirects only visits the values that use them.
+ * Built from the asset registry summaries, only assets without an up to date summary are loaded.
+ */
+class FMDMetaDataTagIndex
+{
+public:
+	// Must be called on the game thread
+	void Build(TConstArrayView<FAssetData> Assets);
+
+	// Finds the values that name a redirected tag, grouped by asset
+	void FindRewrites(const TMap<FName, FName>& Redirects, TArray<FMDMetaDataTagRewrite>& OutRewrites) const;
+
+	int32 GetNumValues() const { return TagValues.Num(); }
+
+private:
+	void AddTagValues(const FSoftObjectPath& AssetPath, TConstArrayView<FMDMetaDataFieldSummary> Fields, const TSet<FName>& TagKeys);
+
+	TArray<FMDMetaDataTagValue> TagValues;
+	TMultiMap<FName, int32> TagValueIndices;
+};
+
+/**
+ * Applies the project's GameplayTag redirects to the values of GameplayTag and GameplayTagContainer meta data keys, such as Categories.
+ * Available from the content browser and headless through UMDMetaDataTagRedirectCommandlet.
+ */
+class FMDMetaDataTagRedirector
+{
+public:
+	// Old tag -> the tag it ends up at once chained redirects are followed
+	static void GatherRedirects(TMap<FName, FName>& OutRedirects);
+
+	// The names of the keys whose values are tags
+	static void GatherTagKeys(const FMDMetaDataEditorConfigSnapshot& Snapshot, TSet<FName>& OutTagKeys);
+
+	// Returns the value with each redirected tag replaced, or an unset optional if it doesn't name any redirected tags
+	static TOptional<FString> RedirectValue(const FString& Value, const TMap<FName, FName>& Redirects);
+
+	// Loads the assets of the rewrites and rewrites their tag-valued meta data, with a transaction per batch of assets.
+	// Values are redirected again from the loaded assets, so stale rewrites are skipped. Returns the number of assets that were changed.
+	// Garbage is collected after each batch. If bOutSaveFailed is set, it's set to whether any of the changed packages failed to save.
+	static int32 ApplyRewrites(TConstArrayView<FMDMetaDataTagRewrite> Rewrites, const TMap<FName, FName>& Redirects, bool bSavePackages, bool* bOutSaveFailed = nullptr);
+
+	static FText DescribeRewrite(const FMDMetaDataTagRewrite& Rewrite);
+
+	static void RegisterMenus();
+	static void UnregisterMenus();
+
+private:
+	// Returns the number of fields that were changed
+	static int32 RewriteAsset(UObject* Asset, const TSet<FName>& TagKeys, const TMap<FName, FName>& Redirects);
+
+	static void RedirectFolders(TArray<FString> PackagePaths, bool bDryRun);
+};
@@ -0,0 +1,48 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataClipboard.h"
+
+#include "CoreGlobals.h"
+#include "HAL/PlatformApplicationMisc.h"
+
+FMDMetaDataClipboardSnapshot FMDMetaDataClipboard::Snapshot;
+uint64 FMDMetaDataClipboard::LastQueryFrame = 0;
+
+TOptional<FString> FMDMetaDataClipboardSnapshot::FindValueForKey(FName Key) const
+{
+	if (HasSpecifierList())
+	{
+		// Only paste if the clipboard has meta data for this key
+		const FMDMetaDataSpecifier* Specifier = List.Find(Key);
+		return (Specifier != nullptr) ? Specifier->Value : TOptional<FString>();
+	}
+
+	// Clipboard is just the value
+	if (Text.IsEmpty())
+	{
+		return {};
+	}
+
+	return Text.TrimQuotes().ReplaceEscapedCharWithChar();
+}
+
+const FMDMetaDataClipboardSnapshot& FMDMetaDataClipboard::GetSnapshot()
+{
+	// An open menu queries its actions every frame, so only re-read the clipboard after a gap in queries (the next time a menu is opened)
+	const uint64 Frame = GFrameCounter;
+	if (Frame > LastQueryFrame + 1 || Frame < LastQueryFrame)
+	{
+		FString Clipboard;
+		FPlatformApplicationMisc::ClipboardPaste(Clipboard);
+		Clipboard.TrimStartAndEndInline();
+
+		if (Clipboard != Snapshot.Text)
+		{
+			Snapshot.Text = MoveTemp(Clipboard);
+			Snapshot.bIsParsed = FMDMetaDataSpecifierParser::Parse(Snapshot.Text, Snapshot.List);
+		}
+	}
+
+	LastQueryFrame = Frame;
+	return Snapshot;
+}
@@ -0,0 +1,33 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Types/MDMetaDataSpecifierParser.h"
+
+struct FMDMetaDataClipboardSnapshot
+{
+	// The trimmed clipboard text
+	FString Text;
+
+	// Only valid if bIsParsed
+	FMDMetaDataSpecifierList List;
+	bool bIsParsed = false;
+
+	// Resolves the value to paste into a single key's row, either from a matching Key=Value or the raw clipboard text
+	TOptional<FString> FindValueForKey(FName Key) const;
+
+	bool HasSpecifierList() const { return bIsParsed && List.IsSpecifierList(); }
+};
+
+/**
+ * Reads and parses the OS clipboard once per menu rather than on every copy/paste action query
+ */
+class FMDMetaDataClipboard
+{
+public:
+	static const FMDMetaDataClipboardSnapshot& GetSnapshot();
+
+private:
+	static FMDMetaDataClipboardSnapshot Snapshot;
+	static uint64 LastQueryFrame;
+};
@@ -6,6 +6,18 @@
 #include "EdGraph/EdGraphPin.h"
 #include "EdGraphSchema_K2.h"
 
+namespace MDMDPT_Private
+{
+	// Struct paths are compared instead of calling IsChildOf, so matching doesn't need the structs
+	void AddStructPaths(const UStruct* Struct, TArray<FTopLevelAssetPath>& OutPaths)
+	{
+		for (; Struct != nullptr; Struct = Struct->GetSuperStruct())
+		{
+			OutPaths.Emplace(Struct->GetStructPathName());
+		}
+	}
+}
+
 FMDMetaDataEditorPropertyType::FMDMetaDataEditorPropertyType(
 	FName PropertyType,
 	FName PropertySubType,
@@ -130,39 +142,128 @@ void FMDMetaDataEditorPropertyType::SetFromGraphTerminalType(const FEdGraphTermi
 	PropertySubTypeObject = GraphTerminalType.TerminalSubCategoryObject.Get();
 }
 
+const UEnum* FMDMetaDataEditorPropertyType::GetPropertyEnum(const FProperty* Property)
+{
+	if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+	{
+		return EnumProperty->GetEnum();
+	}
+	else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+	{
+		return ByteProperty->Enum;
+	}
+
+	return nullptr;
+}
+
 bool FMDMetaDataEditorPropertyType::DoesMatchProperty(const FProperty* Property) const
 {
-	if (Property == nullptr)
+	return FMDMetaDataEditorCompiledPropertyType(*this).DoesMatchProperty(Property);
+}
+
+bool FMDMetaDataEditorPropertyType::operator==(const FMDMetaDataEditorPropertyType& Other) const
+{
+	return PropertyType == Other.PropertyType
+		&& PropertySubType == Other.PropertySubType
+		&& PropertySubTypeObject == Other.PropertySubTypeObject
+		&& PropertySubTypeMemberReference == Other.PropertySubTypeMemberReference
+		&& ValueType == Other.ValueType
+		&& ContainerType == Other.ContainerType;
+}
+
+FMDMetaDataResolvedPinType::FMDMetaDataResolvedPinType(const FEdGraphPinType& PinType)
+	: PinCategory(PinType.PinCategory)
+	, PinSubCategory(PinType.PinSubCategory)
+	, ContainerType(PinType.ContainerType)
+	, PinSubCategoryMemberParentPath(PinType.PinSubCategoryMemberReference.MemberParent.Get())
+	, PinSubCategoryMemberName(PinType.PinSubCategoryMemberReference.MemberName)
+	, PinSubCategoryMemberGuid(PinType.PinSubCategoryMemberReference.MemberGuid)
+{
+	check(IsInGameThread());
+
+	const UObject* SubCategoryObject = PinType.PinSubCategoryObject.Get();
+	if (const UScriptStruct* Struct = Cast<UScriptStruct>(SubCategoryObject))
 	{
-		return false;
+		SubCategoryObjectType = EMDMetaDataResolvedObjectType::ScriptStruct;
+		MDMDPT_Private::AddStructPaths(Struct, SubCategoryObjectPaths);
+	}
+	else if (const UClass* Class = Cast<UClass>(SubCategoryObject))
+	{
+		SubCategoryObjectType = EMDMetaDataResolvedObjectType::Class;
+		MDMDPT_Private::AddStructPaths(Class, SubCategoryObjectPaths);
+	}
+	else if (const UEnum* Enum = Cast<UEnum>(SubCategoryObject))
+	{
+		SubCategoryObjectType = EMDMetaDataResolvedObjectType::Enum;
+		SubCategoryObjectPaths.Emplace(FSoftObjectPath(Enum).GetAssetPath());
+
+		EnumValueNames.Reserve(Enum->NumEnums());
+		for (int32 Index = 0; Index < Enum->NumEnums(); ++Index)
+		{
+			EnumValueNames.Add(Enum->GetNameByIndex(Index));
+		}
+	}
+	else if (SubCategoryObject != nullptr)
+	{
+		SubCategoryObjectType = EMDMetaDataResolvedObjectType::Other;
+		SubCategoryObjectPaths.Emplace(FSoftObjectPath(SubCategoryObject).GetAssetPath());
+	}
+
+	// Class properties are object properties too, their property class is UClass
+	if (PinCategory == UEdGraphSchema_K2::PC_Class || PinCategory == UEdGraphSchema_K2::PC_SoftClass)
+	{
+		MDMDPT_Private::AddStructPaths(UClass::StaticClass(), PropertyClassPaths);
+	}
+	else if (SubCategoryObjectType == EMDMetaDataResolvedObjectType::Class)
+	{
+		PropertyClassPaths = SubCategoryObjectPaths;
+	}
+
+	if (ContainerType == EPinContainerType::Map)
+	{
+		ValueType = MakeShared<const FMDMetaDataResolvedPinType>(FEdGraphPinType::GetPinTypeForTerminalType(PinType.PinValueType));
+	}
+}
+
+FMDMetaDataEditorCompiledPropertyType::FMDMetaDataEditorCompiledPropertyType(const FMDMetaDataEditorPropertyType& InPropertyType)
+	: PropertyType(InPropertyType.PropertyType)
+	, PropertySubType(InPropertyType.PropertySubType)
+	, PropertySubTypePath(InPropertyType.PropertySubTypeObject.ToSoftObjectPath().GetAssetPath())
+	, bMatchesAnyEnum(PropertySubTypePath == UEnum::StaticClass()->GetClassPathName())
+	, PropertySubTypeMemberParentPath(InPropertyType.PropertySubTypeMemberReference.MemberParent.Get())
+	, PropertySubTypeMemberName(InPropertyType.PropertySubTypeMemberReference.MemberName)
+	, PropertySubTypeMemberGuid(InPropertyType.PropertySubTypeMemberReference.MemberGuid)
+	, ContainerType(InPropertyType.ContainerType)
+{
+	if (const FMDMetaDataEditorPropertyType* ValueTypePtr = InPropertyType.ValueType.GetPtr<FMDMetaDataEditorPropertyType>())
+	{
+		ValueType = MakeShared<FMDMetaDataEditorCompiledPropertyType>(*ValueTypePtr);
 	}
+}
 
-	const FProperty* EffectiveProp = Property;
+bool FMDMetaDataEditorCompiledPropertyType::DoesMatchPinType(const FMDMetaDataResolvedPinType& PinType) const
+{
+	const bool bIsArrayPin = PinType.ContainerType == EPinContainerType::Array;
+	const bool bIsSetPin = PinType.ContainerType == EPinContainerType::Set;
+	const bool bIsMapPin = PinType.ContainerType == EPinContainerType::Map;
 
-	if (ContainerType == EMDMetaDataPropertyContainerType::Array || Property->IsA<FArrayProperty>())
+	if (ContainerType == EMDMetaDataPropertyContainerType::Array || bIsArrayPin)
 	{
-		const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property);
-		if (ArrayProperty == nullptr)
+		if (!bIsArrayPin)
 		{
 			return false;
 		}
-
-		EffectiveProp = ArrayProperty->Inner;
 	}
-	else if (ContainerType == EMDMetaDataPropertyContainerType::Set || Property->IsA<FSetProperty>())
+	else if (ContainerType == EMDMetaDataPropertyContainerType::Set || bIsSetPin)
 	{
-		const FSetProperty* SetProperty = CastField<FSetProperty>(Property);
-		if (SetProperty == nullptr)
+		if (!bIsSetPin)
 		{
 			return false;
 		}
-
-		EffectiveProp = SetProperty->ElementProp;
 	}
-	else if (ContainerType == EMDMetaDataPropertyContainerType::Map || Property->IsA<FMapProperty>())
+	else if (ContainerType == EMDMetaDataPropertyContainerType::Map || bIsMapPin)
 	{
-		const FMapProperty* MapProperty = CastField<FMapProperty>(Property);
-		if (MapProperty == nullptr)
+		if (!bIsMapPin)
 		{
 			return false;
 		}
@@ -170,16 +271,16 @@ bool FMDMetaDataEditorPropertyType::DoesMatchProperty(const FProperty* Property)
 		// Only validate ValueType if we're explicitly checking for a map
 		if (ContainerType == EMDMetaDataPropertyContainerType::Map)
 		{
-			const FMDMetaDataEditorPropertyType* ValueTypePtr = ValueType.GetPtr<FMDMetaDataEditorPropertyType>();
-			if (ValueTypePtr == nullptr || !ValueTypePtr->DoesMatchProperty(MapProperty->ValueProp))
+			if (!ValueType.IsValid() || !PinType.ValueType.IsValid() || !ValueType->DoesMatchPinType(*PinType.ValueType))
 			{
 				return false;
 			}
 		}
-
-		EffectiveProp = MapProperty->KeyProp;
 	}
 
+	const FName& PinCategory = PinType.PinCategory;
+	const bool bHasPropertySubTypeObject = PropertySubTypePath.IsValid();
+
 	if (PropertyType == UEdGraphSchema_K2::PC_Wildcard)
 	{
 		return true;
@@ -187,13 +288,12 @@ bool FMDMetaDataEditorPropertyType::DoesMatchProperty(const FProperty* Property)
 
 	if (PropertyType == UEdGraphSchema_K2::PC_Struct)
 	{
-		const FStructProperty* StructProperty = CastField<FStructProperty>(EffectiveProp);
-		if (StructProperty == nullptr || StructProperty->Struct == nullptr)
+		if (PinCategory != UEdGraphSchema_K2::PC_Struct || PinType.SubCategoryObjectType != EMDMetaDataResolvedObjectType::ScriptStruct)
 		{
 			return false;
 		}
 
-		if (PropertySubTypeObject.IsNull() || StructProperty->Struct->IsChildOf(Cast<UStruct>(PropertySubTypeObject.Get())))
+		if (!bHasPropertySubTypeObject || PinType.SubCategoryObjectPaths.Contains(PropertySubTypePath))
 		{
 			return true;
 		}
@@ -201,16 +301,19 @@ bool FMDMetaDataEditorPropertyType::DoesMatchProperty(const FProperty* Property)
 
 	if (PropertyType == UEdGraphSchema_K2::PC_Object || PropertyType == UEdGraphSchema_K2::PC_SoftObject)
 	{
-		const FObjectPropertyBase* ObjectProperty = (PropertyType == UEdGraphSchema_K2::PC_Object)
-			? CastField<FObjectPropertyBase>(EffectiveProp)
-			: CastField<FSoftObjectProperty>(EffectiveProp);
+		const bool bIsSoftPin = PinCategory == UEdGraphSchema_K2::PC_SoftObject || PinCategory == UEdGraphSchema_K2::PC_SoftClass;
+		const bool bIsObjectPin = bIsSoftPin || PinCategory == UEdGraphSchema_K2::PC_Object || PinCategory == UEdGraphSchema_K2::PC_Class;
+		if ((PropertyType == UEdGraphSchema_K2::PC_Object) ? !bIsObjectPin : !bIsSoftPin)
+		{
+			return false;
+		}
 
-		if (ObjectProperty == nullptr || ObjectProperty->PropertyClass == nullptr)
+		if (PinType.PropertyClassPaths.IsEmpty())
 		{
 			return false;
 		}
 
-		if (PropertySubTypeObject.IsNull() || ObjectProperty->PropertyClass->IsChildOf(Cast<UClass>(PropertySubTypeObject.Get())))
+		if (!bHasPropertySubTypeObject || PinType.PropertyClassPaths.Contains(PropertySubTypePath))
 		{
 			return true;
 		}
@@ -218,73 +321,69 @@ bool FMDMetaDataEditorPropertyType::DoesMatchProperty(const FProperty* Property)
 
 	if (PropertyType == UEdGraphSchema_K2::PC_Class || PropertyType == UEdGraphSchema_K2::PC_SoftClass)
 	{
-		if (PropertyType == UEdGraphSchema_K2::PC_Class && !EffectiveProp->IsA<FClassProperty>())
-		{
-			return false;
-		}
-
-		if (PropertyType == UEdGraphSchema_K2::PC_SoftClass && !EffectiveProp->IsA<FSoftClassProperty>())
-		{
-			return false;
-		}
-
-		const UClass* MetaClass = (PropertyType == UEdGraphSchema_K2::PC_Class)
-			? CastField<FClassProperty>(EffectiveProp)->MetaClass
-			: CastField<FSoftClassProperty>(EffectiveProp)->MetaClass;
-		if (MetaClass == nullptr)
+		if (PinCategory != PropertyType || PinType.SubCategoryObjectType != EMDMetaDataResolvedObjectType::Class)
 		{
 			return false;
 		}
 
-		if (PropertySubTypeObject.IsNull() || MetaClass->IsChildOf(Cast<UClass>(PropertySubTypeObject.Get())))
+		if (!bHasPropertySubTypeObject || PinType.SubCategoryObjectPaths.Contains(PropertySubTypePath))
 		{
 			return true;
 		}
 	}
 
-	if (PropertyType == UEdGraphSchema_K2::PC_Enum || (PropertyType == UEdGraphSchema_K2::PC_Byte && PropertySubTypeObject.IsValid()))
+	if (PropertyType == UEdGraphSchema_K2::PC_Enum || (PropertyType == UEdGraphSchema_K2::PC_Byte && bHasPropertySubTypeObject))
 	{
-		const UEnum* PropertyEnum = [Property]() -> const UEnum*
-		{
-			if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
-			{
-				return EnumProperty->GetEnum();
-			}
-			else if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
-			{
-				return ByteProperty->Enum;
-			}
-
-			return nullptr;
-		}();
-
-		if (!IsValid(PropertyEnum))
+		// The enum comes from the property itself rather than its elements, so containers of enums don't match
+		const bool bIsEnumPin = PinType.ContainerType == EPinContainerType::None
+			&& (PinCategory == UEdGraphSchema_K2::PC_Enum || PinCategory == UEdGraphSchema_K2::PC_Byte)
+			&& PinType.SubCategoryObjectType == EMDMetaDataResolvedObjectType::Enum;
+		if (!bIsEnumPin)
 		{
 			return false;
 		}
 
-		return PropertySubTypeObject == UEnum::StaticClass() || PropertySubTypeObject == PropertyEnum;
+		return bMatchesAnyEnum || PropertySubTypePath == PinType.GetSubCategoryObjectPath();
 	}
 
-	const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
-	FEdGraphPinType PinType;
-	if (!K2Schema->ConvertPropertyToPinType(EffectiveProp, PinType))
+	return PropertyType == PinCategory
+		&& PropertySubType == PinType.PinSubCategory
+		&& PropertySubTypePath == PinType.GetSubCategoryObjectPath()
+		&& PropertySubTypeMemberParentPath == PinType.PinSubCategoryMemberParentPath
+		&& PropertySubTypeMemberName == PinType.PinSubCategoryMemberName
+		&& PropertySubTypeMemberGuid == PinType.PinSubCategoryMemberGuid;
+}
+
+bool FMDMetaDataEditorCompiledPropertyType::DoesMatchProperty(const FProperty* Property) const
+{
+	if (Property == nullptr)
 	{
 		return false;
 	}
 
-	return PropertyType == PinType.PinCategory
-		&& PropertySubType == PinType.PinSubCategory
-		&& PropertySubTypeObject.Get() == PinType.PinSubCategoryObject
-		&& PropertySubTypeMemberReference == PinType.PinSubCategoryMemberReference;
-}
+	FEdGraphPinType PinType;
+	if (GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(Property, PinType))
+	{
+		return DoesMatchPinType(FMDMetaDataResolvedPinType(PinType));
+	}
 
-bool FMDMetaDataEditorPropertyType::operator==(const FMDMetaDataEditorPropertyType& Other) const
-{
-	return PropertyType == Other.PropertyType
-		&& PropertySubType == Other.PropertySubType
-		&& PropertySubTypeObject == Other.PropertySubTypeObject
-		&& PropertySubTypeMemberReference == Other.PropertySubTypeMemberReference
-		&& ValueType == Other.ValueType
-		&& ContainerType == Other.ContainerType;
+	if (PropertyType != UEdGraphSchema_K2::PC_Wildcard)
+	{
+		return false;
+	}
+
+	switch (ContainerType)
+	{
+	case EMDMetaDataPropertyContainerType::Array:
+		return Property->IsA<FArrayProperty>();
+	case EMDMetaDataPropertyContainerType::Set:
+		return Property->IsA<FSetProperty>();
+	case EMDMetaDataPropertyContainerType::Map:
+	{
+		const FMapProperty* MapProperty = CastField<FMapProperty>(Property);
+		return MapProperty != nullptr && ValueType.IsValid() && ValueType->DoesMatchProperty(MapProperty->ValueProp);
+	}
+	default:
+		return true;
+	}
 }
@@ -3,6 +3,9 @@
 #pragma once
 
 #include "EdGraph/EdGraphPin.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/SoftObjectPath.h"
+#include "UObject/TopLevelAssetPath.h"
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
 #include "StructUtils/InstancedStruct.h"
 #else
@@ -48,6 +51,9 @@ public:
 
 	bool DoesMatchProperty(const FProperty* Property) const;
 
+	// The enum of an enum property or a byte property with an enum, otherwise null
+	static const UEnum* GetPropertyEnum(const FProperty* Property);
+
 	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor")
 	FName PropertyType = NAME_None;
 
@@ -88,3 +94,74 @@ public:
 		return Hash;
 	}
 };
+
+enum class EMDMetaDataResolvedObjectType : uint8
+{
+	None,
+	ScriptStruct,
+	Class,
+	Enum,
+	Other
+};
+
+/**
+ * A pin type with its sub category objects reduced to paths.
+ * Must be created on the game thread, but can then be matched against property types from any thread.
+ */
+struct FMDMetaDataResolvedPinType
+{
+	explicit FMDMetaDataResolvedPinType(const FEdGraphPinType& PinType);
+
+	FTopLevelAssetPath GetSubCategoryObjectPath() const { return SubCategoryObjectPaths.IsEmpty() ? FTopLevelAssetPath() : SubCategoryObjectPaths[0]; }
+
+	FName PinCategory = NAME_None;
+	FName PinSubCategory = NAME_None;
+	EPinContainerType ContainerType = EPinContainerType::None;
+
+	EMDMetaDataResolvedObjectType SubCategoryObjectType = EMDMetaDataResolvedObjectType::None;
+
+	// The sub category object followed by its super structs
+	TArray<FTopLevelAssetPath> SubCategoryObjectPaths;
+
+	// The class of the objects an object or class pin holds followed by its super classes, UClass for class pins
+	TArray<FTopLevelAssetPath> PropertyClassPaths;
+
+	// The names of the enum's values if the sub category object is an enum, so values can be checked without it
+	TArray<FName> EnumValueNames;
+
+	FSoftObjectPath PinSubCategoryMemberParentPath;
+	FName PinSubCategoryMemberName = NAME_None;
+	FGuid PinSubCategoryMemberGuid;
+
+	// Only set for maps
+	TSharedPtr<const FMDMetaDataResolvedPinType> ValueType;
+};
+
+/**
+ * A supported property type with its sub type object kept as a path, so it can be matched from any thread without touching soft pointers.
+ * This is the one place property types are matched, FMDMetaDataEditorPropertyType::DoesMatchProperty goes through it too.
+ */
+struct FMDMetaDataEditorCompiledPropertyType
+{
+	explicit FMDMetaDataEditorCompiledPropertyType(const FMDMetaDataEditorPropertyType& InPropertyType);
+
+	// Tests the pin type of a property, for containers the pin category describes the element (or map key) type
+	bool DoesMatchPinType(const FMDMetaDataResolvedPinType& PinType) const;
+
+	// Properties that can't be described by a pin type can only match wildcards, must be called on the game thread
+	bool DoesMatchProperty(const FProperty* Property) const;
+
+	FName PropertyType = NAME_None;
+	FName PropertySubType = NAME_None;
+	FTopLevelAssetPath PropertySubTypePath;
+
+	// Enum types with UEnum itself as the sub type match every enum
+	bool bMatchesAnyEnum = false;
+
+	FSoftObjectPath PropertySubTypeMemberParentPath;
+	FName PropertySubTypeMemberName = NAME_None;
+	FGuid PropertySubTypeMemberGuid;
+
+	TSharedPtr<const FMDMetaDataEditorCompiledPropertyType> ValueType;
+	EMDMetaDataPropertyContainerType ContainerType = EMDMetaDataPropertyContainerType::None;
+};
@@ -0,0 +1,65 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEnumCache.h"
+
+#include "Engine/UserDefinedEnum.h"
+
+const FMDMetaDataEnumEntry* FMDMetaDataEnumEntryTable::FindEntry(FStringView Name) const
+{
+	int32 SeparatorIndex = INDEX_NONE;
+	if (Name.FindLastChar(TEXT(':'), SeparatorIndex))
+	{
+		Name.RightChopInline(SeparatorIndex + 1);
+	}
+
+	const int32* EntryIndex = EntryIndices.Find(FName(Name));
+	return (EntryIndex != nullptr) ? &Entries[*EntryIndex] : nullptr;
+}
+
+TSharedRef<const FMDMetaDataEnumEntryTable> FMDMetaDataEnumCache::FindOrBuild(const UEnum* Enum)
+{
+	if (!IsValid(Enum))
+	{
+		return MakeShared<const FMDMetaDataEnumEntryTable>();
+	}
+
+	if (const TSharedRef<const FMDMetaDataEnumEntryTable>* Table = Tables.Find(Enum))
+	{
+		return *Table;
+	}
+
+	TSharedRef<FMDMetaDataEnumEntryTable> Table = MakeShared<FMDMetaDataEnumEntryTable>();
+
+	const int32 NumEntries = Enum->ContainsExistingMax() ? Enum->NumEnums() - 1 : Enum->NumEnums();
+	Table->Entries.Reserve(NumEntries);
+	Table->EntryIndices.Reserve(NumEntries);
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		if (Enum->HasMetaData(TEXT("Hidden"), Index))
+		{
+			continue;
+		}
+
+		const FName Name = FName(Enum->GetNameStringByIndex(Index));
+		Table->EntryIndices.Add(Name, Table->Entries.Num());
+		Table->Entries.Add(FMDMetaDataEnumEntry{ Name, Enum->GetDisplayNameTextByIndex(Index) });
+	}
+
+	Tables.Add(Enum, Table);
+	return Table;
+}
+
+void FMDMetaDataEnumCache::Invalidate(const UEnum* Enum)
+{
+	Tables.Remove(Enum);
+}
+
+void FMDMetaDataEnumCache::PreChange(const UUserDefinedEnum* Enum, FEnumEditorUtils::EEnumEditorChangeInfo Info)
+{
+}
+
+void FMDMetaDataEnumCache::PostChange(const UUserDefinedEnum* Enum, FEnumEditorUtils::EEnumEditorChangeInfo Info)
+{
+	// Entries may have been added, removed, reordered or renamed
+	Invalidate(Enum);
+}
@@ -0,0 +1,44 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Kismet2/EnumEditorUtils.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
+
+struct FMDMetaDataEnumEntry
+{
+	// The short name that meta data values use, eg. ValidEnumValues="Foo,Bar"
+	FName Name = NAME_None;
+	FText DisplayName;
+};
+
+struct FMDMetaDataEnumEntryTable
+{
+	// The enum's selectable entries, without hidden entries or the generated _MAX
+	TArray<FMDMetaDataEnumEntry> Entries;
+
+	// Entry name -> index into Entries
+	TMap<FName, int32> EntryIndices;
+
+	// Accepts short names and qualified names like EMyEnum::Foo
+	const FMDMetaDataEnumEntry* FindEntry(FStringView Name) const;
+};
+
+/**
+ * Parsed entry tables per enum, so pickers for enums with hundreds of entries don't rebuild them for every row.
+ * User Defined Enums are rebuilt after they're edited. Must only be used from the game thread.
+ */
+class FMDMetaDataEnumCache : public FEnumEditorUtils::INotifyOnEnumChanged, public TSharedFromThis<FMDMetaDataEnumCache>
+{
+public:
+	TSharedRef<const FMDMetaDataEnumEntryTable> FindOrBuild(const UEnum* Enum);
+
+	void Invalidate(const UEnum* Enum);
+
+	virtual void PreChange(const UUserDefinedEnum* Enum, FEnumEditorUtils::EEnumEditorChangeInfo Info) override;
+	virtual void PostChange(const UUserDefinedEnum* Enum, FEnumEditorUtils::EEnumEditorChangeInfo Info) override;
+
+private:
+	TMap<TObjectKey<UEnum>, TSharedRef<const FMDMetaDataEnumEntryTable>> Tables;
+};
@@ -27,23 +27,39 @@ enum class EMDMetaDataEditorKeyType : uint8
 	// The meta data value is one or more user-specified Gameplay Tags
 	GameplayTagContainer,
 	// The meta data value is selected from the list of specified values
-	ValueList
-	// TODO - The meta data value is a UStruct path
-	// Struct,
-	// TODO - The meta data value is a UClass path
-	// Class,
-	// TODO - The meta data value is a UInterface path
-	// Interface,
+	ValueList,
+	// The meta data value is one or more UStruct paths
+	Struct,
+	// The meta data value is one or more UClass paths
+	Class,
+	// The meta data value is one or more UInterface paths
+	Interface,
+	// The meta data value is the name of one or more params on this function
+	Param,
+	// The meta data value is one or more values of the property's enum
+	EnumValue
 	// TODO - The meta data value is a UEnum path
 	// Enum,
-	// TODO - The meta data value is a value of a specific enum (maybe always of the property? Let user select UEnum if property isn't an enum?)
-	// EnumValue,
-	// TODO - The meta data value is the name of a param on this function
-	// Param,
 	// TODO - Provide a custom Struct that creates the editor widget and sets the value of the meta data
 	// Custom,
 };
 
+// What the value of a String meta data key names, so it can be checked when Blueprints are compiled
+UENUM()
+enum class EMDMetaDataValueReference : uint8
+{
+	// The value isn't checked
+	None,
+	// The value is the name or path of a struct
+	Struct,
+	// The value is the name or path of a class
+	Class,
+	// The value is the name or path of an enum
+	Enum,
+	// The value is the name of another property in the same Blueprint or struct
+	Property
+};
+
 USTRUCT()
 struct FMDMetaDataKey
 {
@@ -136,6 +152,11 @@ public:
 	bool bCanBeUsedOnFunctionParameters = true;
 	FMDMetaDataKey& CanBeUsedOnFunctionParameters(bool InCanBeUsedOnFunctionParameters) { bCanBeUsedOnFunctionParameters = InCanBeUsedOnFunctionParameters; return *this; }
 
+	// Whether or not values of this meta data on Blueprint Variables and Functions and User Defined Struct members are baked into the generated class or struct so they can be read in cooked builds with UMDMetaDataRuntimeTable
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor")
+	bool bAvailableAtRuntime = false;
+	FMDMetaDataKey& AvailableAtRuntime(bool InAvailableAtRuntime) { bAvailableAtRuntime = InAvailableAtRuntime; return *this; }
+
 	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (EditConditionHides, EditCondition = "KeyType == EMDMetaDataEditorKeyType::Integer || KeyType == EMDMetaDataEditorKeyType::Float"))
 	bool bAllowSlider = true;
 	FMDMetaDataKey& AllowSlider(bool InAllowSlider) { bAllowSlider = InAllowSlider; return *this; }
@@ -176,6 +197,31 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (EditConditionHides, EditCondition = "KeyType == EMDMetaDataEditorKeyType::ValueList"))
 	TArray<FString> ValueList;
 
+	// Only classes that derive from this class can be selected
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (EditConditionHides, EditCondition = "KeyType == EMDMetaDataEditorKeyType::Class", AllowAbstract))
+	TSoftClassPtr<UObject> BaseClass;
+	FMDMetaDataKey& SetBaseClass(TSoftClassPtr<UObject>&& InBaseClass) { BaseClass = MoveTemp(InBaseClass); return *this; }
+
+	// Only structs that derive from this struct can be selected
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (EditConditionHides, EditCondition = "KeyType == EMDMetaDataEditorKeyType::Struct"))
+	TSoftObjectPtr<UScriptStruct> BaseStruct;
+	FMDMetaDataKey& SetBaseStruct(TSoftObjectPtr<UScriptStruct>&& InBaseStruct) { BaseStruct = MoveTemp(InBaseStruct); return *this; }
+
+	// Whether the value is a comma separated list of types or params instead of a single one
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (EditConditionHides, EditCondition = "KeyType == EMDMetaDataEditorKeyType::Struct || KeyType == EMDMetaDataEditorKeyType::Class || KeyType == EMDMetaDataEditorKeyType::Interface || KeyType == EMDMetaDataEditorKeyType::Param"))
+	bool bAllowMultipleValues = false;
+	FMDMetaDataKey& AllowMultipleValues(bool InAllowMultipleValues) { bAllowMultipleValues = InAllowMultipleValues; return *this; }
+
+	// Blueprints with a value for this key that doesn't name an existing object of this type will warn when compiled
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (EditConditionHides, EditCondition = "KeyType == EMDMetaDataEditorKeyType::String"))
+	EMDMetaDataValueReference ValueReference = EMDMetaDataValueReference::None;
+	FMDMetaDataKey& SetValueReference(EMDMetaDataValueReference InValueReference) { ValueReference = InValueReference; return *this; }
+
+	// Blueprints with a value for this key greater than the value of `MaxValueMetaData` will warn when compiled, eg. ClampMin and ClampMax
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (EditConditionHides, EditCondition = "KeyType == EMDMetaDataEditorKeyType::Integer || KeyType == EMDMetaDataEditorKeyType::Float", GetOptions = "GetMetaDataKeyNames"))
+	FName MaxValueMetaData = NAME_None;
+	FMDMetaDataKey& SetMaxValueMetaData(const FName& InMaxValueMetaData) { MaxValueMetaData = InMaxValueMetaData; return *this; }
+
 	bool DoesSupportBlueprint(const UBlueprint* Blueprint) const;
 	bool DoesSupportProperty(const FProperty* Property) const;
 
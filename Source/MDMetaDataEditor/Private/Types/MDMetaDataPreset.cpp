@@ -0,0 +1,22 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataPreset.h"
+
+#include "Customizations/MDMetaDataEditorFieldView.h"
+
+FText FMDMetaDataPreset::GetDisplayText() const
+{
+	return FText::FromName(PresetName);
+}
+
+FText FMDMetaDataPreset::GetToolTipText() const
+{
+	TArray<FString> Specifiers;
+	for (const FMDMetaDataPresetValue& PresetValue : Values)
+	{
+		Specifiers.Add(FMDMetaDataEditorFieldView::FormatMetadata(PresetValue.Key, PresetValue.Value));
+	}
+
+	const FString SpecifierList = FString::Printf(TEXT("meta=(%s)"), *FString::Join(Specifiers, TEXT(", ")));
+	return FText::FromString(Description.IsEmpty() ? SpecifierList : Description + TEXT("\r\n\r\n") + SpecifierList);
+}
@@ -0,0 +1,45 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "MDMetaDataPreset.generated.h"
+
+USTRUCT()
+struct FMDMetaDataPresetValue
+{
+	GENERATED_BODY()
+
+public:
+	// Must be one of the configured meta data keys
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (GetOptions = "GetMetaDataKeyNames"))
+	FName Key = NAME_None;
+
+	// Leave empty for Flag keys
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor")
+	FString Value;
+};
+
+/**
+ * A named set of meta data values that can be set on one or many fields in a single step
+ */
+USTRUCT()
+struct FMDMetaDataPreset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor")
+	FName PresetName = NAME_None;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (MultiLine))
+	FString Description;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Meta Data Editor", meta = (TitleProperty = "{Key}={Value}"))
+	TArray<FMDMetaDataPresetValue> Values;
+
+	FText GetDisplayText() const;
+	// The description followed by the values as C++ specifiers
+	FText GetToolTipText() const;
+};
@@ -0,0 +1,161 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataRuntimeTableBaker.h"
+
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Config/MDMetaDataEditorConfig.h"
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "MDMetaDataChangeBus.h"
+#include "MDMetaDataRuntimeTable.h"
+#include "UObject/UObjectIterator.h"
+#include "Validation/MDMetaDataProjectValidator.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
+#include "StructUtils/UserDefinedStruct.h"
+#endif
+
+FMDMetaDataRuntimeTableBaker::FMDMetaDataRuntimeTableBaker()
+{
+	RuntimeKeys = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot()->GetRuntimeKeys();
+
+	GetMutableDefault<UMDMetaDataEditorConfig>()->OnMetaDataKeysChanged.AddRaw(this, &FMDMetaDataRuntimeTableBaker::OnMetaDataKeysChanged);
+	FMDMetaDataChangeBus::Get().OnMetaDataChanged.AddRaw(this, &FMDMetaDataRuntimeTableBaker::OnMetaDataChanged);
+	FCoreUObjectDelegates::OnAssetLoaded.AddRaw(this, &FMDMetaDataRuntimeTableBaker::OnAssetLoaded);
+	FCoreUObjectDelegates::OnObjectPreSave.AddRaw(this, &FMDMetaDataRuntimeTableBaker::OnObjectPreSave);
+}
+
+FMDMetaDataRuntimeTableBaker::~FMDMetaDataRuntimeTableBaker()
+{
+	if (!IsEngineExitRequested())
+	{
+		if (UMDMetaDataEditorConfig* Config = GetMutableDefault<UMDMetaDataEditorConfig>())
+		{
+			Config->OnMetaDataKeysChanged.RemoveAll(this);
+		}
+	}
+
+	FMDMetaDataChangeBus::Get().OnMetaDataChanged.RemoveAll(this);
+	FCoreUObjectDelegates::OnAssetLoaded.RemoveAll(this);
+	FCoreUObjectDelegates::OnObjectPreSave.RemoveAll(this);
+}
+
+void FMDMetaDataRuntimeTableBaker::OnMetaDataKeysChanged()
+{
+	const TSet<FName>& NewRuntimeKeys = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot()->GetRuntimeKeys();
+	if (NewRuntimeKeys.Num() == RuntimeKeys.Num() && NewRuntimeKeys.Includes(RuntimeKeys))
+	{
+		return;
+	}
+
+	// Only keys that were added to or removed from the runtime keys can change a table
+	TSet<FName> ChangedKeys = NewRuntimeKeys.Difference(RuntimeKeys);
+	ChangedKeys.Append(RuntimeKeys.Difference(NewRuntimeKeys));
+	RuntimeKeys = NewRuntimeKeys;
+
+	// Loaded assets whose tables change are dirtied so the new values get saved, the rest are rebaked as they're loaded
+	for (TObjectIterator<UBlueprint> It; It; ++It)
+	{
+		if (MayNeedBake(*It, It->GeneratedClass.Get(), ChangedKeys) && Bake(It->GeneratedClass.Get()))
+		{
+			It->MarkPackageDirty();
+		}
+	}
+
+	for (TObjectIterator<UUserDefinedStruct> It; It; ++It)
+	{
+		if (It->IsAsset() && MayNeedBake(*It, *It, ChangedKeys) && Bake(*It))
+		{
+			It->MarkPackageDirty();
+		}
+	}
+}
+
+void FMDMetaDataRuntimeTableBaker::OnMetaDataChanged(TConstArrayView<FMDMetaDataChangeRecord> Records)
+{
+	// Blueprints are rebaked when they compile, but editing a User Defined Struct's meta data doesn't compile it
+	TSet<UUserDefinedStruct*> Structs;
+	for (const FMDMetaDataChangeRecord& Record : Records)
+	{
+		if (UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Record.Target.Asset.Get()))
+		{
+			if (RuntimeKeys.Contains(Record.Key) || RuntimeKeys.Contains(Record.RenamedFrom))
+			{
+				Structs.Add(Struct);
+			}
+		}
+	}
+
+	for (UUserDefinedStruct* Struct : Structs)
+	{
+		Bake(Struct);
+	}
+}
+
+void FMDMetaDataRuntimeTableBaker::OnAssetLoaded(UObject* Asset)
+{
+	// Tables saved before the runtime keys changed are rebaked in memory, so cooks always match the config
+	if (const UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+	{
+		if (MayNeedBake(Blueprint, Blueprint->GeneratedClass.Get(), RuntimeKeys))
+		{
+			Bake(Blueprint->GeneratedClass.Get());
+		}
+	}
+	else if (UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Asset))
+	{
+		if (MayNeedBake(Struct, Struct, RuntimeKeys))
+		{
+			Bake(Struct);
+		}
+	}
+}
+
+void FMDMetaDataRuntimeTableBaker::OnObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext)
+{
+	// Struct members can be added or removed without any meta data changing
+	if (UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Object))
+	{
+		Bake(Struct);
+	}
+}
+
+bool FMDMetaDataRuntimeTableBaker::Bake(UStruct* Struct) const
+{
+	return UMDMetaDataRuntimeTable::BakeStruct(Struct, [this](FName Key)
+	{
+		return RuntimeKeys.Contains(Key);
+	});
+}
+
+bool FMDMetaDataRuntimeTableBaker::MayNeedBake(const UObject* Asset, const UStruct* Struct, const TSet<FName>& ChangedKeys) const
+{
+	if (!IsValid(Struct))
+	{
+		return false;
+	}
+
+	// A key that's no longer a runtime key is removed from the table
+	if (const UMDMetaDataRuntimeTable* Table = UMDMetaDataRuntimeTable::FindTable(Struct))
+	{
+		for (const FName& Key : Table->GetKeys())
+		{
+			if (ChangedKeys.Contains(Key) || !RuntimeKeys.Contains(Key))
+			{
+				return true;
+			}
+		}
+	}
+
+	if (ChangedKeys.IsEmpty())
+	{
+		return false;
+	}
+
+	// The on disk summary, the in memory asset data would gather its tags from the loaded asset
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	const FAssetData AssetData = (AssetRegistry != nullptr) ? AssetRegistry->GetAssetByObjectPath(FSoftObjectPath(Asset), true) : FAssetData();
+	return FMDMetaDataProjectValidator::MayHaveMetaData(AssetData, *GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot(), ChangedKeys);
+}
@@ -0,0 +1,37 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectSaveContext.h"
+
+class UStruct;
+struct FMDMetaDataChangeRecord;
+
+/**
+ * Keeps the UMDMetaDataRuntimeTables of Blueprints and User Defined Structs in step with the keys flagged as available at runtime.
+ * Blueprints are baked by the compiler extension, this covers what happens outside of a compile: User Defined Struct edits,
+ * and the runtime keys changing after a table was baked.
+ */
+class FMDMetaDataRuntimeTableBaker : public TSharedFromThis<FMDMetaDataRuntimeTableBaker>
+{
+public:
+	FMDMetaDataRuntimeTableBaker();
+	~FMDMetaDataRuntimeTableBaker();
+
+private:
+	void OnMetaDataKeysChanged();
+	void OnMetaDataChanged(TConstArrayView<FMDMetaDataChangeRecord> Records);
+	void OnAssetLoaded(UObject* Asset);
+	void OnObjectPreSave(UObject* Object, FObjectPreSaveContext SaveContext);
+
+	// Returns whether the baked values changed
+	bool Bake(UStruct* Struct) const;
+
+	// Whether baking the asset's struct may change its table, given the keys whose runtime flag changed.
+	// Its table is checked for stale keys, then the asset's registry summary for its meta data, so unrelated assets are left alone.
+	bool MayNeedBake(const UObject* Asset, const UStruct* Struct, const TSet<FName>& ChangedKeys) const;
+
+	TSet<FName> RuntimeKeys;
+};
@@ -0,0 +1,220 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataSpecifierParser.h"
+
+#include "Misc/Char.h"
+
+bool FMDMetaDataSpecifierList::IsSpecifierList() const
+{
+	return Specifiers.Num() > 0 && (bHasMetaWrapper || Specifiers.ContainsByPredicate([](const FMDMetaDataSpecifier& Specifier) { return Specifier.bHasValue; }));
+}
+
+const FMDMetaDataSpecifier* FMDMetaDataSpecifierList::Find(FName Key) const
+{
+	return Specifiers.FindByPredicate([Key](const FMDMetaDataSpecifier& Specifier) { return Specifier.Key == Key; });
+}
+
+bool FMDMetaDataSpecifierParser::Parse(FStringView Text, FMDMetaDataSpecifierList& OutList)
+{
+	OutList = {};
+
+	FStringView Block = Text.TrimStartAndEnd();
+	OutList.bHasMetaWrapper = ExtractMetaBlock(Block, Block);
+	if (!OutList.bHasMetaWrapper && Block.StartsWith(TEXT('(')) && Block.EndsWith(TEXT(')')))
+	{
+		Block = Block.Mid(1, Block.Len() - 2);
+	}
+
+	TArray<FStringView> Entries;
+	SplitTopLevel(Block, Entries);
+
+	for (FStringView Entry : Entries)
+	{
+		Entry = Entry.TrimStartAndEnd();
+		if (Entry.IsEmpty())
+		{
+			continue;
+		}
+
+		FMDMetaDataSpecifier Specifier;
+		const int32 AssignIndex = FindAssignment(Entry);
+		const FStringView Key = (AssignIndex != INDEX_NONE) ? Entry.Left(AssignIndex).TrimEnd() : Entry;
+		if (!IsValidKey(Key))
+		{
+			OutList.Specifiers.Reset();
+			return false;
+		}
+
+		Specifier.Key = FName(Key.Len(), Key.GetData());
+		if (AssignIndex != INDEX_NONE)
+		{
+			Specifier.Value = ParseValue(Entry.Mid(AssignIndex + 1).TrimStart());
+			Specifier.bHasValue = true;
+		}
+
+		// Later duplicates win, same as UHT
+		OutList.Specifiers.RemoveAll([&Specifier](const FMDMetaDataSpecifier& Existing) { return Existing.Key == Specifier.Key; });
+		OutList.Specifiers.Emplace(MoveTemp(Specifier));
+	}
+
+	return OutList.Specifiers.Num() > 0;
+}
+
+bool FMDMetaDataSpecifierParser::ExtractMetaBlock(FStringView Text, FStringView& OutBlock)
+{
+	// Find `meta = (` outside of any quotes, allowing a whole UPROPERTY(...) to be pasted
+	bool bInQuotes = false;
+	for (int32 i = 0; i + 4 <= Text.Len(); ++i)
+	{
+		const TCHAR Char = Text[i];
+		if (Char == TEXT('"') && (i == 0 || Text[i - 1] != TEXT('\\')))
+		{
+			bInQuotes = !bInQuotes;
+			continue;
+		}
+
+		if (bInQuotes || (i > 0 && (FChar::IsAlnum(Text[i - 1]) || Text[i - 1] == TEXT('_'))) || !Text.Mid(i, 4).Equals(TEXT("meta"), ESearchCase::IgnoreCase))
+		{
+			continue;
+		}
+
+		int32 Index = i + 4;
+		auto SkipWhitespace = [&Text, &Index]()
+		{
+			while (Index < Text.Len() && FChar::IsWhitespace(Text[Index]))
+			{
+				++Index;
+			}
+		};
+
+		SkipWhitespace();
+		if (Index >= Text.Len() || Text[Index] != TEXT('='))
+		{
+			continue;
+		}
+
+		++Index;
+		SkipWhitespace();
+		if (Index >= Text.Len() || Text[Index] != TEXT('('))
+		{
+			continue;
+		}
+
+		// Find the matching close paren
+		const int32 BlockStart = Index + 1;
+		int32 Depth = 0;
+		bool bInBlockQuotes = false;
+		for (; Index < Text.Len(); ++Index)
+		{
+			const TCHAR BlockChar = Text[Index];
+			if (BlockChar == TEXT('"') && Text[Index - 1] != TEXT('\\'))
+			{
+				bInBlockQuotes = !bInBlockQuotes;
+			}
+			else if (!bInBlockQuotes && BlockChar == TEXT('('))
+			{
+				++Depth;
+			}
+			else if (!bInBlockQuotes && BlockChar == TEXT(')') && --Depth == 0)
+			{
+				break;
+			}
+		}
+
+		// Tolerate a missing close paren from a partial copy
+		OutBlock = Text.Mid(BlockStart, Index - BlockStart);
+		return true;
+	}
+
+	return false;
+}
+
+void FMDMetaDataSpecifierParser::SplitTopLevel(FStringView Text, TArray<FStringView>& OutEntries)
+{
+	int32 EntryStart = 0;
+	int32 Depth = 0;
+	bool bInQuotes = false;
+
+	for (int32 i = 0; i < Text.Len(); ++i)
+	{
+		const TCHAR Char = Text[i];
+		if (Char == TEXT('"') && (i == 0 || Text[i - 1] != TEXT('\\')))
+		{
+			bInQuotes = !bInQuotes;
+		}
+		else if (!bInQuotes && Char == TEXT('('))
+		{
+			++Depth;
+		}
+		else if (!bInQuotes && Char == TEXT(')'))
+		{
+			Depth = FMath::Max(0, Depth - 1);
+		}
+		else if (!bInQuotes && Depth == 0 && Char == TEXT(','))
+		{
+			OutEntries.Add(Text.Mid(EntryStart, i - EntryStart));
+			EntryStart = i + 1;
+		}
+	}
+
+	OutEntries.Add(Text.Mid(EntryStart));
+}
+
+int32 FMDMetaDataSpecifierParser::FindAssignment(FStringView Entry)
+{
+	for (int32 i = 0; i < Entry.Len(); ++i)
+	{
+		const TCHAR Char = Entry[i];
+		if (Char == TEXT('"'))
+		{
+			// Keys are never quoted
+			return INDEX_NONE;
+		}
+
+		if (Char != TEXT('='))
+		{
+			continue;
+		}
+
+		// Skip comparison operators (==, !=, <=, >=) so a raw edit condition isn't taken as Key=Value
+		const TCHAR Prev = (i > 0) ? Entry[i - 1] : TEXT('\0');
+		const TCHAR Next = (i + 1 < Entry.Len()) ? Entry[i + 1] : TEXT('\0');
+		if (Prev == TEXT('!') || Prev == TEXT('<') || Prev == TEXT('>') || Prev == TEXT('=') || Next == TEXT('='))
+		{
+			return INDEX_NONE;
+		}
+
+		return i;
+	}
+
+	return INDEX_NONE;
+}
+
+bool FMDMetaDataSpecifierParser::IsValidKey(FStringView Key)
+{
+	if (Key.IsEmpty() || FChar::IsDigit(Key[0]))
+	{
+		return false;
+	}
+
+	for (const TCHAR Char : Key)
+	{
+		if (!FChar::IsAlnum(Char) && Char != TEXT('_') && Char != TEXT('.'))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+FString FMDMetaDataSpecifierParser::ParseValue(FStringView Value)
+{
+	Value = Value.TrimEnd();
+	if (Value.Len() >= 2 && Value.StartsWith(TEXT('"')) && Value.EndsWith(TEXT('"')))
+	{
+		return FString(Value.Mid(1, Value.Len() - 2)).ReplaceEscapedCharWithChar();
+	}
+
+	return FString(Value);
+}
@@ -0,0 +1,48 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/StringView.h"
+#include "Containers/UnrealString.h"
+#include "UObject/NameTypes.h"
+
+struct FMDMetaDataSpecifier
+{
+	FName Key = NAME_None;
+	FString Value;
+
+	// False for bare keys such as `HideSelfPin` that don't have `=Value`
+	bool bHasValue = false;
+};
+
+struct FMDMetaDataSpecifierList
+{
+	TArray<FMDMetaDataSpecifier> Specifiers;
+
+	// True if the text was wrapped in `meta=(...)`
+	bool bHasMetaWrapper = false;
+
+	// True if the text is clearly a list of meta data rather than a lone value that happens to look like a key
+	bool IsSpecifierList() const;
+
+	const FMDMetaDataSpecifier* Find(FName Key) const;
+};
+
+/**
+ * Parses meta data the way it's written in C++, such as `meta=(ClampMin=0, ClampMax=1, EditCondition="bFoo")`
+ * or the `Key="Value"` format that copying a meta data row produces
+ */
+class FMDMetaDataSpecifierParser
+{
+public:
+	// Returns false if the text isn't a list of key/value pairs (eg. a raw edit condition like `bFoo != 3`)
+	static bool Parse(FStringView Text, FMDMetaDataSpecifierList& OutList);
+
+private:
+	static bool ExtractMetaBlock(FStringView Text, FStringView& OutBlock);
+	static void SplitTopLevel(FStringView Text, TArray<FStringView>& OutEntries);
+	static int32 FindAssignment(FStringView Entry);
+	static bool IsValidKey(FStringView Key);
+	static FString ParseValue(FStringView Value);
+};
@@ -0,0 +1,396 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataTypeIndex.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Misc/PackageName.h"
+#include "Modules/ModuleManager.h"
+#include "Runtime/Launch/Resources/Version.h"
+#include "UObject/Interface.h"
+#include "UObject/UObjectIterator.h"
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
+#include "StructUtils/UserDefinedStruct.h"
+#endif
+
+namespace MDMDTI_Private
+{
+	IAssetRegistry& GetAssetRegistry()
+	{
+		return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	}
+
+	bool MakeAssetEntry(const FAssetData& AssetData, FMDMetaDataTypeEntry& OutEntry, FString& OutParentPath)
+	{
+		if (AssetData.AssetClassPath == UUserDefinedStruct::StaticClass()->GetClassPathName())
+		{
+			OutEntry.Path = AssetData.GetObjectPathString();
+			OutEntry.Name = AssetData.AssetName;
+			OutEntry.Kind = EMDMetaDataTypeKind::Struct;
+			return true;
+		}
+
+		// Only Blueprints carry these tags, anything else that gets here isn't a type
+		FString ParentClassPath;
+		if (!AssetData.GetTagValue(FBlueprintTags::ParentClassPath, ParentClassPath))
+		{
+			return false;
+		}
+
+		FString GeneratedClassPath;
+		OutEntry.Path = AssetData.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassPath)
+			? FPackageName::ExportTextPathToObjectPath(GeneratedClassPath)
+			: AssetData.GetObjectPathString() + TEXT("_C");
+		OutEntry.Name = FName(*FPackageName::ObjectPathToObjectName(OutEntry.Path));
+
+		FString BlueprintType;
+		AssetData.GetTagValue(FBlueprintTags::BlueprintType, BlueprintType);
+		OutEntry.Kind = (BlueprintType == TEXT("BPTYPE_Interface")) ? EMDMetaDataTypeKind::Interface : EMDMetaDataTypeKind::Class;
+
+		OutParentPath = FPackageName::ExportTextPathToObjectPath(ParentClassPath);
+		return true;
+	}
+}
+
+FMDMetaDataTypeIndex::FMDMetaDataTypeIndex()
+{
+	IAssetRegistry& AssetRegistry = MDMDTI_Private::GetAssetRegistry();
+	AssetRegistry.OnAssetAdded().AddRaw(this, &FMDMetaDataTypeIndex::AddOrUpdateAsset);
+	AssetRegistry.OnAssetUpdated().AddRaw(this, &FMDMetaDataTypeIndex::AddOrUpdateAsset);
+	AssetRegistry.OnAssetRemoved().AddRaw(this, &FMDMetaDataTypeIndex::OnAssetRemoved);
+	AssetRegistry.OnAssetRenamed().AddRaw(this, &FMDMetaDataTypeIndex::OnAssetRenamed);
+
+	FModuleManager::Get().OnModulesChanged().AddRaw(this, &FMDMetaDataTypeIndex::OnModulesChanged);
+}
+
+FMDMetaDataTypeIndex::~FMDMetaDataTypeIndex()
+{
+	FModuleManager::Get().OnModulesChanged().RemoveAll(this);
+
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetAdded().RemoveAll(this);
+		AssetRegistry.OnAssetUpdated().RemoveAll(this);
+		AssetRegistry.OnAssetRemoved().RemoveAll(this);
+		AssetRegistry.OnAssetRenamed().RemoveAll(this);
+	}
+}
+
+void FMDMetaDataTypeIndex::ForEachType(EMDMetaDataTypeKind Kind, const FString& BasePath, TFunctionRef<void(const FMDMetaDataTypeEntry&)> Func)
+{
+	EnsureBuilt();
+
+	// Structs don't share a root, so listing all of them is a plain walk over the nodes
+	if (Kind == EMDMetaDataTypeKind::Struct && BasePath.IsEmpty())
+	{
+		for (const FNode& Node : Nodes)
+		{
+			if (!Node.bIsRemoved && Node.Entry.Kind == EMDMetaDataTypeKind::Struct)
+			{
+				Func(Node.Entry);
+			}
+		}
+
+		return;
+	}
+
+	FString RootPath = BasePath;
+	if (RootPath.IsEmpty())
+	{
+		RootPath = (Kind == EMDMetaDataTypeKind::Interface) ? UInterface::StaticClass()->GetPathName() : UObject::StaticClass()->GetPathName();
+	}
+
+	const int32* RootIndex = TypeNodes.Find(RootPath);
+	if (RootIndex == nullptr)
+	{
+		return;
+	}
+
+	TArray<int32, TInlineAllocator<64>> Stack = { *RootIndex };
+	while (!Stack.IsEmpty())
+	{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+		const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+#else
+		const int32 NodeIndex = Stack.Pop(false);
+#endif
+		const FNode& Node = Nodes[NodeIndex];
+		if (Node.bIsRemoved)
+		{
+			continue;
+		}
+
+		if (Node.Entry.Kind == Kind && NodeIndex != InterfaceNode)
+		{
+			Func(Node.Entry);
+		}
+
+		// Everything under UInterface is an interface, classes don't need to look there
+		if (Kind == EMDMetaDataTypeKind::Class && Node.Entry.Kind == EMDMetaDataTypeKind::Interface)
+		{
+			continue;
+		}
+
+		Stack.Append(Node.Children);
+	}
+}
+
+const FMDMetaDataTypeEntry* FMDMetaDataTypeIndex::FindType(const FString& Path)
+{
+	EnsureBuilt();
+
+	const int32* NodeIndex = TypeNodes.Find(Path);
+	return (NodeIndex != nullptr) ? &Nodes[*NodeIndex].Entry : nullptr;
+}
+
+void FMDMetaDataTypeIndex::EnsureBuilt()
+{
+	if (bHasNewNativeTypes)
+	{
+		// Types that are already indexed are skipped
+		bHasNewNativeTypes = false;
+		AddNativeTypes();
+	}
+
+	if (bIsBuilt)
+	{
+		return;
+	}
+
+	bIsBuilt = true;
+
+	AddNativeTypes();
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UUserDefinedStruct::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+
+	// Assets the registry hasn't discovered yet are added by OnAssetAdded as the scan finds them
+	MDMDTI_Private::GetAssetRegistry().EnumerateAssets(Filter, [this](const FAssetData& AssetData)
+	{
+		AddOrUpdateAsset(AssetData);
+		return true;
+	});
+}
+
+void FMDMetaDataTypeIndex::AddNativeTypes()
+{
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		const UClass* Class = *It;
+		if (!Class->HasAnyClassFlags(CLASS_Native))
+		{
+			continue;
+		}
+
+		FMDMetaDataTypeEntry Entry;
+		Entry.Path = Class->GetPathName();
+		Entry.Name = Class->GetFName();
+		Entry.Kind = Class->HasAnyClassFlags(CLASS_Interface) ? EMDMetaDataTypeKind::Interface : EMDMetaDataTypeKind::Class;
+		Entry.bIsNative = true;
+
+		const UClass* SuperClass = Class->GetSuperClass();
+		AddNode(MoveTemp(Entry), (SuperClass != nullptr) ? SuperClass->GetPathName() : FString());
+	}
+
+	for (TObjectIterator<UScriptStruct> It; It; ++It)
+	{
+		const UScriptStruct* Struct = *It;
+		if ((Struct->StructFlags & STRUCT_Native) == 0)
+		{
+			continue;
+		}
+
+		FMDMetaDataTypeEntry Entry;
+		Entry.Path = Struct->GetPathName();
+		Entry.Name = Struct->GetFName();
+		Entry.Kind = EMDMetaDataTypeKind::Struct;
+		Entry.bIsNative = true;
+
+		const UStruct* SuperStruct = Struct->GetSuperStruct();
+		AddNode(MoveTemp(Entry), (SuperStruct != nullptr) ? SuperStruct->GetPathName() : FString());
+	}
+
+	if (const int32* NodeIndex = TypeNodes.Find(UInterface::StaticClass()->GetPathName()))
+	{
+		InterfaceNode = *NodeIndex;
+	}
+}
+
+int32 FMDMetaDataTypeIndex::AddNode(FMDMetaDataTypeEntry&& Entry, FString&& ParentPath)
+{
+	if (const int32* ExistingIndex = TypeNodes.Find(Entry.Path))
+	{
+		return *ExistingIndex;
+	}
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+	const int32 NodeIndex = !FreeNodes.IsEmpty() ? FreeNodes.Pop(EAllowShrinking::No) : Nodes.AddDefaulted();
+#else
+	const int32 NodeIndex = !FreeNodes.IsEmpty() ? FreeNodes.Pop(false) : Nodes.AddDefaulted();
+#endif
+	FNode& Node = Nodes[NodeIndex];
+	Node.Entry = MoveTemp(Entry);
+	Node.ParentPath = MoveTemp(ParentPath);
+	Node.bIsRemoved = false;
+
+	TypeNodes.Add(Node.Entry.Path, NodeIndex);
+	LinkToParent(NodeIndex);
+	LinkOrphans(NodeIndex);
+
+	return NodeIndex;
+}
+
+void FMDMetaDataTypeIndex::LinkOrphans(int32 NodeIndex)
+{
+	// Children can be indexed before their parent, eg. when the parent Blueprint is added or renamed after them
+	TArray<int32> WaitingNodes;
+	OrphanNodes.MultiFind(Nodes[NodeIndex].Entry.Path, WaitingNodes);
+	if (!WaitingNodes.IsEmpty())
+	{
+		OrphanNodes.Remove(Nodes[NodeIndex].Entry.Path);
+		for (const int32 WaitingNode : WaitingNodes)
+		{
+			LinkToParent(WaitingNode);
+		}
+	}
+}
+
+void FMDMetaDataTypeIndex::RemoveNode(int32 NodeIndex)
+{
+	UnlinkFromParent(NodeIndex);
+
+	FNode& Node = Nodes[NodeIndex];
+	for (const int32 ChildIndex : Node.Children)
+	{
+		Nodes[ChildIndex].ParentIndex = INDEX_NONE;
+		OrphanNodes.Add(Node.Entry.Path, ChildIndex);
+	}
+
+	TypeNodes.Remove(Node.Entry.Path);
+
+	Node = FNode();
+	Node.bIsRemoved = true;
+	FreeNodes.Add(NodeIndex);
+}
+
+void FMDMetaDataTypeIndex::LinkToParent(int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	if (Node.ParentPath.IsEmpty())
+	{
+		return;
+	}
+
+	if (const int32* ParentIndex = TypeNodes.Find(Node.ParentPath))
+	{
+		Node.ParentIndex = *ParentIndex;
+		Nodes[*ParentIndex].Children.Add(NodeIndex);
+	}
+	else
+	{
+		OrphanNodes.Add(Node.ParentPath, NodeIndex);
+	}
+}
+
+void FMDMetaDataTypeIndex::UnlinkFromParent(int32 NodeIndex)
+{
+	FNode& Node = Nodes[NodeIndex];
+	if (Node.ParentIndex != INDEX_NONE)
+	{
+		Nodes[Node.ParentIndex].Children.RemoveSingleSwap(NodeIndex);
+		Node.ParentIndex = INDEX_NONE;
+	}
+	else if (!Node.ParentPath.IsEmpty())
+	{
+		OrphanNodes.RemoveSingle(Node.ParentPath, NodeIndex);
+	}
+}
+
+void FMDMetaDataTypeIndex::AddOrUpdateAsset(const FAssetData& AssetData)
+{
+	if (!bIsBuilt)
+	{
+		return;
+	}
+
+	FMDMetaDataTypeEntry Entry;
+	FString ParentPath;
+	if (!MDMDTI_Private::MakeAssetEntry(AssetData, Entry, ParentPath))
+	{
+		return;
+	}
+
+	const FString AssetPath = AssetData.GetObjectPathString();
+	if (const int32* ExistingIndex = AssetNodes.Find(AssetPath))
+	{
+		FNode& ExistingNode = Nodes[*ExistingIndex];
+		if (ExistingNode.Entry.Path == Entry.Path && ExistingNode.ParentPath == ParentPath)
+		{
+			ExistingNode.Entry.Kind = Entry.Kind;
+			return;
+		}
+
+		// Reparented, its children are relinked when it's added back
+		RemoveNode(*ExistingIndex);
+	}
+
+	AssetNodes.Add(AssetPath, AddNode(MoveTemp(Entry), MoveTemp(ParentPath)));
+}
+
+void FMDMetaDataTypeIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+	int32 NodeIndex = INDEX_NONE;
+	if (AssetNodes.RemoveAndCopyValue(AssetData.GetObjectPathString(), NodeIndex))
+	{
+		RemoveNode(NodeIndex);
+	}
+}
+
+void FMDMetaDataTypeIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+	int32 NodeIndex = INDEX_NONE;
+	if (!AssetNodes.RemoveAndCopyValue(OldObjectPath, NodeIndex))
+	{
+		AddOrUpdateAsset(AssetData);
+		return;
+	}
+
+	FMDMetaDataTypeEntry Entry;
+	FString ParentPath;
+	if (!MDMDTI_Private::MakeAssetEntry(AssetData, Entry, ParentPath))
+	{
+		RemoveNode(NodeIndex);
+		return;
+	}
+
+	// Renamed in place so children stay linked, their parent tags name the old path until they're resaved
+	FNode& Node = Nodes[NodeIndex];
+	TypeNodes.Remove(Node.Entry.Path);
+	Node.Entry = MoveTemp(Entry);
+	TypeNodes.Add(Node.Entry.Path, NodeIndex);
+	AssetNodes.Add(AssetData.GetObjectPathString(), NodeIndex);
+
+	if (Node.ParentPath != ParentPath)
+	{
+		UnlinkFromParent(NodeIndex);
+		Nodes[NodeIndex].ParentPath = MoveTemp(ParentPath);
+		LinkToParent(NodeIndex);
+	}
+
+	// Children that were already saved with the new path were waiting for it
+	LinkOrphans(NodeIndex);
+}
+
+void FMDMetaDataTypeIndex::OnModulesChanged(FName ModuleName, EModuleChangeReason Reason)
+{
+	// Native types from the module are picked up the next time the index is used
+	if (Reason == EModuleChangeReason::ModuleLoaded && bIsBuilt)
+	{
+		bHasNewNativeTypes = true;
+	}
+}
@@ -0,0 +1,81 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+
+struct FAssetData;
+
+enum class EMDMetaDataTypeKind : uint8
+{
+	Class,
+	Interface,
+	Struct
+};
+
+struct FMDMetaDataTypeEntry
+{
+	// The path that meta data values use, eg. /Script/Engine.Actor or /Game/BP_Foo.BP_Foo_C
+	FString Path;
+	FName Name = NAME_None;
+	EMDMetaDataTypeKind Kind = EMDMetaDataTypeKind::Class;
+	bool bIsNative = false;
+};
+
+/**
+ * Every class, interface and struct in the project, from native reflection and the asset registry, so type pickers never have to load a Blueprint.
+ * Kept as a tree of parent -> children so that filtering by a base type only visits the results.
+ * Built the first time it's used, then kept up to date as Blueprints and User Defined Structs are added, removed, renamed and reparented, and as modules with native types are loaded.
+ */
+class FMDMetaDataTypeIndex : public TSharedFromThis<FMDMetaDataTypeIndex>
+{
+public:
+	FMDMetaDataTypeIndex();
+	~FMDMetaDataTypeIndex();
+
+	// Calls Func with every type of Kind that is or derives from BasePath, or every type of Kind if BasePath is empty
+	void ForEachType(EMDMetaDataTypeKind Kind, const FString& BasePath, TFunctionRef<void(const FMDMetaDataTypeEntry&)> Func);
+
+	const FMDMetaDataTypeEntry* FindType(const FString& Path);
+
+private:
+	struct FNode
+	{
+		FMDMetaDataTypeEntry Entry;
+		FString ParentPath;
+		int32 ParentIndex = INDEX_NONE;
+		TArray<int32> Children;
+		bool bIsRemoved = false;
+	};
+
+	void EnsureBuilt();
+	void AddNativeTypes();
+
+	int32 AddNode(FMDMetaDataTypeEntry&& Entry, FString&& ParentPath);
+	void RemoveNode(int32 NodeIndex);
+	void LinkToParent(int32 NodeIndex);
+	void LinkOrphans(int32 NodeIndex);
+	void UnlinkFromParent(int32 NodeIndex);
+
+	void AddOrUpdateAsset(const FAssetData& AssetData);
+	void OnAssetRemoved(const FAssetData& AssetData);
+	void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+	void OnModulesChanged(FName ModuleName, EModuleChangeReason Reason);
+
+	bool bIsBuilt = false;
+	bool bHasNewNativeTypes = false;
+
+	TArray<FNode> Nodes;
+	TArray<int32> FreeNodes;
+
+	// Type path -> node, and asset path -> node for types that come from assets
+	TMap<FString, int32> TypeNodes;
+	TMap<FString, int32> AssetNodes;
+
+	// Parent type path -> nodes whose parent hasn't been indexed yet
+	TMultiMap<FString, int32> OrphanNodes;
+
+	int32 InterfaceNode = INDEX_NONE;
+};
@@ -0,0 +1,104 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataEditorValidator.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Config/MDMetaDataEditorConfig.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Misc/PackageName.h"
+#include "Validation/MDMetaDataProjectValidator.h"
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
+#include "StructUtils/UserDefinedStruct.h"
+#endif
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+bool UMDMetaDataEditorValidator::CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const
+#else
+bool UMDMetaDataEditorValidator::CanValidateAsset_Implementation(UObject* InAsset) const
+#endif
+{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+	const UObject* InAsset = InObject;
+#endif
+	return InAsset != nullptr && (InAsset->IsA<UBlueprint>() || InAsset->IsA<UUserDefinedStruct>());
+}
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+EDataValidationResult UMDMetaDataEditorValidator::ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context)
+#else
+EDataValidationResult UMDMetaDataEditorValidator::ValidateLoadedAsset_Implementation(UObject* InAsset, TArray<FText>& ValidationErrors)
+#endif
+{
+	return ValidateAsset(InAsset);
+}
+
+EDataValidationResult UMDMetaDataEditorValidator::ValidateAsset(UObject* InAsset)
+{
+	TArray<FText> Issues;
+
+	PrefetchIfNeeded(InAsset);
+
+	const FSoftObjectPath AssetPath = FSoftObjectPath(InAsset);
+	if (PrefetchedAssets.Contains(AssetPath) && !InAsset->GetPackage()->IsDirty())
+	{
+		if (const TArray<FText>* AssetIssues = PrefetchedIssues.Find(AssetPath))
+		{
+			Issues = *AssetIssues;
+		}
+	}
+	else
+	{
+		FMDMetaDataProjectValidator::ValidateLoadedAsset(InAsset, Issues);
+	}
+
+	// Meta data issues are warnings, like they are when compiling, so they don't fail validation on their own
+	for (const FText& Issue : Issues)
+	{
+		AssetWarning(InAsset, Issue);
+	}
+
+	AssetPasses(InAsset);
+	return EDataValidationResult::Valid;
+}
+
+void UMDMetaDataEditorValidator::PrefetchIfNeeded(const UObject* InAsset)
+{
+	// In the editor only a handful of assets are validated at once, so there's nothing to gain from validating other assets ahead of them
+	if (!IsRunningCommandlet())
+	{
+		return;
+	}
+
+	const TSharedRef<const FMDMetaDataEditorConfigSnapshot> Snapshot = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot();
+	if (PrefetchedSnapshot != Snapshot)
+	{
+		PrefetchedSnapshot = Snapshot;
+		PrefetchedFolders.Reset();
+		PrefetchedAssets.Reset();
+		PrefetchedIssues.Reset();
+	}
+
+	// The commandlet doesn't tell validators which assets it's going to validate, but it goes through them by package so the rest of the folder usually follows
+	const FName Folder = FName(FPackageName::GetLongPackagePath(InAsset->GetPackage()->GetName()));
+	bool bIsAlreadyPrefetched = false;
+	PrefetchedFolders.Add(Folder, &bIsAlreadyPrefetched);
+	if (bIsAlreadyPrefetched)
+	{
+		return;
+	}
+
+	FARFilter Filter;
+	Filter.PackagePaths.Add(Folder);
+	Filter.bRecursiveClasses = true;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.ClassPaths.Add(UUserDefinedStruct::StaticClass()->GetClassPathName());
+
+	IAssetRegistry& AssetRegistry = IAssetRegistry::GetChecked();
+	AssetRegistry.WaitForCompletion();
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+	FMDMetaDataProjectValidator::ValidateAssets(Assets, false, PrefetchedIssues, &PrefetchedAssets);
+}
@@ -0,0 +1,39 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "EditorValidatorBase.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+#include "MDMetaDataEditorValidator.generated.h"
+
+struct FMDMetaDataEditorConfigSnapshot;
+
+/**
+ * Hooks the meta data validation into the editor's asset validation and the DataValidation commandlet.
+ * When running as a commandlet, the summarized assets in the folder of each asset that comes through are validated up front in parallel, so their results are ready when they come through too.
+ */
+UCLASS()
+class UMDMetaDataEditorValidator : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+protected:
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+	virtual bool CanValidateAsset_Implementation(const FAssetData& InAssetData, UObject* InObject, FDataValidationContext& InContext) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(const FAssetData& InAssetData, UObject* InAsset, FDataValidationContext& Context) override;
+#else
+	virtual bool CanValidateAsset_Implementation(UObject* InAsset) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(UObject* InAsset, TArray<FText>& ValidationErrors) override;
+#endif
+
+private:
+	EDataValidationResult ValidateAsset(UObject* InAsset);
+
+	void PrefetchIfNeeded(const UObject* InAsset);
+
+	TSharedPtr<const FMDMetaDataEditorConfigSnapshot> PrefetchedSnapshot;
+	TSet<FName> PrefetchedFolders;
+	TSet<FSoftObjectPath> PrefetchedAssets;
+	TMap<FSoftObjectPath, TArray<FText>> PrefetchedIssues;
+};
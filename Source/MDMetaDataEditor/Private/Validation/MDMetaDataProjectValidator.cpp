@@ -0,0 +1,732 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataProjectValidator.h"
+
+#include "Algo/AnyOf.h"
+#include "Async/ParallelFor.h"
+#include "Config/MDMetaDataEditorConfig.h"
+#include "ContentBrowserMenuContexts.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Export/MDMetaDataExporter.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_FunctionEntry.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Logging/MessageLog.h"
+#include "Logging/TokenizedMessage.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Misc/StringBuilder.h"
+#include "Styling/AppStyle.h"
+#include "ToolMenus.h"
+#include "UObject/MetaData.h"
+#include "UObject/ObjectSaveContext.h"
+#include "UObject/Package.h"
+#include "Validation/MDMetaDataValidator.h"
+#include "Widgets/Notifications/SNotificationList.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+#include "UObject/AssetRegistryTagsContext.h"
+#endif
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
+#include "StructUtils/UserDefinedStruct.h"
+#endif
+
+const FName FMDMetaDataProjectValidator::SummaryTagName = TEXT("MDMetaDataSummary");
+
+namespace MDMDPV_Private
+{
+	// Bump when the summary format changes, older summaries are ignored and their assets are loaded instead
+	const TCHAR* SummaryVersion = TEXT("2");
+
+	// Assets without an up to date summary are loaded in batches, garbage is collected after each batch that loaded anything
+	constexpr int32 BatchSize = 64;
+
+	const FName MenuOwner = TEXT("MDMetaDataProjectValidator");
+
+	FDelegateHandle SummaryTagHandle;
+	FDelegateHandle PreSaveHandle;
+	FDelegateHandle PackageDirtyHandle;
+
+	// Summaries are written when an asset is saved and dropped once its package is dirtied, so asking for an asset's tags doesn't gather its fields every time
+	TMap<FName, FString> SavedSummaries;
+
+	FString Escape(const FString& Value)
+	{
+		return Value.ReplaceCharWithEscapedChar();
+	}
+
+	FString Unescape(const FString& Value)
+	{
+		return Value.ReplaceEscapedCharWithChar();
+	}
+
+	FName GetFunctionName(const UK2Node_FunctionEntry* EntryNode)
+	{
+		return (EntryNode->CustomGeneratedFunctionName != NAME_None) ? EntryNode->CustomGeneratedFunctionName : EntryNode->GetGraph()->GetFName();
+	}
+
+	bool IsSummarizedAsset(const UObject* Object)
+	{
+		return Object != nullptr && Object->IsAsset() && (Object->IsA<UBlueprint>() || Object->IsA<UUserDefinedStruct>());
+	}
+
+	// Types have to be matched against the keys' types, so ones that aren't loaded are loaded rather than skipped
+	UObject* ResolveTypeObject(const FString& Path, TMap<FString, UObject*>& InOutTypeObjects)
+	{
+		if (Path.IsEmpty())
+		{
+			return nullptr;
+		}
+
+		if (UObject** TypeObject = InOutTypeObjects.Find(Path))
+		{
+			return *TypeObject;
+		}
+
+		UObject* TypeObject = FindObject<UObject>(nullptr, *Path);
+		if (TypeObject == nullptr)
+		{
+			TypeObject = LoadObject<UObject>(nullptr, *Path, nullptr, LOAD_NoWarn | LOAD_Quiet);
+		}
+
+		return InOutTypeObjects.Add(Path, TypeObject);
+	}
+
+	void AddVariableField(EMDMetaDataKeyUsage Usage, FName ScopeName, const FBPVariableDescription& Variable, const UStruct* Owner, TArray<FMDMetaDataFieldSummary>& OutFields)
+	{
+		if (Variable.MetaDataArray.IsEmpty())
+		{
+			return;
+		}
+
+		FMDMetaDataFieldSummary& Field = OutFields.AddDefaulted_GetRef();
+		Field.Usage = Usage;
+		Field.ScopeName = ScopeName;
+		Field.FieldName = Variable.VarName;
+		Field.bHasPinType = true;
+		Field.PinType = Variable.VarType;
+		Field.Owner = Owner;
+		for (const FBPVariableMetaDataEntry& Entry : Variable.MetaDataArray)
+		{
+			Field.MetaData.Add(Entry.DataKey, Entry.DataValue);
+		}
+	}
+
+	void AddPropertyField(EMDMetaDataKeyUsage Usage, FName ScopeName, FName FieldName, const FProperty* Property, const UStruct* Owner, TArray<FMDMetaDataFieldSummary>& OutFields)
+	{
+		const TMap<FName, FString>* MetaData = Property->GetMetaDataMap();
+		if (MetaData == nullptr || MetaData->IsEmpty())
+		{
+			return;
+		}
+
+		FMDMetaDataFieldSummary& Field = OutFields.AddDefaulted_GetRef();
+		Field.Usage = Usage;
+		Field.ScopeName = ScopeName;
+		Field.FieldName = FieldName;
+		Field.bHasPinType = GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(Property, Field.PinType);
+		Field.Owner = Owner;
+		Field.MetaData = *MetaData;
+	}
+
+	void AddFunctionFields(const UClass* Class, FName FunctionName, const TMap<FName, FString>& FunctionMetaData, TArray<FMDMetaDataFieldSummary>& OutFields)
+	{
+		if (!FunctionMetaData.IsEmpty())
+		{
+			FMDMetaDataFieldSummary& Field = OutFields.AddDefaulted_GetRef();
+			Field.Usage = EMDMetaDataKeyUsage::Functions;
+			Field.FieldName = FunctionName;
+			Field.Owner = Class;
+			Field.MetaData = FunctionMetaData;
+		}
+
+		// Params come from the generated class, which is where UMDMetaDataEditorBlueprintCompilerExtension keeps their meta data
+		if (const UFunction* Function = (Class != nullptr) ? Class->FindFunctionByName(FunctionName) : nullptr)
+		{
+			for (TFieldIterator<FProperty> PropIt(Function); PropIt && PropIt->HasAnyPropertyFlags(CPF_Parm); ++PropIt)
+			{
+				AddPropertyField(EMDMetaDataKeyUsage::FunctionParameters, FunctionName, PropIt->GetFName(), *PropIt, Function, OutFields);
+			}
+		}
+	}
+
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+	void AddSummaryTag(FAssetRegistryTagsContext Context)
+	{
+		const UObject* Object = Context.GetObject();
+#else
+	void AddSummaryTag(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags)
+	{
+#endif
+		const FString* Summary = IsSummarizedAsset(Object) ? SavedSummaries.Find(Object->GetPackage()->GetFName()) : nullptr;
+		if (Summary == nullptr)
+		{
+			return;
+		}
+
+		UObject::FAssetRegistryTag Tag(FMDMetaDataProjectValidator::SummaryTagName, *Summary, UObject::FAssetRegistryTag::TT_Hidden);
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+		Context.AddTag(MoveTemp(Tag));
+#else
+		OutTags.Emplace(MoveTemp(Tag));
+#endif
+	}
+
+	void CacheSummary(UObject* Object, FObjectPreSaveContext SaveContext)
+	{
+		// Cooked builds don't validate meta data, so there's no need to carry summaries into them
+		if (SaveContext.IsCooking() || !IsSummarizedAsset(Object))
+		{
+			return;
+		}
+
+		TArray<FMDMetaDataFieldSummary> Fields;
+		FMDMetaDataProjectValidator::GatherFields(Object, Fields);
+		SavedSummaries.Add(Object->GetPackage()->GetFName(), FMDMetaDataProjectValidator::WriteSummary(*GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot(), Fields));
+	}
+
+	void DropSummary(UPackage* Package, bool bWasDirty)
+	{
+		SavedSummaries.Remove(Package->GetFName());
+	}
+}
+
+void FMDMetaDataProjectValidator::RegisterSummaryTag()
+{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+	MDMDPV_Private::SummaryTagHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.AddStatic(&MDMDPV_Private::AddSummaryTag);
+#else
+	MDMDPV_Private::SummaryTagHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddStatic(&MDMDPV_Private::AddSummaryTag);
+#endif
+	MDMDPV_Private::PreSaveHandle = FCoreUObjectDelegates::OnObjectPreSave.AddStatic(&MDMDPV_Private::CacheSummary);
+	MDMDPV_Private::PackageDirtyHandle = UPackage::PackageMarkedDirtyEvent.AddStatic(&MDMDPV_Private::DropSummary);
+}
+
+void FMDMetaDataProjectValidator::UnregisterSummaryTag()
+{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4) // On or after UE 5.4
+	UObject::FAssetRegistryTag::OnGetExtraObjectTagsWithContext.Remove(MDMDPV_Private::SummaryTagHandle);
+#else
+	UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(MDMDPV_Private::SummaryTagHandle);
+#endif
+	MDMDPV_Private::SummaryTagHandle.Reset();
+
+	FCoreUObjectDelegates::OnObjectPreSave.Remove(MDMDPV_Private::PreSaveHandle);
+	MDMDPV_Private::PreSaveHandle.Reset();
+	UPackage::PackageMarkedDirtyEvent.Remove(MDMDPV_Private::PackageDirtyHandle);
+	MDMDPV_Private::PackageDirtyHandle.Reset();
+	MDMDPV_Private::SavedSummaries.Empty();
+}
+
+void FMDMetaDataProjectValidator::GatherFields(const UObject* Asset, TArray<FMDMetaDataFieldSummary>& OutFields)
+{
+	check(IsInGameThread());
+
+	if (const UUserDefinedStruct* Struct = Cast<UUserDefinedStruct>(Asset))
+	{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6) // On or after UE 5.6
+		const TMap<FName, FString>* StructMetaData = FMetaData::GetMapForObject(Struct);
+#else // Pre UE 5.6
+		const TMap<FName, FString>* StructMetaData = UMetaData::GetMapForObject(Struct);
+#endif
+		if (StructMetaData != nullptr && !StructMetaData->IsEmpty())
+		{
+			FMDMetaDataFieldSummary& Field = OutFields.AddDefaulted_GetRef();
+			Field.Usage = EMDMetaDataKeyUsage::Structs;
+			Field.FieldName = Struct->GetFName();
+			Field.MetaData = *StructMetaData;
+		}
+
+		// Member names are mangled so they can't be resolved as property references, name them the way the user sees them instead
+		for (TFieldIterator<FProperty> PropIt(Struct); PropIt; ++PropIt)
+		{
+			MDMDPV_Private::AddPropertyField(EMDMetaDataKeyUsage::None, NAME_None, FName(*PropIt->GetAuthoredName()), *PropIt, nullptr, OutFields);
+		}
+
+		return;
+	}
+
+	const UBlueprint* Blueprint = Cast<UBlueprint>(Asset);
+	if (!IsValid(Blueprint))
+	{
+		return;
+	}
+
+	const UClass* Class = (Blueprint->GeneratedClass != nullptr) ? Blueprint->GeneratedClass.Get() : Blueprint->SkeletonGeneratedClass.Get();
+
+	for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+	{
+		MDMDPV_Private::AddVariableField(EMDMetaDataKeyUsage::Variables, NAME_None, Variable, Class, OutFields);
+	}
+
+	for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		TArray<UK2Node_FunctionEntry*> EntryNodes;
+		Graph->GetNodesOfClass(EntryNodes);
+		if (EntryNodes.Num() == 0)
+		{
+			continue;
+		}
+
+		const UK2Node_FunctionEntry* EntryNode = EntryNodes[0];
+		const FName FunctionName = MDMDPV_Private::GetFunctionName(EntryNode);
+		MDMDPV_Private::AddFunctionFields(Class, FunctionName, EntryNode->MetaData.GetMetaDataMap(), OutFields);
+
+		const UFunction* Function = (Class != nullptr) ? Class->FindFunctionByName(FunctionName) : nullptr;
+		for (const FBPVariableDescription& LocalVariable : EntryNode->LocalVariables)
+		{
+			MDMDPV_Private::AddVariableField(EMDMetaDataKeyUsage::LocalVariables, FunctionName, LocalVariable, Function, OutFields);
+		}
+	}
+
+	TArray<UK2Node_CustomEvent*> EventNodes;
+	FBlueprintEditorUtils::GetAllNodesOfClass(Blueprint, EventNodes);
+	for (UK2Node_CustomEvent* EventNode : EventNodes)
+	{
+		MDMDPV_Private::AddFunctionFields(Class, EventNode->CustomFunctionName, EventNode->GetUserDefinedMetaData().GetMetaDataMap(), OutFields);
+	}
+}
+
+FString FMDMetaDataProjectValidator::WriteSummary(const FMDMetaDataEditorConfigSnapshot& Snapshot, TConstArrayView<FMDMetaDataFieldSummary> Fields)
+{
+	using namespace MDMDPV_Private;
+
+	auto GetObjectPath = [](const UObject* Object)
+	{
+		return (Object != nullptr) ? FSoftObjectPath(Object).ToString() : FString();
+	};
+
+	// A header line with the keys the summary was filtered by, then one line per field followed by one line per key.
+	// Values are escaped so tabs and new lines only ever separate columns and rows.
+	TStringBuilder<1024> Builder;
+	Builder << SummaryVersion << TEXT("\t") << Snapshot.GetValidatedMetaDataHash();
+	for (const FMDMetaDataFieldSummary& Field : Fields)
+	{
+		if (!Algo::AnyOf(Field.MetaData, [&Snapshot](const TPair<FName, FString>& MetaDataPair) { return Snapshot.IsValidatedMetaData(MetaDataPair.Key); }))
+		{
+			continue;
+		}
+
+		const FEdGraphTerminalType& ValueType = Field.PinType.PinValueType;
+		Builder << TEXT("\nF\t") << static_cast<int32>(Field.Usage)
+			<< TEXT("\t") << Escape(Field.ScopeName.ToString())
+			<< TEXT("\t") << Escape(Field.FieldName.ToString())
+			<< TEXT("\t") << (Field.bHasPinType ? 1 : 0)
+			<< TEXT("\t") << Field.PinType.PinCategory.ToString()
+			<< TEXT("\t") << Field.PinType.PinSubCategory.ToString()
+			<< TEXT("\t") << GetObjectPath(Field.bHasPinType ? Field.PinType.PinSubCategoryObject.Get() : nullptr)
+			<< TEXT("\t") << static_cast<int32>(Field.PinType.ContainerType)
+			<< TEXT("\t") << ValueType.TerminalCategory.ToString()
+			<< TEXT("\t") << ValueType.TerminalSubCategory.ToString()
+			<< TEXT("\t") << GetObjectPath(Field.bHasPinType ? ValueType.TerminalSubCategoryObject.Get() : nullptr);
+
+		for (const TPair<FName, FString>& MetaDataPair : Field.MetaData)
+		{
+			if (Snapshot.IsValidatedMetaData(MetaDataPair.Key))
+			{
+				Builder << TEXT("\nK\t") << Escape(MetaDataPair.Key.ToString()) << TEXT("\t") << Escape(MetaDataPair.Value);
+			}
+		}
+	}
+
+	return FString(Builder.ToView());
+}
+
+bool FMDMetaDataProjectValidator::ReadSummary(FStringView Summary, const FMDMetaDataEditorConfigSnapshot& Snapshot, TArray<FMDMetaDataFieldSummary>& OutFields)
+{
+	using namespace MDMDPV_Private;
+
+	TArray<FString> Lines;
+	FString(Summary).ParseIntoArrayLines(Lines);
+	if (Lines.IsEmpty())
+	{
+		return false;
+	}
+
+	// Summaries only hold the meta data that was validated when they were written, so they're out of date once the keys change
+	TArray<FString> Columns;
+	Lines[0].ParseIntoArray(Columns, TEXT("\t"), false);
+	if (Columns.Num() != 2 || Columns[0] != SummaryVersion || FCString::Strtoui64(*Columns[1], nullptr, 10) != Snapshot.GetValidatedMetaDataHash())
+	{
+		return false;
+	}
+
+	for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+	{
+		Columns.Reset();
+		Lines[LineIndex].ParseIntoArray(Columns, TEXT("\t"), false);
+
+		if (Columns.Num() == 12 && Columns[0] == TEXT("F"))
+		{
+			FMDMetaDataFieldSummary& Field = OutFields.AddDefaulted_GetRef();
+			Field.Usage = static_cast<EMDMetaDataKeyUsage>(FCString::Atoi(*Columns[1]));
+			Field.ScopeName = FName(*Unescape(Columns[2]));
+			Field.FieldName = FName(*Unescape(Columns[3]));
+			Field.bHasPinType = Columns[4] == TEXT("1");
+			Field.PinType.PinCategory = FName(*Columns[5]);
+			Field.PinType.PinSubCategory = FName(*Columns[6]);
+			Field.PinSubCategoryObjectPath = MoveTemp(Columns[7]);
+			Field.PinType.ContainerType = static_cast<EPinContainerType>(FCString::Atoi(*Columns[8]));
+			Field.PinType.PinValueType.TerminalCategory = FName(*Columns[9]);
+			Field.PinType.PinValueType.TerminalSubCategory = FName(*Columns[10]);
+			Field.PinValueSubCategoryObjectPath = MoveTemp(Columns[11]);
+		}
+		else if (Columns.Num() == 3 && Columns[0] == TEXT("K") && OutFields.Num() > 0)
+		{
+			OutFields.Last().MetaData.Add(FName(*Unescape(Columns[1])), Unescape(Columns[2]));
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FMDMetaDataProjectValidator::MayHaveMetaData(const FAssetData& AssetData, const FMDMetaDataEditorConfigSnapshot& Snapshot, const TSet<FName>& Keys)
+{
+	FString Summary;
+	if (!CanUseSummary(AssetData) || !AssetData.GetTagValue(SummaryTagName, Summary))
+	{
+		return true;
+	}
+
+	TArray<FMDMetaDataFieldSummary> Fields;
+	if (!ReadSummary(Summary, Snapshot, Fields))
+	{
+		return true;
+	}
+
+	return Algo::AnyOf(Fields, [&Keys](const FMDMetaDataFieldSummary& Field)
+	{
+		return Algo::AnyOf(Field.MetaData, [&Keys](const TPair<FName, FString>& MetaDataPair) { return Keys.Contains(MetaDataPair.Key); });
+	});
+}
+
+void FMDMetaDataProjectValidator::GatherAssetFields(const FMDMetaDataEditorConfigSnapshot& Snapshot, TConstArrayView<FAssetData> Assets, bool bLoadUnsummarizedAssets, const FText& LoadingText, TFunctionRef<void(TArrayView<FMDMetaDataAssetFields>)> OnBatch)
+{
+	check(IsInGameThread());
+
+	// Whether a summary is up to date depends on the loaded packages, so the assets are split up before going wide
+	TArray<const FAssetData*> SummarizedAssets;
+	TArray<const FAssetData*> UnsummarizedAssets;
+	for (const FAssetData& AssetData : Assets)
+	{
+		if (CanUseSummary(AssetData))
+		{
+			SummarizedAssets.Add(&AssetData);
+		}
+		else if (bLoadUnsummarizedAssets)
+		{
+			UnsummarizedAssets.Add(&AssetData);
+		}
+	}
+
+	// Reading the summaries is plain string work, so it's done in parallel
+	TArray<FMDMetaDataAssetFields> SummarizedFields;
+	SummarizedFields.SetNum(SummarizedAssets.Num());
+	TArray<bool> WasRead;
+	WasRead.SetNumZeroed(SummarizedAssets.Num());
+	ParallelFor(SummarizedAssets.Num(), [&SummarizedAssets, &Snapshot, &SummarizedFields, &WasRead](int32 Index)
+	{
+		FString Summary;
+		SummarizedAssets[Index]->GetTagValue(SummaryTagName, Summary);
+		WasRead[Index] = ReadSummary(Summary, Snapshot, SummarizedFields[Index].Fields);
+	});
+
+	for (int32 Index = SummarizedFields.Num() - 1; Index >= 0; --Index)
+	{
+		if (WasRead[Index])
+		{
+			SummarizedFields[Index].AssetPath = SummarizedAssets[Index]->GetSoftObjectPath();
+			SummarizedFields[Index].BlueprintClass = GetBlueprintClass(*SummarizedAssets[Index]);
+		}
+		else
+		{
+			if (bLoadUnsummarizedAssets)
+			{
+				UnsummarizedAssets.Add(SummarizedAssets[Index]);
+			}
+
+			SummarizedFields.RemoveAtSwap(Index);
+		}
+	}
+
+	if (!SummarizedFields.IsEmpty())
+	{
+		OnBatch(SummarizedFields);
+	}
+
+	if (UnsummarizedAssets.IsEmpty())
+	{
+		return;
+	}
+
+	FScopedSlowTask SlowTask(UnsummarizedAssets.Num(), LoadingText);
+	SlowTask.MakeDialogDelayed(0.5f);
+
+	for (int32 BatchStart = 0; BatchStart < UnsummarizedAssets.Num(); BatchStart += MDMDPV_Private::BatchSize)
+	{
+		const int32 BatchNum = FMath::Min(MDMDPV_Private::BatchSize, UnsummarizedAssets.Num() - BatchStart);
+		SlowTask.EnterProgressFrame(BatchNum);
+
+		// Loading and walking the fields has to happen on the game thread
+		TArray<FMDMetaDataAssetFields> BatchFields;
+		BatchFields.SetNum(BatchNum);
+		bool bDidLoadAssets = false;
+		for (int32 i = 0; i < BatchNum; ++i)
+		{
+			const FAssetData& AssetData = *UnsummarizedAssets[BatchStart + i];
+			bDidLoadAssets |= !AssetData.IsAssetLoaded();
+			const UObject* Asset = AssetData.GetAsset();
+
+			FMDMetaDataAssetFields& AssetFields = BatchFields[i];
+			AssetFields.AssetPath = AssetData.GetSoftObjectPath();
+			AssetFields.BlueprintClass = GetBlueprintClass(Asset);
+			GatherFields(Asset, AssetFields.Fields);
+		}
+
+		OnBatch(BatchFields);
+
+		// The fields point into the batch's assets, so they have to go before the assets can
+		BatchFields.Empty();
+		if (bDidLoadAssets)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+}
+
+void FMDMetaDataProjectValidator::ValidateAssets(TConstArrayView<FAssetData> Assets, bool bLoadUnsummarizedAssets, TMap<FSoftObjectPath, TArray<FText>>& OutIssues, TSet<FSoftObjectPath>* OutValidatedAssets)
+{
+	check(IsInGameThread());
+
+	const TSharedRef<const FMDMetaDataEditorConfigSnapshot> Snapshot = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot();
+	TMap<FReferenceKey, bool> References;
+
+	GatherAssetFields(*Snapshot, Assets, bLoadUnsummarizedAssets, INVTEXT("Validating Meta Data..."), [&Snapshot, &References, &OutIssues, OutValidatedAssets](TArrayView<FMDMetaDataAssetFields> Batch)
+	{
+		// The game thread is blocked until the batch is validated, so loaded assets can't change or be collected underneath it
+		TArray<TArray<FText>> BatchIssues;
+		BatchIssues.SetNum(Batch.Num());
+		ResolveReferences(*Snapshot, Batch, References);
+		ValidateAssetFields(*Snapshot, Batch, References, BatchIssues);
+
+		for (int32 Index = 0; Index < Batch.Num(); ++Index)
+		{
+			if (OutValidatedAssets != nullptr)
+			{
+				OutValidatedAssets->Add(Batch[Index].AssetPath);
+			}
+
+			if (!BatchIssues[Index].IsEmpty())
+			{
+				OutIssues.FindOrAdd(Batch[Index].AssetPath).Append(MoveTemp(BatchIssues[Index]));
+			}
+		}
+	});
+}
+
+void FMDMetaDataProjectValidator::ValidateLoadedAsset(const UObject* Asset, TArray<FText>& OutIssues)
+{
+	check(IsInGameThread());
+
+	const TSharedRef<const FMDMetaDataEditorConfigSnapshot> Snapshot = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot();
+	TMap<FReferenceKey, bool> References;
+
+	FMDMetaDataAssetFields AssetFields;
+	AssetFields.BlueprintClass = GetBlueprintClass(Asset);
+	GatherFields(Asset, AssetFields.Fields);
+
+	ResolveReferences(*Snapshot, MakeArrayView(&AssetFields, 1), References);
+	ValidateAssetFields(*Snapshot, AssetFields, References, OutIssues);
+}
+
+void FMDMetaDataProjectValidator::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(MDMDPV_Private::MenuOwner);
+
+	UToolMenu* Menu = UToolMenus::Get()->ExtendMenu(TEXT("ContentBrowser.FolderContextMenu"));
+	FToolMenuSection& Section = Menu->FindOrAddSection(TEXT("PathContextBulkOperations"));
+	Section.AddDynamicEntry(TEXT("MDMetaDataValidate"), FNewToolMenuSectionDelegate::CreateLambda([](FToolMenuSection& InSection)
+	{
+		const UContentBrowserFolderContext* Context = InSection.FindContext<UContentBrowserFolderContext>();
+		if (Context == nullptr || Context->GetSelectedPackagePaths().Num() == 0)
+		{
+			return;
+		}
+
+		InSection.AddMenuEntry(
+			TEXT("MDValidateMetaData"),
+			INVTEXT("Validate Meta Data"),
+			INVTEXT("Check the meta data of every Blueprint and User Defined Struct in the selected folders against the Meta Data Editor's keys"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), TEXT("Icons.Check")),
+			FUIAction(FExecuteAction::CreateStatic(&FMDMetaDataProjectValidator::ValidateFolders, Context->GetSelectedPackagePaths()))
+		);
+	}));
+}
+
+void FMDMetaDataProjectValidator::UnregisterMenus()
+{
+	if (UToolMenus* ToolMenus = UToolMenus::TryGet())
+	{
+		ToolMenus->UnregisterOwnerByName(MDMDPV_Private::MenuOwner);
+	}
+}
+
+const UClass* FMDMetaDataProjectValidator::GetBlueprintClass(const FAssetData& AssetData)
+{
+	// Struct keys are tested as if the struct were a basic Blueprint
+	const UClass* AssetClass = FindObject<UClass>(AssetData.AssetClassPath);
+	return (AssetClass != nullptr && AssetClass->IsChildOf<UBlueprint>()) ? AssetClass : UBlueprint::StaticClass();
+}
+
+const UClass* FMDMetaDataProjectValidator::GetBlueprintClass(const UObject* Asset)
+{
+	return (Asset != nullptr && Asset->IsA<UBlueprint>()) ? Asset->GetClass() : UBlueprint::StaticClass();
+}
+
+bool FMDMetaDataProjectValidator::CanUseSummary(const FAssetData& AssetData)
+{
+	if (!AssetData.FindTag(SummaryTagName))
+	{
+		return false;
+	}
+
+	// The summary was written when the asset was saved, so it's out of date if there are unsaved changes
+	const UPackage* Package = FindPackage(nullptr, *AssetData.PackageName.ToString());
+	return Package == nullptr || !Package->IsDirty();
+}
+
+void FMDMetaDataProjectValidator::ResolveReferences(const FMDMetaDataEditorConfigSnapshot& Snapshot, TArrayView<FMDMetaDataAssetFields> Assets, TMap<FReferenceKey, bool>& InOutReferences)
+{
+	check(IsInGameThread());
+
+	TMap<FString, UObject*> TypeObjects;
+	TMap<const UStruct*, TSharedPtr<const TSet<FName>>> OwnerPropertyNames;
+	for (FMDMetaDataAssetFields& AssetFields : Assets)
+	{
+		AssetFields.ResolvedBlueprintClass.Emplace(AssetFields.BlueprintClass);
+
+		for (FMDMetaDataFieldSummary& Field : AssetFields.Fields)
+		{
+			if (Field.bHasPinType && (!Field.PinSubCategoryObjectPath.IsEmpty() || !Field.PinValueSubCategoryObjectPath.IsEmpty()))
+			{
+				Field.PinType.PinSubCategoryObject = MDMDPV_Private::ResolveTypeObject(Field.PinSubCategoryObjectPath, TypeObjects);
+				Field.PinType.PinValueType.TerminalSubCategoryObject = MDMDPV_Private::ResolveTypeObject(Field.PinValueSubCategoryObjectPath, TypeObjects);
+
+				// Only types that no longer exist skip the type checks
+				Field.bHasPinType = (Field.PinSubCategoryObjectPath.IsEmpty() || Field.PinType.PinSubCategoryObject.IsValid())
+					&& (Field.PinValueSubCategoryObjectPath.IsEmpty() || Field.PinType.PinValueType.TerminalSubCategoryObject.IsValid());
+			}
+
+			if (Field.bHasPinType)
+			{
+				Field.ResolvedPinType.Emplace(Field.PinType);
+				Field.PinTypeText = UEdGraphSchema_K2::TypeToText(Field.PinType);
+			}
+
+			if (Field.Owner != nullptr)
+			{
+				TSharedPtr<const TSet<FName>>& PropertyNames = OwnerPropertyNames.FindOrAdd(Field.Owner);
+				if (!PropertyNames.IsValid())
+				{
+					TSharedRef<TSet<FName>> NewPropertyNames = MakeShared<TSet<FName>>();
+					FMDMetaDataValidator::GetOwnerPropertyNames(Field.Owner, *NewPropertyNames);
+					PropertyNames = NewPropertyNames;
+				}
+
+				Field.OwnerPropertyNames = PropertyNames;
+			}
+
+			FMDMetaDataValidator::ForEachReference(Snapshot, Field.MetaData, [&InOutReferences](EMDMetaDataReferenceType Type, const FString& Name)
+			{
+				const FReferenceKey Key(static_cast<uint8>(Type), Name);
+				if (!InOutReferences.Contains(Key))
+				{
+					InOutReferences.Add(Key, FMDMetaDataValidator::DoesReferenceExist(Type, Name));
+				}
+			});
+		}
+	}
+}
+
+void FMDMetaDataProjectValidator::ValidateAssetFields(const FMDMetaDataEditorConfigSnapshot& Snapshot, TConstArrayView<FMDMetaDataAssetFields> Assets, const TMap<FReferenceKey, bool>& References, TArrayView<TArray<FText>> OutIssues)
+{
+	check(Assets.Num() == OutIssues.Num());
+
+	ParallelFor(Assets.Num(), [&Snapshot, &Assets, &References, &OutIssues](int32 Index)
+	{
+		ValidateAssetFields(Snapshot, Assets[Index], References, OutIssues[Index]);
+	});
+}
+
+void FMDMetaDataProjectValidator::ValidateAssetFields(const FMDMetaDataEditorConfigSnapshot& Snapshot, const FMDMetaDataAssetFields& Asset, const TMap<FReferenceKey, bool>& References, TArray<FText>& OutIssues)
+{
+	// Everything the meta data references was resolved up front, anything missing from the map wasn't a reference when it was resolved
+	auto Resolver = [&References](EMDMetaDataReferenceType Type, const FString& Name)
+	{
+		const bool* bExists = References.Find(FReferenceKey(static_cast<uint8>(Type), Name));
+		return bExists == nullptr || *bExists;
+	};
+
+	TArray<FText> FieldIssues;
+	for (const FMDMetaDataFieldSummary& Field : Asset.Fields)
+	{
+		FMDMetaDataValidationField ValidationField;
+		ValidationField.Usage = Field.Usage;
+		ValidationField.BlueprintClass = Asset.ResolvedBlueprintClass.GetPtrOrNull();
+		ValidationField.PinType = Field.ResolvedPinType.GetPtrOrNull();
+		ValidationField.PinTypeText = Field.PinTypeText;
+		ValidationField.OwnerPropertyNames = Field.OwnerPropertyNames.Get();
+		ValidationField.MetaData = &Field.MetaData;
+
+		FieldIssues.Reset();
+		FMDMetaDataValidator::ValidateField(Snapshot, ValidationField, Resolver, FieldIssues);
+
+		const FText FieldText = Field.ScopeName.IsNone()
+			? FText::FromName(Field.FieldName)
+			: FText::Format(INVTEXT("{0}.{1}"), FText::FromName(Field.ScopeName), FText::FromName(Field.FieldName));
+		for (const FText& Issue : FieldIssues)
+		{
+			OutIssues.Add(FText::Format(INVTEXT("{0}: {1}"), FieldText, Issue));
+		}
+	}
+}
+
+void FMDMetaDataProjectValidator::ValidateFolders(TArray<FString> PackagePaths)
+{
+	TArray<FAssetData> Assets;
+	FMDMetaDataExporter::GatherAssets(PackagePaths, Assets);
+
+	TMap<FSoftObjectPath, TArray<FText>> Issues;
+	ValidateAssets(Assets, true, Issues);
+
+	FMessageLog AssetCheck(TEXT("AssetCheck"));
+	AssetCheck.NewPage(INVTEXT("Meta Data Validation"));
+	for (const TPair<FSoftObjectPath, TArray<FText>>& AssetIssues : Issues)
+	{
+		for (const FText& Issue : AssetIssues.Value)
+		{
+			AssetCheck.Warning()
+				->AddToken(FAssetNameToken::Create(AssetIssues.Key.ToString()))
+				->AddToken(FTextToken::Create(Issue));
+		}
+	}
+
+	if (Issues.Num() > 0)
+	{
+		AssetCheck.Open(EMessageSeverity::Warning);
+	}
+
+	FNotificationInfo Info(FText::Format(INVTEXT("Validated the meta data of {0} assets, {1} with issues"), FText::AsNumber(Assets.Num()), FText::AsNumber(Issues.Num())));
+	Info.ExpireDuration = 5.f;
+	if (TSharedPtr<SNotificationItem> Notification = FSlateNotificationManager::Get().AddNotification(Info))
+	{
+		Notification->SetCompletionState(Issues.Num() > 0 ? SNotificationItem::CS_Fail : SNotificationItem::CS_Success);
+	}
+}
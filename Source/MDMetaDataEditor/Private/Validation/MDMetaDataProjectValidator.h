@@ -0,0 +1,105 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
+#include "Containers/StringView.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Templates/Function.h"
+
+// The meta data of a single field of an asset, copied out so it can be validated off the game thread
+struct FMDMetaDataFieldSummary
+{
+	EMDMetaDataKeyUsage Usage = EMDMetaDataKeyUsage::None;
+	FName ScopeName = NAME_None;
+	FName FieldName = NAME_None;
+
+	bool bHasPinType = false;
+	FEdGraphPinType PinType;
+
+	// Only set when read from a summary, the pin type's sub category objects are left for the reader to resolve
+	FString PinSubCategoryObjectPath;
+	FString PinValueSubCategoryObjectPath;
+
+	// Only set when gathered from a loaded asset
+	const UStruct* Owner = nullptr;
+
+	TMap<FName, FString> MetaData;
+
+	// Set when the field's references are resolved on the game thread, so it can be validated off of it
+	TOptional<FMDMetaDataResolvedPinType> ResolvedPinType;
+	FText PinTypeText;
+	TSharedPtr<const TSet<FName>> OwnerPropertyNames;
+};
+
+// The meta data fields of a single asset
+struct FMDMetaDataAssetFields
+{
+	FSoftObjectPath AssetPath;
+	const UClass* BlueprintClass = nullptr;
+	TArray<FMDMetaDataFieldSummary> Fields;
+
+	// Set along with the fields' resolved types
+	TOptional<FMDMetaDataResolvedClass> ResolvedBlueprintClass;
+};
+
+/**
+ * Validates the meta data of Blueprints and User Defined Structs in bulk.
+ * Assets saved with the plugin enabled carry a summary of their meta data in an asset registry tag so they can be validated without being loaded,
+ * the rest are loaded in batches. Either way the checks run in parallel against the config snapshot.
+ */
+class FMDMetaDataProjectValidator
+{
+public:
+	static const FName SummaryTagName;
+
+	static void RegisterSummaryTag();
+	static void UnregisterSummaryTag();
+
+	// Must be called on the game thread
+	static void GatherFields(const UObject* Asset, TArray<FMDMetaDataFieldSummary>& OutFields);
+
+	// Only the meta data the snapshot validates is written, fields without any are left out
+	static FString WriteSummary(const FMDMetaDataEditorConfigSnapshot& Snapshot, TConstArrayView<FMDMetaDataFieldSummary> Fields);
+
+	// Returns false if the summary was written in a format this version can't read, or for a different set of keys than the snapshot's
+	static bool ReadSummary(FStringView Summary, const FMDMetaDataEditorConfigSnapshot& Snapshot, TArray<FMDMetaDataFieldSummary>& OutFields);
+
+	// Whether any field of the asset may have meta data for one of Keys, which must be validated by the snapshot.
+	// Read from the asset's summary, assets without an up to date one are assumed to. Must be called on the game thread.
+	static bool MayHaveMetaData(const FAssetData& AssetData, const FMDMetaDataEditorConfigSnapshot& Snapshot, const TSet<FName>& Keys);
+
+	// Gathers the fields of each asset and passes them to OnBatch, a batch at a time. Summaries that are up to date are read in parallel and passed as one batch,
+	// the other assets are skipped unless bLoadUnsummarizedAssets is set, in which case they're loaded in batches with garbage collected after each one.
+	// Fields gathered from loaded assets point into them, so they're only valid until OnBatch returns. Must be called on the game thread.
+	static void GatherAssetFields(const FMDMetaDataEditorConfigSnapshot& Snapshot, TConstArrayView<FAssetData> Assets, bool bLoadUnsummarizedAssets, const FText& LoadingText, TFunctionRef<void(TArrayView<FMDMetaDataAssetFields>)> OnBatch);
+
+	// Adds the issues found on each asset, keyed by the asset's object path. Assets without issues aren't added.
+	// If OutValidatedAssets is set, it's filled with every asset that was validated, since assets without a summary are skipped unless bLoadUnsummarizedAssets is set.
+	static void ValidateAssets(TConstArrayView<FAssetData> Assets, bool bLoadUnsummarizedAssets, TMap<FSoftObjectPath, TArray<FText>>& OutIssues, TSet<FSoftObjectPath>* OutValidatedAssets = nullptr);
+
+	// Validates a single loaded asset on the game thread
+	static void ValidateLoadedAsset(const UObject* Asset, TArray<FText>& OutIssues);
+
+	// The class keys test Blueprint classes against, struct keys are tested as if the struct were a basic Blueprint
+	static const UClass* GetBlueprintClass(const FAssetData& AssetData);
+	static const UClass* GetBlueprintClass(const UObject* Asset);
+
+	static void RegisterMenus();
+	static void UnregisterMenus();
+
+private:
+	typedef TPair<uint8, FString> FReferenceKey;
+
+	// Whether the asset has a summary that's up to date with the asset, must be called on the game thread
+	static bool CanUseSummary(const FAssetData& AssetData);
+
+	// Resolves the types of the fields and everything the meta data references, on the game thread
+	static void ResolveReferences(const FMDMetaDataEditorConfigSnapshot& Snapshot, TArrayView<FMDMetaDataAssetFields> Assets, TMap<FReferenceKey, bool>& InOutReferences);
+	// Adds the issues found on each asset to the matching entry of OutIssues
+	static void ValidateAssetFields(const FMDMetaDataEditorConfigSnapshot& Snapshot, TConstArrayView<FMDMetaDataAssetFields> Assets, const TMap<FReferenceKey, bool>& References, TArrayView<TArray<FText>> OutIssues);
+	static void ValidateAssetFields(const FMDMetaDataEditorConfigSnapshot& Snapshot, const FMDMetaDataAssetFields& Asset, const TMap<FReferenceKey, bool>& References, TArray<FText>& OutIssues);
+
+	static void ValidateFolders(TArray<FString> PackagePaths);
+};
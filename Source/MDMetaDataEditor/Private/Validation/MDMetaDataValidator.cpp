@@ -0,0 +1,559 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataValidator.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Config/MDMetaDataEditorConfig.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "GameplayTagsManager.h"
+#include "K2Node_CustomEvent.h"
+#include "K2Node_FunctionEntry.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "MDMetaDataCompilerHooks.h"
+#include "Misc/PackageName.h"
+
+namespace MDMDV_Private
+{
+	// Blueprint classes aren't assets themselves, so their paths (eg. /Game/BP_Foo.BP_Foo_C) are matched against the GeneratedClassPath tag of the Blueprint they come from
+	bool DoesBlueprintClassExist(const IAssetRegistry& AssetRegistry, const FString& Path)
+	{
+		FString BlueprintPath = Path;
+		if (!BlueprintPath.RemoveFromEnd(TEXT("_C")))
+		{
+			return false;
+		}
+
+		const FAssetData AssetData = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(BlueprintPath));
+		FString GeneratedClassPath;
+		return AssetData.IsValid()
+			&& AssetData.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassPath)
+			&& FPackageName::ExportTextPathToObjectPath(GeneratedClassPath) == Path;
+	}
+
+	template<typename T>
+	bool DoesObjectExist(const FString& Name)
+	{
+		if (Name.IsEmpty())
+		{
+			return false;
+		}
+
+		if (FPackageName::IsValidObjectPath(Name))
+		{
+			if (FindObject<T>(nullptr, *Name) != nullptr)
+			{
+				return true;
+			}
+
+			// Blueprint types may not be loaded yet
+			const IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+			return AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(Name)).IsValid() || DoesBlueprintClassExist(AssetRegistry, Name);
+		}
+
+		return FindFirstObject<T>(*Name, EFindFirstObjectOptions::None) != nullptr;
+	}
+
+	void ForEachKeyReference(const FMDMetaDataKey& Key, const FString& Value, TFunctionRef<void(EMDMetaDataReferenceType, const FString&)> Func)
+	{
+		switch (Key.KeyType)
+		{
+		case EMDMetaDataEditorKeyType::GameplayTag:
+			Func(EMDMetaDataReferenceType::GameplayTag, Value);
+			break;
+		case EMDMetaDataEditorKeyType::GameplayTagContainer:
+		{
+			TArray<FString> Tags;
+			Value.ParseIntoArray(Tags, TEXT(","));
+			for (FString& Tag : Tags)
+			{
+				Tag.TrimStartAndEndInline();
+				Func(EMDMetaDataReferenceType::GameplayTag, Tag);
+			}
+			break;
+		}
+		case EMDMetaDataEditorKeyType::Struct:
+		case EMDMetaDataEditorKeyType::Class:
+		case EMDMetaDataEditorKeyType::Interface:
+		{
+			const EMDMetaDataReferenceType Type = (Key.KeyType == EMDMetaDataEditorKeyType::Struct) ? EMDMetaDataReferenceType::Struct : EMDMetaDataReferenceType::Class;
+			if (!Key.bAllowMultipleValues)
+			{
+				Func(Type, Value);
+				break;
+			}
+
+			TArray<FString> Types;
+			Value.ParseIntoArray(Types, TEXT(","));
+			for (FString& TypePath : Types)
+			{
+				TypePath.TrimStartAndEndInline();
+				Func(Type, TypePath);
+			}
+			break;
+		}
+		case EMDMetaDataEditorKeyType::String:
+			if (Key.ValueReference == EMDMetaDataValueReference::Struct)
+			{
+				Func(EMDMetaDataReferenceType::Struct, Value);
+			}
+			else if (Key.ValueReference == EMDMetaDataValueReference::Class)
+			{
+				Func(EMDMetaDataReferenceType::Class, Value);
+			}
+			else if (Key.ValueReference == EMDMetaDataValueReference::Enum)
+			{
+				Func(EMDMetaDataReferenceType::Enum, Value);
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	// Matches full (EFoo::Bar) and short (Bar) names, like UEnum::GetIndexByNameString
+	bool HasEnumValue(TConstArrayView<FName> EnumValueNames, const FString& Value)
+	{
+		const bool bIsFullName = Value.Contains(TEXT("::"));
+		for (const FName& EnumValueName : EnumValueNames)
+		{
+			const FString NameString = EnumValueName.ToString();
+			FString ShortName;
+			if (NameString == Value || (!bIsFullName && NameString.Split(TEXT("::"), nullptr, &ShortName) && ShortName == Value))
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	// Structs, classes, enums and properties can be removed or renamed without the meta data that names them changing
+	bool DoesKeyNameObjects(const FMDMetaDataKey& Key)
+	{
+		switch (Key.KeyType)
+		{
+		case EMDMetaDataEditorKeyType::Struct:
+		case EMDMetaDataEditorKeyType::Class:
+		case EMDMetaDataEditorKeyType::Interface:
+		case EMDMetaDataEditorKeyType::EnumValue:
+			return true;
+		case EMDMetaDataEditorKeyType::String:
+			return Key.ValueReference != EMDMetaDataValueReference::None;
+		default:
+			return false;
+		}
+	}
+
+	FText MakeReferenceIssue(const FText& KeyText, EMDMetaDataReferenceType Type, const FString& Name)
+	{
+		const FText NameText = FText::FromString(Name);
+		switch (Type)
+		{
+		case EMDMetaDataReferenceType::Struct:
+			return FText::Format(INVTEXT("{0} names a struct that doesn't exist: \"{1}\""), KeyText, NameText);
+		case EMDMetaDataReferenceType::Class:
+			return FText::Format(INVTEXT("{0} names a class that doesn't exist: \"{1}\""), KeyText, NameText);
+		case EMDMetaDataReferenceType::Enum:
+			return FText::Format(INVTEXT("{0} names an enum that doesn't exist: \"{1}\""), KeyText, NameText);
+		default:
+			return FText::Format(INVTEXT("{0} names a Gameplay Tag that isn't registered: \"{1}\""), KeyText, NameText);
+		}
+	}
+
+	void ValidateKey(const FMDMetaDataEditorConfigSnapshot& Snapshot, int32 KeyIndex, const TBitArray<>& PresentKeys, const FMDMetaDataValidationField& Field, const FString& Value, FMDMetaDataReferenceResolver Resolver, TArray<FText>& OutIssues)
+	{
+		const FMDMetaDataEditorCompiledKey& CompiledKey = Snapshot.GetKeys()[KeyIndex];
+		const FMDMetaDataKey& Key = CompiledKey.Key;
+		const FText KeyText = FText::FromName(Key.Key);
+		const FText ValueText = FText::FromString(Value);
+
+		switch (Key.KeyType)
+		{
+		case EMDMetaDataEditorKeyType::Boolean:
+			if (!Value.Equals(TEXT("true"), ESearchCase::IgnoreCase) && !Value.Equals(TEXT("false"), ESearchCase::IgnoreCase))
+			{
+				OutIssues.Add(FText::Format(INVTEXT("{0} must be true or false, not \"{1}\""), KeyText, ValueText));
+			}
+			break;
+		case EMDMetaDataEditorKeyType::Integer:
+		{
+			int64 IntValue = 0;
+			if (Value.Contains(TEXT(".")) || !LexTryParseString(IntValue, *Value))
+			{
+				OutIssues.Add(FText::Format(INVTEXT("{0} must be a whole number, not \"{1}\""), KeyText, ValueText));
+			}
+			else if (IntValue < Key.MinInt || IntValue > Key.MaxInt)
+			{
+				OutIssues.Add(FText::Format(INVTEXT("{0} must be between {1} and {2}, not {3}"), KeyText, FText::AsNumber(Key.MinInt), FText::AsNumber(Key.MaxInt), ValueText));
+			}
+			break;
+		}
+		case EMDMetaDataEditorKeyType::Float:
+		{
+			double FloatValue = 0;
+			if (!LexTryParseString(FloatValue, *Value))
+			{
+				OutIssues.Add(FText::Format(INVTEXT("{0} must be a number, not \"{1}\""), KeyText, ValueText));
+			}
+			else if (FloatValue < Key.MinFloat || FloatValue > Key.MaxFloat)
+			{
+				OutIssues.Add(FText::Format(INVTEXT("{0} must be between {1} and {2}, not {3}"), KeyText, FText::AsNumber(Key.MinFloat), FText::AsNumber(Key.MaxFloat), ValueText));
+			}
+			break;
+		}
+		case EMDMetaDataEditorKeyType::ValueList:
+			if (!CompiledKey.AllowedValues.Contains(Value))
+			{
+				OutIssues.Add(FText::Format(INVTEXT("{0} isn't set to one of its listed values: \"{1}\""), KeyText, ValueText));
+			}
+			break;
+		case EMDMetaDataEditorKeyType::EnumValue:
+			if (Field.PinType != nullptr && Field.PinType->SubCategoryObjectType == EMDMetaDataResolvedObjectType::Enum)
+			{
+				TArray<FString> EnumValues;
+				Value.ParseIntoArray(EnumValues, TEXT(","));
+				for (FString& EnumValue : EnumValues)
+				{
+					EnumValue.TrimStartAndEndInline();
+					if (!HasEnumValue(Field.PinType->EnumValueNames, EnumValue))
+					{
+						OutIssues.Add(FText::Format(INVTEXT("{0} names a value that isn't in {1}: \"{2}\""), KeyText, FText::FromName(Field.PinType->GetSubCategoryObjectPath().GetAssetName()), FText::FromString(EnumValue)));
+					}
+				}
+			}
+			break;
+		default:
+			break;
+		}
+
+		ForEachKeyReference(Key, Value, [&](EMDMetaDataReferenceType Type, const FString& Name)
+		{
+			if (!Resolver(Type, Name))
+			{
+				OutIssues.Add(MakeReferenceIssue(KeyText, Type, Name));
+			}
+		});
+
+		if (Key.KeyType == EMDMetaDataEditorKeyType::String && Key.ValueReference == EMDMetaDataValueReference::Property
+			&& Field.OwnerPropertyNames != nullptr && !Field.OwnerPropertyNames->Contains(FName(*Value)))
+		{
+			OutIssues.Add(FText::Format(INVTEXT("{0} names a property that doesn't exist: \"{1}\""), KeyText, ValueText));
+		}
+
+		if (!Snapshot.AreKeyConstraintsMet(KeyIndex, PresentKeys, Field.MetaData))
+		{
+			if (!Key.RequiredMetaData.IsNone() && !Field.MetaData->Contains(Key.RequiredMetaData))
+			{
+				OutIssues.Add(FText::Format(INVTEXT("{0} has no effect without {1}"), KeyText, FText::FromName(Key.RequiredMetaData)));
+			}
+
+			for (const FName& IncompatibleKey : Key.IncompatibleMetaData)
+			{
+				if (Field.MetaData->Contains(IncompatibleKey))
+				{
+					OutIssues.Add(FText::Format(INVTEXT("{0} can't be used together with {1}"), KeyText, FText::FromName(IncompatibleKey)));
+				}
+			}
+		}
+
+		if (!Key.MaxValueMetaData.IsNone())
+		{
+			double MinValue = 0;
+			double MaxValue = 0;
+			const FString* MaxValueString = Field.MetaData->Find(Key.MaxValueMetaData);
+			if (MaxValueString != nullptr && LexTryParseString(MinValue, *Value) && LexTryParseString(MaxValue, **MaxValueString) && MinValue > MaxValue)
+			{
+				OutIssues.Add(FText::Format(INVTEXT("{0} ({1}) is greater than {2} ({3})"), KeyText, ValueText, FText::FromName(Key.MaxValueMetaData), FText::FromString(*MaxValueString)));
+			}
+		}
+	}
+
+	// Whether the key applies to the field regardless of its type
+	bool CanKeyBeUsedOnField(const FMDMetaDataEditorCompiledKey& CompiledKey, const FMDMetaDataValidationField& Field)
+	{
+		return (Field.Usage == EMDMetaDataKeyUsage::None || EnumHasAnyFlags(CompiledKey.Usage, Field.Usage))
+			&& Field.BlueprintClass != nullptr && CompiledKey.DoesSupportBlueprintClass(*Field.BlueprintClass);
+	}
+}
+
+FMDMetaDataValidator::FMDMetaDataValidator()
+{
+	FMDMetaDataCompilerHooks::Get().OnValidateCompiledBlueprint.AddRaw(this, &FMDMetaDataValidator::OnValidateCompiledBlueprint);
+	GetMutableDefault<UMDMetaDataEditorConfig>()->OnMetaDataKeysChanged.AddRaw(this, &FMDMetaDataValidator::OnRulesChanged);
+	UGameplayTagsManager::OnEditorRefreshGameplayTagTree.AddRaw(this, &FMDMetaDataValidator::OnRulesChanged);
+}
+
+FMDMetaDataValidator::~FMDMetaDataValidator()
+{
+	FMDMetaDataCompilerHooks::Get().OnValidateCompiledBlueprint.RemoveAll(this);
+	UGameplayTagsManager::OnEditorRefreshGameplayTagTree.RemoveAll(this);
+
+	if (!IsEngineExitRequested())
+	{
+		GetMutableDefault<UMDMetaDataEditorConfig>()->OnMetaDataKeysChanged.RemoveAll(this);
+	}
+}
+
+bool FMDMetaDataValidator::ValidateField(const FMDMetaDataEditorConfigSnapshot& Snapshot, const FMDMetaDataValidationField& Field, FMDMetaDataReferenceResolver Resolver, TArray<FText>& OutIssues)
+{
+	if (Field.MetaData == nullptr || Field.MetaData->IsEmpty())
+	{
+		return true;
+	}
+
+	const TBitArray<> PresentKeys = Snapshot.GetPresentKeys(Field.MetaData);
+	bool bDependsOnlyOnMetaData = true;
+
+	TArray<int32> KeyIndices;
+	TArray<FText> KeyIssues;
+	for (const TPair<FName, FString>& MetaDataPair : *Field.MetaData)
+	{
+		KeyIndices.Reset();
+		Snapshot.FindKeyIndices(MetaDataPair.Key, KeyIndices);
+
+		// Keys can share a name with different types, the value only has to be valid for one of the keys that apply to this field
+		bool bIsUsable = false;
+		bool bSupportsType = false;
+		bool bIsValid = false;
+		int32 NumFirstKeyIssues = INDEX_NONE;
+		KeyIssues.Reset();
+		for (const int32 KeyIndex : KeyIndices)
+		{
+			const FMDMetaDataEditorCompiledKey& CompiledKey = Snapshot.GetKeys()[KeyIndex];
+			if (!MDMDV_Private::CanKeyBeUsedOnField(CompiledKey, Field))
+			{
+				continue;
+			}
+
+			bIsUsable = true;
+			if (Field.PinType != nullptr && !CompiledKey.DoesSupportPinType(*Field.PinType))
+			{
+				continue;
+			}
+
+			bSupportsType = true;
+			bDependsOnlyOnMetaData &= !MDMDV_Private::DoesKeyNameObjects(CompiledKey.Key);
+
+			const int32 NumIssues = KeyIssues.Num();
+			MDMDV_Private::ValidateKey(Snapshot, KeyIndex, PresentKeys, Field, MetaDataPair.Value, Resolver, KeyIssues);
+			if (NumFirstKeyIssues == INDEX_NONE)
+			{
+				NumFirstKeyIssues = KeyIssues.Num();
+			}
+
+			if (KeyIssues.Num() == NumIssues)
+			{
+				bIsValid = true;
+				break;
+			}
+		}
+
+		if (bIsUsable && !bSupportsType)
+		{
+			OutIssues.Add(FText::Format(INVTEXT("{0} isn't supported on {1} properties"), FText::FromName(MetaDataPair.Key), Field.PinTypeText));
+		}
+		else if (bSupportsType && !bIsValid)
+		{
+			OutIssues.Append(KeyIssues.GetData(), NumFirstKeyIssues);
+		}
+	}
+
+	return bDependsOnlyOnMetaData;
+}
+
+bool FMDMetaDataValidator::DoesReferenceExist(EMDMetaDataReferenceType Type, const FString& Name)
+{
+	check(IsInGameThread());
+
+	switch (Type)
+	{
+	case EMDMetaDataReferenceType::Struct:
+		return MDMDV_Private::DoesObjectExist<UScriptStruct>(Name);
+	case EMDMetaDataReferenceType::Class:
+		return MDMDV_Private::DoesObjectExist<UClass>(Name);
+	case EMDMetaDataReferenceType::Enum:
+		return MDMDV_Private::DoesObjectExist<UEnum>(Name);
+	default:
+		return !Name.IsEmpty() && UGameplayTagsManager::Get().RequestGameplayTag(FName(*Name), false).IsValid();
+	}
+}
+
+void FMDMetaDataValidator::ForEachReference(const FMDMetaDataEditorConfigSnapshot& Snapshot, const TMap<FName, FString>& MetaData, TFunctionRef<void(EMDMetaDataReferenceType, const FString&)> Func)
+{
+	TArray<int32> KeyIndices;
+	for (const TPair<FName, FString>& MetaDataPair : MetaData)
+	{
+		KeyIndices.Reset();
+		Snapshot.FindKeyIndices(MetaDataPair.Key, KeyIndices);
+		for (const int32 KeyIndex : KeyIndices)
+		{
+			MDMDV_Private::ForEachKeyReference(Snapshot.GetKeys()[KeyIndex].Key, MetaDataPair.Value, Func);
+		}
+	}
+}
+
+uint32 FMDMetaDataValidator::HashField(const FMDMetaDataValidationField& Field)
+{
+	uint32 Hash = GetTypeHash(static_cast<uint8>(Field.Usage));
+
+	if (const FMDMetaDataResolvedPinType* PinType = Field.PinType)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(PinType->PinCategory));
+		Hash = HashCombine(Hash, GetTypeHash(PinType->PinSubCategory));
+		Hash = HashCombine(Hash, GetTypeHash(PinType->GetSubCategoryObjectPath()));
+		Hash = HashCombine(Hash, GetTypeHash(PinType->ContainerType));
+	}
+
+	// Order independent, so a key being re-added doesn't count as a change
+	uint32 MetaDataHash = 0;
+	if (Field.MetaData != nullptr)
+	{
+		for (const TPair<FName, FString>& MetaDataPair : *Field.MetaData)
+		{
+			MetaDataHash ^= HashCombine(GetTypeHash(MetaDataPair.Key), FCrc::StrCrc32(*MetaDataPair.Value));
+		}
+	}
+
+	return HashCombine(Hash, MetaDataHash);
+}
+
+void FMDMetaDataValidator::GetOwnerPropertyNames(const UStruct* Owner, TSet<FName>& OutPropertyNames)
+{
+	check(IsInGameThread());
+
+	for (TFieldIterator<FProperty> PropIt(Owner); PropIt; ++PropIt)
+	{
+		OutPropertyNames.Add(PropIt->GetFName());
+	}
+}
+
+void FMDMetaDataValidator::OnValidateCompiledBlueprint(const UBlueprint* Blueprint, FCompilerResultsLog& MessageLog)
+{
+	const UClass* Class = IsValid(Blueprint) ? Blueprint->GeneratedClass.Get() : nullptr;
+	if (Class == nullptr)
+	{
+		return;
+	}
+
+	const TSharedRef<const FMDMetaDataEditorConfigSnapshot> Snapshot = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot();
+	const FMDMetaDataResolvedClass BlueprintClass(Blueprint->GetClass());
+	TSet<FName> ClassPropertyNames;
+	GetOwnerPropertyNames(Class, ClassPropertyNames);
+
+	// Rebuilt each compile so fields that were removed or renamed don't linger
+	TMap<TPair<FName, FName>, uint32> PreviousHashes;
+	ValidatedHashes.RemoveAndCopyValue(Blueprint, PreviousHashes);
+	TMap<TPair<FName, FName>, uint32> FieldHashes;
+
+	TArray<FText> Issues;
+	auto ValidateCompiledField = [&](FName ScopeName, FName FieldName, FMDMetaDataValidationField& Field, const FProperty* Property)
+	{
+		if (Field.MetaData == nullptr || Field.MetaData->IsEmpty())
+		{
+			return;
+		}
+
+		FEdGraphPinType PinType;
+		TOptional<FMDMetaDataResolvedPinType> ResolvedPinType;
+		if (Property != nullptr && GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(Property, PinType))
+		{
+			Field.PinType = &ResolvedPinType.Emplace(PinType);
+		}
+
+		const TPair<FName, FName> FieldKey(ScopeName, FieldName);
+		const uint32 Hash = HashField(Field);
+		const uint32* PreviousHash = PreviousHashes.Find(FieldKey);
+		if (PreviousHash != nullptr && *PreviousHash == Hash)
+		{
+			FieldHashes.Add(FieldKey, Hash);
+			return;
+		}
+
+		if (Field.PinType != nullptr)
+		{
+			Field.PinTypeText = UEdGraphSchema_K2::TypeToText(PinType);
+		}
+
+		Issues.Reset();
+		if (ValidateField(*Snapshot, Field, &FMDMetaDataValidator::DoesReferenceExist, Issues) && Issues.IsEmpty())
+		{
+			FieldHashes.Add(FieldKey, Hash);
+		}
+
+		const FString FieldDisplayName = ScopeName.IsNone() ? FieldName.ToString() : FString::Printf(TEXT("%s.%s"), *ScopeName.ToString(), *FieldName.ToString());
+		for (const FText& Issue : Issues)
+		{
+			MessageLog.Warning(*FString::Printf(TEXT("Meta data on %s: %s"), *FieldDisplayName, *Issue.ToString()));
+		}
+	};
+
+	auto ValidateFunction = [&](FName FunctionName, const TMap<FName, FString>& FunctionMetaData)
+	{
+		FMDMetaDataValidationField FunctionField;
+		FunctionField.Usage = EMDMetaDataKeyUsage::Functions;
+		FunctionField.BlueprintClass = &BlueprintClass;
+		FunctionField.OwnerPropertyNames = &ClassPropertyNames;
+		FunctionField.MetaData = &FunctionMetaData;
+		ValidateCompiledField(NAME_None, FunctionName, FunctionField, nullptr);
+
+		const UFunction* Function = Class->FindFunctionByName(FunctionName, EIncludeSuperFlag::ExcludeSuper);
+		if (!IsValid(Function))
+		{
+			return;
+		}
+
+		TSet<FName> FunctionPropertyNames;
+		GetOwnerPropertyNames(Function, FunctionPropertyNames);
+
+		for (TFieldIterator<FProperty> PropIt(Function); PropIt; ++PropIt)
+		{
+			FMDMetaDataValidationField PropertyField;
+			PropertyField.Usage = PropIt->HasAnyPropertyFlags(CPF_Parm) ? EMDMetaDataKeyUsage::FunctionParameters : EMDMetaDataKeyUsage::LocalVariables;
+			PropertyField.BlueprintClass = &BlueprintClass;
+			PropertyField.OwnerPropertyNames = &FunctionPropertyNames;
+			PropertyField.MetaData = PropIt->GetMetaDataMap();
+			ValidateCompiledField(FunctionName, PropIt->GetFName(), PropertyField, *PropIt);
+		}
+	};
+
+	for (TFieldIterator<FProperty> PropIt(Class, EFieldIteratorFlags::ExcludeSuper); PropIt; ++PropIt)
+	{
+		FMDMetaDataValidationField VariableField;
+		VariableField.Usage = EMDMetaDataKeyUsage::Variables;
+		VariableField.BlueprintClass = &BlueprintClass;
+		VariableField.OwnerPropertyNames = &ClassPropertyNames;
+		VariableField.MetaData = PropIt->GetMetaDataMap();
+		ValidateCompiledField(NAME_None, PropIt->GetFName(), VariableField, *PropIt);
+	}
+
+	for (const UEdGraph* Graph : Blueprint->FunctionGraphs)
+	{
+		TArray<UK2Node_FunctionEntry*> EntryNodes;
+		Graph->GetNodesOfClass(EntryNodes);
+		if (EntryNodes.Num() > 0)
+		{
+			const UK2Node_FunctionEntry* EntryNode = EntryNodes[0];
+			const FName FunctionName = (EntryNode->CustomGeneratedFunctionName != NAME_None) ? EntryNode->CustomGeneratedFunctionName : Graph->GetFName();
+			ValidateFunction(FunctionName, EntryNode->MetaData.GetMetaDataMap());
+		}
+	}
+
+	TArray<UK2Node_CustomEvent*> EventNodes;
+	FBlueprintEditorUtils::GetAllNodesOfClass(Blueprint, EventNodes);
+	for (UK2Node_CustomEvent* EventNode : EventNodes)
+	{
+		ValidateFunction(EventNode->CustomFunctionName, EventNode->GetUserDefinedMetaData().GetMetaDataMap());
+	}
+
+	if (!FieldHashes.IsEmpty())
+	{
+		ValidatedHashes.Add(Blueprint, MoveTemp(FieldHashes));
+	}
+}
+
+void FMDMetaDataValidator::OnRulesChanged()
+{
+	ValidatedHashes.Reset();
+}
@@ -0,0 +1,76 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
+#include "EdGraph/EdGraphPin.h"
+#include "Templates/Function.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
+
+class FCompilerResultsLog;
+class UBlueprint;
+
+// A single field's meta data to validate, PinType is null for functions and custom events.
+// Types are resolved on the game thread beforehand, so the field can be validated from any thread.
+struct FMDMetaDataValidationField
+{
+	// None tests keys for any usage, like User Defined Struct members
+	EMDMetaDataKeyUsage Usage = EMDMetaDataKeyUsage::None;
+	const FMDMetaDataResolvedClass* BlueprintClass = nullptr;
+	const FMDMetaDataResolvedPinType* PinType = nullptr;
+
+	// Describes PinType in messages
+	FText PinTypeText;
+
+	// The properties of the class or struct that properties named by the meta data are resolved against, property references aren't checked if null
+	const TSet<FName>* OwnerPropertyNames = nullptr;
+
+	const TMap<FName, FString>* MetaData = nullptr;
+};
+
+enum class EMDMetaDataReferenceType : uint8
+{
+	Struct,
+	Class,
+	Enum,
+	GameplayTag
+};
+
+// Returns whether the object or tag named by a meta data value exists
+typedef TFunctionRef<bool(EMDMetaDataReferenceType, const FString&)> FMDMetaDataReferenceResolver;
+
+/**
+ * Checks meta data against the rules of the configured keys when a Blueprint is compiled:
+ * value types and ranges, the structs, classes, enums, properties and tags that values name, and the constraints between keys.
+ * Fields whose meta data passed and hasn't changed since are skipped on later compiles.
+ */
+class FMDMetaDataValidator : public TSharedFromThis<FMDMetaDataValidator>
+{
+public:
+	FMDMetaDataValidator();
+	~FMDMetaDataValidator();
+
+	// Appends a message for each rule the field's meta data breaks, returns false if the result depends on more than the meta data itself.
+	// Can be called from any thread as long as Resolver can.
+	static bool ValidateField(const FMDMetaDataEditorConfigSnapshot& Snapshot, const FMDMetaDataValidationField& Field, FMDMetaDataReferenceResolver Resolver, TArray<FText>& OutIssues);
+
+	// Looks up the object or tag, must be called on the game thread
+	static bool DoesReferenceExist(EMDMetaDataReferenceType Type, const FString& Name);
+
+	// Calls Func with each object or tag the meta data names, so they can be resolved on the game thread ahead of a parallel validation
+	static void ForEachReference(const FMDMetaDataEditorConfigSnapshot& Snapshot, const TMap<FName, FString>& MetaData, TFunctionRef<void(EMDMetaDataReferenceType, const FString&)> Func);
+
+	// Hashes what the result of ValidateField depends on
+	static uint32 HashField(const FMDMetaDataValidationField& Field);
+
+	// The names of the properties of Owner and its super structs, for FMDMetaDataValidationField::OwnerPropertyNames
+	static void GetOwnerPropertyNames(const UStruct* Owner, TSet<FName>& OutPropertyNames);
+
+private:
+	void OnValidateCompiledBlueprint(const UBlueprint* Blueprint, FCompilerResultsLog& MessageLog);
+	void OnRulesChanged();
+
+	// (Scope, Field) -> hash of the field when it last passed
+	TMap<TObjectKey<UBlueprint>, TMap<TPair<FName, FName>, uint32>> ValidatedHashes;
+};
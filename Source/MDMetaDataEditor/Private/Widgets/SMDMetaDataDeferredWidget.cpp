@@ -0,0 +1,33 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "SMDMetaDataDeferredWidget.h"
+
+void SMDMetaDataDeferredWidget::Construct(const FArguments& InArgs)
+{
+	OnGenerateContent = InArgs._OnGenerateContent;
+}
+
+void SMDMetaDataDeferredWidget::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	GenerateContent();
+}
+
+void SMDMetaDataDeferredWidget::GenerateContent()
+{
+	if (!OnGenerateContent.IsBound())
+	{
+		return;
+	}
+
+	ChildSlot
+	[
+		OnGenerateContent.Execute()
+	];
+
+	// Only generate once, the generated content takes care of itself from here
+	OnGenerateContent.Unbind();
+	SetCanTick(false);
+	Invalidate(EInvalidateWidgetReason::Layout);
+}
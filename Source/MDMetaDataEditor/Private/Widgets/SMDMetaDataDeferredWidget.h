@@ -0,0 +1,29 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Widgets/SCompoundWidget.h"
+
+/**
+ * Placeholder that only generates its content the first time it's ticked.
+ * Detail rows inside collapsed groups are never ticked, so their content isn't built until the group is expanded.
+ */
+class SMDMetaDataDeferredWidget : public SCompoundWidget
+{
+public:
+	DECLARE_DELEGATE_RetVal(TSharedRef<SWidget>, FOnGenerateContent);
+
+	SLATE_BEGIN_ARGS(SMDMetaDataDeferredWidget)
+	{}
+		SLATE_EVENT(FOnGenerateContent, OnGenerateContent);
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+private:
+	void GenerateContent();
+
+	FOnGenerateContent OnGenerateContent;
+};
@@ -0,0 +1,176 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "SMDMetaDataEnumValuePicker.h"
+
+#include "DetailLayoutBuilder.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Types/MDMetaDataEnumCache.h"
+#include "Widgets/Input/SComboButton.h"
+
+void SMDMetaDataEnumValuePicker::Construct(const FArguments& InArgs)
+{
+	Key = InArgs._Key;
+	Enum = InArgs._Enum;
+	EnumCache = InArgs._EnumCache;
+	MetaDataValue = InArgs._MetaDataValue;
+	OnRemoveMetaData = InArgs._OnRemoveMetaData;
+	OnSetMetaData = InArgs._OnSetMetaData;
+
+	ChildSlot
+	[
+		SNew(SComboButton)
+		.ToolTipText(this, &SMDMetaDataEnumValuePicker::GetValueToolTip)
+		.OnGetMenuContent(this, &SMDMetaDataEnumValuePicker::OnGetMenuContent)
+		.ButtonContent()
+		[
+			SNew(STextBlock)
+			.Text(this, &SMDMetaDataEnumValuePicker::GetValue)
+			.Font(IDetailLayoutBuilder::GetDetailFont())
+		]
+	];
+}
+
+FText SMDMetaDataEnumValuePicker::GetValue() const
+{
+	const TArray<FString> Entries = GetSelectedEntries();
+	if (Entries.IsEmpty())
+	{
+		return INVTEXT("None");
+	}
+
+	const TSharedRef<const FMDMetaDataEnumEntryTable> Table = GetEntryTable();
+
+	FString Value;
+	for (const FString& Entry : Entries)
+	{
+		if (!Value.IsEmpty())
+		{
+			Value += TEXT(", ");
+		}
+
+		// Keep names that aren't in the enum visible so they can be fixed
+		const FMDMetaDataEnumEntry* EnumEntry = Table->FindEntry(Entry);
+		Value += (EnumEntry != nullptr) ? EnumEntry->DisplayName.ToString() : Entry;
+	}
+
+	return FText::FromString(Value);
+}
+
+FText SMDMetaDataEnumValuePicker::GetValueToolTip() const
+{
+	return FText::FromString(FString::Join(GetSelectedEntries(), TEXT("\r\n")));
+}
+
+TSharedRef<SWidget> SMDMetaDataEnumValuePicker::OnGetMenuContent()
+{
+	const TSharedRef<const FMDMetaDataEnumEntryTable> Table = GetEntryTable();
+
+	// Keep the menu open so several values can be toggled at once
+	FMenuBuilder MenuBuilder(false, nullptr);
+
+	MenuBuilder.AddMenuEntry(
+		INVTEXT("None"),
+		INVTEXT("Remove this meta data"),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SMDMetaDataEnumValuePicker::OnClearClicked))
+	);
+
+	MenuBuilder.AddSeparator();
+
+	if (Table->Entries.IsEmpty())
+	{
+		MenuBuilder.AddWidget(SNew(STextBlock).Text(INVTEXT("This property has no enum values")).Font(IDetailLayoutBuilder::GetDetailFont()), FText::GetEmpty());
+	}
+
+	for (const FMDMetaDataEnumEntry& Entry : Table->Entries)
+	{
+		MenuBuilder.AddMenuEntry(
+			Entry.DisplayName,
+			FText::FromName(Entry.Name),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateSP(this, &SMDMetaDataEnumValuePicker::OnEntryClicked, Entry.Name),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateSP(this, &SMDMetaDataEnumValuePicker::IsEntrySelected, Entry.Name)
+			),
+			NAME_None,
+			EUserInterfaceActionType::ToggleButton
+		);
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+bool SMDMetaDataEnumValuePicker::IsEntrySelected(FName Entry) const
+{
+	const TSharedRef<const FMDMetaDataEnumEntryTable> Table = GetEntryTable();
+	for (const FString& SelectedEntry : GetSelectedEntries())
+	{
+		const FMDMetaDataEnumEntry* EnumEntry = Table->FindEntry(SelectedEntry);
+		if (EnumEntry != nullptr && EnumEntry->Name == Entry)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void SMDMetaDataEnumValuePicker::OnEntryClicked(FName Entry)
+{
+	const TSharedRef<const FMDMetaDataEnumEntryTable> Table = GetEntryTable();
+
+	TArray<FString> Entries = GetSelectedEntries();
+	const int32 NumRemoved = Entries.RemoveAll([&Table, Entry](const FString& SelectedEntry)
+	{
+		const FMDMetaDataEnumEntry* EnumEntry = Table->FindEntry(SelectedEntry);
+		return EnumEntry != nullptr && EnumEntry->Name == Entry;
+	});
+
+	if (NumRemoved == 0)
+	{
+		Entries.Add(Entry.ToString());
+	}
+
+	SetSelectedEntries(Entries);
+}
+
+void SMDMetaDataEnumValuePicker::OnClearClicked()
+{
+	SetSelectedEntries({});
+}
+
+TSharedRef<const FMDMetaDataEnumEntryTable> SMDMetaDataEnumValuePicker::GetEntryTable() const
+{
+	const TSharedPtr<FMDMetaDataEnumCache> EnumCachePtr = EnumCache.Pin();
+	return EnumCachePtr.IsValid() ? EnumCachePtr->FindOrBuild(Enum.Get()) : MakeShared<const FMDMetaDataEnumEntryTable>();
+}
+
+TArray<FString> SMDMetaDataEnumValuePicker::GetSelectedEntries() const
+{
+	TArray<FString> Entries;
+
+	const TOptional<FString> ValueStringOptional = MetaDataValue.Get(TOptional<FString>());
+	if (ValueStringOptional.IsSet())
+	{
+		ValueStringOptional.GetValue().ParseIntoArray(Entries, TEXT(","));
+		for (FString& Entry : Entries)
+		{
+			Entry.TrimStartAndEndInline();
+		}
+	}
+
+	return Entries;
+}
+
+void SMDMetaDataEnumValuePicker::SetSelectedEntries(const TArray<FString>& Entries)
+{
+	if (Entries.IsEmpty())
+	{
+		OnRemoveMetaData.ExecuteIfBound(Key);
+	}
+	else
+	{
+		OnSetMetaData.ExecuteIfBound(Key, FString::Join(Entries, TEXT(",")));
+	}
+}
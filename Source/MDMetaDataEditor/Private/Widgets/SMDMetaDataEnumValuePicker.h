@@ -0,0 +1,54 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "Widgets/SCompoundWidget.h"
+
+class FMDMetaDataEnumCache;
+struct FMDMetaDataEnumEntryTable;
+
+/**
+ * Picks one or more values of the edited property's enum, stored as a comma separated list of entry names
+ */
+class SMDMetaDataEnumValuePicker : public SCompoundWidget
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnRemoveMetaData, const FName&);
+	DECLARE_DELEGATE_TwoParams(FOnSetMetaData, const FName&, const FString& Value);
+
+	SLATE_BEGIN_ARGS(SMDMetaDataEnumValuePicker)
+	{}
+		SLATE_ARGUMENT_DEFAULT(FName, Key) = NAME_None;
+		SLATE_ARGUMENT_DEFAULT(const UEnum*, Enum) = nullptr;
+		SLATE_ARGUMENT(TSharedPtr<FMDMetaDataEnumCache>, EnumCache);
+
+		SLATE_ATTRIBUTE(TOptional<FString>, MetaDataValue);
+		SLATE_EVENT(FOnRemoveMetaData, OnRemoveMetaData);
+		SLATE_EVENT(FOnSetMetaData, OnSetMetaData);
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	FText GetValue() const;
+	FText GetValueToolTip() const;
+
+	TSharedRef<SWidget> OnGetMenuContent();
+
+	bool IsEntrySelected(FName Entry) const;
+	void OnEntryClicked(FName Entry);
+	void OnClearClicked();
+
+	TSharedRef<const FMDMetaDataEnumEntryTable> GetEntryTable() const;
+
+	TArray<FString> GetSelectedEntries() const;
+	void SetSelectedEntries(const TArray<FString>& Entries);
+
+	FName Key = NAME_None;
+	TWeakObjectPtr<const UEnum> Enum;
+	TWeakPtr<FMDMetaDataEnumCache> EnumCache;
+	TAttribute<TOptional<FString>> MetaDataValue;
+	FOnRemoveMetaData OnRemoveMetaData;
+	FOnSetMetaData OnSetMetaData;
+};
@@ -0,0 +1,931 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "SMDMetaDataMatrix.h"
+
+#include "Async/ParallelFor.h"
+#include "Config/MDMetaDataEditorConfig.h"
+#include "ContentBrowserMenuContexts.h"
+#include "Customizations/MDMetaDataEditorFieldView.h"
+#include "EdGraphSchema_K2.h"
+#include "Engine/Blueprint.h"
+#include "Engine/UserDefinedStruct.h"
+#include "Export/MDMetaDataExporter.h"
+#include "Framework/Docking/TabManager.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Styling/AppStyle.h"
+#include "ToolMenus.h"
+#include "Validation/MDMetaDataProjectValidator.h"
+#include "Widgets/Docking/SDockTab.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Layout/SScrollBar.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/SHeaderRow.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 5) // On or after UE 5.5
+#include "StructUtils/UserDefinedStruct.h"
+#endif
+
+const FName SMDMetaDataMatrix::TabId = TEXT("MDMetaDataMatrix");
+
+namespace MDMDMX_Private
+{
+	const FName MenuOwner = TEXT("MDMetaDataMatrix");
+
+	const FName AssetColumn = TEXT("MDMatrix_Asset");
+	const FName FieldColumn = TEXT("MDMatrix_Field");
+
+	constexpr float AssetColumnWidth = 200.f;
+	constexpr float FieldColumnWidth = 220.f;
+	// Key columns stretch to fill the view, but are never narrower than this
+	constexpr float MinKeyColumnWidth = 160.f;
+
+	EMDMetaDataKeyUsage GetUsage(EMDMetaDataFieldType FieldType)
+	{
+		switch (FieldType)
+		{
+		case EMDMetaDataFieldType::Variable:
+			return EMDMetaDataKeyUsage::Variables;
+		case EMDMetaDataFieldType::LocalVariable:
+			return EMDMetaDataKeyUsage::LocalVariables;
+		case EMDMetaDataFieldType::FunctionParameter:
+			return EMDMetaDataKeyUsage::FunctionParameters;
+		case EMDMetaDataFieldType::Function:
+		case EMDMetaDataFieldType::CustomEvent:
+			return EMDMetaDataKeyUsage::Functions;
+		case EMDMetaDataFieldType::Struct:
+			return EMDMetaDataKeyUsage::Structs;
+		default:
+			// Struct members are summarized without a usage
+			return EMDMetaDataKeyUsage::None;
+		}
+	}
+
+	EMDMetaDataFieldType GetFieldType(EMDMetaDataKeyUsage Usage)
+	{
+		switch (Usage)
+		{
+		case EMDMetaDataKeyUsage::Variables:
+			return EMDMetaDataFieldType::Variable;
+		case EMDMetaDataKeyUsage::LocalVariables:
+			return EMDMetaDataFieldType::LocalVariable;
+		case EMDMetaDataKeyUsage::FunctionParameters:
+			return EMDMetaDataFieldType::FunctionParameter;
+		case EMDMetaDataKeyUsage::Functions:
+			// Custom events are summarized as functions too, the row gets its real type once the asset is loaded
+			return EMDMetaDataFieldType::Function;
+		case EMDMetaDataKeyUsage::Structs:
+			return EMDMetaDataFieldType::Struct;
+		default:
+			return EMDMetaDataFieldType::StructMember;
+		}
+	}
+
+	FString MakeLabel(const FMDMetaDataMatrixRow& Row)
+	{
+		switch (Row.FieldType)
+		{
+		case EMDMetaDataFieldType::LocalVariable:
+		case EMDMetaDataFieldType::FunctionParameter:
+			return FString::Printf(TEXT("%s.%s"), *Row.FunctionName.ToString(), *Row.FieldName.ToString());
+		case EMDMetaDataFieldType::Struct:
+			return TEXT("(Struct)");
+		default:
+			return Row.FieldName.ToString();
+		}
+	}
+
+	bool IsMatrixAsset(const FAssetData& AssetData)
+	{
+		return AssetData.IsInstanceOf(UBlueprint::StaticClass()) || AssetData.IsInstanceOf(UUserDefinedStruct::StaticClass());
+	}
+
+	class SMDMetaDataMatrixRow : public SMultiColumnTableRow<TSharedPtr<FMDMetaDataMatrixRow>>
+	{
+	public:
+		SLATE_BEGIN_ARGS(SMDMetaDataMatrixRow)
+			{}
+			SLATE_ARGUMENT(TSharedPtr<FMDMetaDataMatrixRow>, Row)
+			SLATE_ARGUMENT(TWeakPtr<SMDMetaDataMatrix>, Matrix)
+		SLATE_END_ARGS()
+
+		void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& OwnerTable)
+		{
+			Row = InArgs._Row;
+			Matrix = InArgs._Matrix;
+
+			SMultiColumnTableRow<TSharedPtr<FMDMetaDataMatrixRow>>::Construct(FSuperRowType::FArguments(), OwnerTable);
+		}
+
+		virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+		{
+			const TSharedPtr<SMDMetaDataMatrix> MatrixPtr = Matrix.Pin();
+			return MatrixPtr.IsValid() ? MatrixPtr->GenerateCellWidget(Row, ColumnName) : SNullWidget::NullWidget;
+		}
+
+	private:
+		TSharedPtr<FMDMetaDataMatrixRow> Row;
+		TWeakPtr<SMDMetaDataMatrix> Matrix;
+	};
+}
+
+void SMDMetaDataMatrix::Construct(const FArguments& InArgs)
+{
+	Snapshot = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot();
+	GetMutableDefault<UMDMetaDataEditorConfig>()->OnMetaDataKeysChanged.AddSP(this, &SMDMetaDataMatrix::OnMetaDataKeysChanged);
+
+	HeaderRow = SNew(SHeaderRow);
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(4.f)
+		[
+			SNew(SHorizontalBox)
+			+SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			[
+				SNew(SSearchBox)
+				.HintText(INVTEXT("Search Assets and Fields"))
+				.OnTextChanged(this, &SMDMetaDataMatrix::OnSearchTextChanged)
+			]
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(8.f, 0.f)
+			[
+				SNew(STextBlock)
+				.Text(this, &SMDMetaDataMatrix::GetStatusText)
+			]
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(0.f, 0.f, 4.f, 0.f)
+			[
+				SNew(SComboButton)
+				.ToolTipText(INVTEXT("Set a meta data preset on every selected field it can be used on, as a single undoable change"))
+				.IsEnabled(this, &SMDMetaDataMatrix::HasSelection)
+				.OnGetMenuContent(this, &SMDMetaDataMatrix::CreatePresetMenu)
+				.ButtonContent()
+				[
+					SNew(STextBlock)
+					.Text(INVTEXT("Apply Preset"))
+				]
+			]
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.ToolTipText(INVTEXT("Read the meta data of the assets again"))
+				.OnClicked(this, &SMDMetaDataMatrix::OnRefreshClicked)
+				[
+					SNew(SImage)
+					.Image(FAppStyle::GetBrush("Icons.Refresh"))
+					.ColorAndOpacity(FSlateColor::UseForeground())
+				]
+			]
+		]
+		+SVerticalBox::Slot()
+		.FillHeight(1.f)
+		[
+			SAssignNew(ListView, SListView<TSharedPtr<FMDMetaDataMatrixRow>>)
+			.ListItemsSource(&FilteredRows)
+			.SelectionMode(ESelectionMode::Multi)
+			.HeaderRow(HeaderRow)
+			.OnGenerateRow(this, &SMDMetaDataMatrix::OnGenerateRow)
+			.OnMouseButtonDoubleClick(this, &SMDMetaDataMatrix::LoadRowAsset)
+		]
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SAssignNew(ColumnScrollBar, SScrollBar)
+			.Orientation(Orient_Horizontal)
+			.AlwaysShowScrollbar(true)
+			.OnUserScrolled(this, &SMDMetaDataMatrix::OnColumnsScrolled)
+		]
+	];
+
+	RebuildKeyColumns();
+}
+
+SMDMetaDataMatrix::~SMDMetaDataMatrix()
+{
+	if (UObjectInitialized())
+	{
+		GetMutableDefault<UMDMetaDataEditorConfig>()->OnMetaDataKeysChanged.RemoveAll(this);
+	}
+
+	for (const TWeakObjectPtr<UBlueprint>& WeakBlueprint : BoundBlueprints)
+	{
+		if (UBlueprint* Blueprint = WeakBlueprint.Get())
+		{
+			Blueprint->OnCompiled().RemoveAll(this);
+		}
+	}
+}
+
+void SMDMetaDataMatrix::Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime)
+{
+	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
+
+	// Only as many key columns as fit are added to the header, the scroll bar below the list moves that window across the keys
+	using namespace MDMDMX_Private;
+	const float KeyColumnsWidth = AllottedGeometry.GetLocalSize().X - AssetColumnWidth - FieldColumnWidth;
+	const int32 NewNumVisibleColumns = FMath::Max(1, FMath::FloorToInt(KeyColumnsWidth / MinKeyColumnWidth));
+	if (NewNumVisibleColumns != NumVisibleColumns)
+	{
+		NumVisibleColumns = NewNumVisibleColumns;
+		RebuildHeader();
+	}
+}
+
+void SMDMetaDataMatrix::SetAssets(TArray<FAssetData> Assets)
+{
+	SourceAssets = MoveTemp(Assets);
+	SourceAssets.RemoveAll([](const FAssetData& AssetData)
+	{
+		return !MDMDMX_Private::IsMatrixAsset(AssetData);
+	});
+
+	RebuildRows();
+}
+
+TSharedRef<SWidget> SMDMetaDataMatrix::GenerateCellWidget(const TSharedPtr<FMDMetaDataMatrixRow>& Row, const FName& ColumnName)
+{
+	using namespace MDMDMX_Private;
+
+	if (!Row.IsValid())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	if (ColumnName == AssetColumn)
+	{
+		return SNew(SBox)
+			.Padding(4.f, 2.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromName(Row->AssetData.AssetName))
+				.ToolTipText(FText::FromString(Row->AssetData.GetObjectPathString()))
+			];
+	}
+
+	if (ColumnName == FieldColumn)
+	{
+		return SNew(SHorizontalBox)
+			+SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.Padding(4.f, 2.f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(Row->Label))
+				.ColorAndOpacity(Row->bIsPlaceholder ? FSlateColor::UseSubduedForeground() : FSlateColor::UseForeground())
+			]
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SButton)
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.Visibility(Row->FieldView.IsValid() ? EVisibility::Collapsed : EVisibility::Visible)
+				.ToolTipText(INVTEXT("Load this asset to edit its meta data"))
+				.OnClicked(this, &SMDMetaDataMatrix::OnEditClicked, Row)
+				[
+					SNew(SImage)
+					.Image(FAppStyle::GetBrush("Icons.Edit"))
+					.ColorAndOpacity(FSlateColor::UseForeground())
+				]
+			];
+	}
+
+	const int32* KeyIndexPtr = ColumnKeyIndices.Find(ColumnName);
+	if (KeyIndexPtr == nullptr || Row->bIsPlaceholder || !Snapshot.IsValid() || !GetApplicableKeys(*Row)[*KeyIndexPtr])
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	const FMDMetaDataKey& Key = Snapshot->GetKeys()[*KeyIndexPtr].Key;
+
+	if (Row->FieldView.IsValid() && !Row->FieldView->IsReadOnly())
+	{
+		return SNew(SHorizontalBox)
+			+SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.Padding(2.f)
+			.VAlign(VAlign_Center)
+			[
+				Row->FieldView->CreateMetaDataValueWidget(Key)
+			]
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				Row->FieldView->CreateRemoveMetadataButton(Key.Key)
+			];
+	}
+
+	TOptional<FString> Value;
+	if (Row->FieldView.IsValid())
+	{
+		Value = Row->FieldView->GetMetadataValue(Key.Key);
+	}
+	else if (const FMDMetaDataValue* SummaryValue = Row->MetaData.Find(Key.Key))
+	{
+		Value = SummaryValue->ToString();
+	}
+
+	if (!Value.IsSet())
+	{
+		return SNullWidget::NullWidget;
+	}
+
+	// Flags don't have a value, so show that they're set
+	const FText ValueText = Value.GetValue().IsEmpty() ? INVTEXT("(Set)") : FText::FromString(Value.GetValue());
+	return SNew(SBox)
+		.Padding(4.f, 2.f)
+		.VAlign(VAlign_Center)
+		[
+			SNew(STextBlock)
+			.Text(ValueText)
+			.ToolTipText(ValueText)
+		];
+}
+
+TSharedRef<SDockTab> SMDMetaDataMatrix::SpawnTab(const FSpawnTabArgs& TabArgs)
+{
+	return SNew(SDockTab)
+		.TabRole(ETabRole::NomadTab)
+		[
+			SNew(SMDMetaDataMatrix)
+		];
+}
+
+void SMDMetaDataMatrix::OpenAssets(TArray<FAssetData> Assets)
+{
+	const TSharedPtr<SDockTab> Tab = FGlobalTabmanager::Get()->TryInvokeTab(TabId);
+	if (Tab.IsValid())
+	{
+		StaticCastSharedRef<SMDMetaDataMatrix>(Tab->GetContent())->SetAssets(MoveTemp(Assets));
+	}
+}
+
+void SMDMetaDataMatrix::OpenFolders(TArray<FString> PackagePaths)
+{
+	TArray<FAssetData> Assets;
+	FMDMetaDataExporter::GatherAssets(PackagePaths, Assets);
+	OpenAssets(MoveTemp(Assets));
+}
+
+void SMDMetaDataMatrix::RegisterMenus()
+{
+	FToolMenuOwnerScoped OwnerScoped(MDMDMX_Private::MenuOwner);
+
+	UToolMenu* FolderMenu = UToolMenus::Get()->ExtendMenu(TEXT("ContentBrowser.FolderContextMenu"));
+	FToolMenuSection& FolderSection = FolderMenu->FindOrAddSection(TEXT("PathContextBulkOperations"));
+	FolderSection.AddDynamicEntry(TEXT("MDMetaDataMatrix"), FNewToolMenuSectionDelegate::CreateLambda([](FToolMenuSection& InSection)
+	{
+		const UContentBrowserFolderContext* Context = InSection.FindContext<UContentBrowserFolderContext>();
+		if (Context == nullptr || Context->GetSelectedPackagePaths().Num() == 0)
+		{
+			return;
+		}
+
+		InSection.AddMenuEntry(
+			TEXT("MDOpenMetaDataMatrix"),
+			INVTEXT("Open in Metadata Matrix"),
+			INVTEXT("Show the meta data of every Blueprint and User Defined Struct in the selected folders in a spreadsheet"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), TEXT("PropertyEditor.Grid.TabIcon")),
+			FUIAction(FExecuteAction::CreateStatic(&SMDMetaDataMatrix::OpenFolders, Context->GetSelectedPackagePaths()))
+		);
+	}));
+
+	UToolMenu* AssetMenu = UToolMenus::Get()->ExtendMenu(TEXT("ContentBrowser.AssetContextMenu"));
+	FToolMenuSection& AssetSection = AssetMenu->FindOrAddSection(TEXT("GetAssetActions"));
+	AssetSection.AddDynamicEntry(TEXT("MDMetaDataMatrix"), FNewToolMenuSectionDelegate::CreateLambda([](FToolMenuSection& InSection)
+	{
+		const UContentBrowserAssetContextMenuContext* Context = InSection.FindContext<UContentBrowserAssetContextMenuContext>();
+		if (Context == nullptr || !Context->SelectedAssets.ContainsByPredicate(&MDMDMX_Private::IsMatrixAsset))
+		{
+			return;
+		}
+
+		InSection.AddMenuEntry(
+			TEXT("MDOpenMetaDataMatrix"),
+			INVTEXT("Open in Metadata Matrix"),
+			INVTEXT("Show the meta data of the selected Blueprints and User Defined Structs in a spreadsheet"),
+			FSlateIcon(FAppStyle::GetAppStyleSetName(), TEXT("PropertyEditor.Grid.TabIcon")),
+			FUIAction(FExecuteAction::CreateStatic(&SMDMetaDataMatrix::OpenAssets, Context->SelectedAssets))
+		);
+	}));
+}
+
+void SMDMetaDataMatrix::UnregisterMenus()
+{
+	if (UToolMenus* ToolMenus = UToolMenus::TryGet())
+	{
+		ToolMenus->UnregisterOwnerByName(MDMDMX_Private::MenuOwner);
+	}
+}
+
+void SMDMetaDataMatrix::RebuildRows()
+{
+	Rows.Reset();
+
+	for (const TWeakObjectPtr<UBlueprint>& WeakBlueprint : BoundBlueprints)
+	{
+		if (UBlueprint* Blueprint = WeakBlueprint.Get())
+		{
+			Blueprint->OnCompiled().RemoveAll(this);
+		}
+	}
+	BoundBlueprints.Reset();
+
+	struct FAssetSummary
+	{
+		TArray<FMDMetaDataFieldSummary> Fields;
+		bool bWasRead = false;
+	};
+
+	// Assets that are already loaded are read directly since their summary could be out of date
+	TArray<UObject*> LoadedAssets;
+	LoadedAssets.SetNumZeroed(SourceAssets.Num());
+	for (int32 Index = 0; Index < SourceAssets.Num(); ++Index)
+	{
+		LoadedAssets[Index] = SourceAssets[Index].FastGetAsset(false);
+	}
+
+	TArray<FAssetSummary> Summaries;
+	Summaries.SetNum(SourceAssets.Num());
+	ParallelFor(SourceAssets.Num(), [this, &LoadedAssets, &Summaries](int32 Index)
+	{
+		FString Summary;
+		if (LoadedAssets[Index] == nullptr && SourceAssets[Index].GetTagValue(FMDMetaDataProjectValidator::SummaryTagName, Summary))
+		{
+			Summaries[Index].bWasRead = FMDMetaDataProjectValidator::ReadSummary(Summary, *Snapshot, Summaries[Index].Fields);
+		}
+	});
+
+	for (int32 Index = 0; Index < SourceAssets.Num(); ++Index)
+	{
+		const FAssetData& AssetData = SourceAssets[Index];
+		if (LoadedAssets[Index] != nullptr)
+		{
+			AddLoadedRows(AssetData, LoadedAssets[Index], Rows);
+			continue;
+		}
+
+		FAssetSummary& Summary = Summaries[Index];
+		if (!Summary.bWasRead)
+		{
+			const TSharedRef<FMDMetaDataMatrixRow> Row = MakeShared<FMDMetaDataMatrixRow>();
+			Row->AssetData = AssetData;
+			Row->bIsPlaceholder = true;
+			Row->Label = TEXT("Not summarized, load to show fields");
+			Rows.Add(Row);
+			continue;
+		}
+
+		for (FMDMetaDataFieldSummary& Field : Summary.Fields)
+		{
+			const TSharedRef<FMDMetaDataMatrixRow> Row = MakeShared<FMDMetaDataMatrixRow>();
+			Row->AssetData = AssetData;
+			Row->Usage = Field.Usage;
+			Row->FieldType = MDMDMX_Private::GetFieldType(Field.Usage);
+			if (Row->FieldType == EMDMetaDataFieldType::LocalVariable || Row->FieldType == EMDMetaDataFieldType::FunctionParameter)
+			{
+				Row->FunctionName = Field.ScopeName;
+			}
+			// The struct itself is summarized under its own name, loaded rows leave it unnamed
+			Row->FieldName = (Field.Usage == EMDMetaDataKeyUsage::Structs) ? NAME_None : Field.FieldName;
+			Row->Label = MDMDMX_Private::MakeLabel(*Row);
+			Row->bHasPinType = Field.bHasPinType;
+			Row->PinType = Field.PinType;
+			Row->PinSubCategoryObjectPath = MoveTemp(Field.PinSubCategoryObjectPath);
+			Row->PinValueSubCategoryObjectPath = MoveTemp(Field.PinValueSubCategoryObjectPath);
+			FMDMetaDataValuePool::Get().InternMap(Field.MetaData, Row->MetaData);
+			Rows.Add(Row);
+		}
+	}
+
+	RebuildKeyColumns();
+	RefreshFilter();
+}
+
+void SMDMetaDataMatrix::AddLoadedRows(const FAssetData& AssetData, UObject* Asset, TArray<TSharedPtr<FMDMetaDataMatrixRow>>& OutRows)
+{
+	if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset))
+	{
+		if (!BoundBlueprints.Contains(Blueprint))
+		{
+			Blueprint->OnCompiled().AddSP(this, &SMDMetaDataMatrix::OnBlueprintCompiled);
+			BoundBlueprints.Add(Blueprint);
+		}
+	}
+
+	// Unlike summaries, loaded assets list the fields that don't have any meta data yet
+	TArray<FMDMetaDataFieldReference> Fields;
+	UMDMetaDataEditorLibrary::GetMetaDataFields(Asset, Fields);
+	for (const FMDMetaDataFieldReference& Field : Fields)
+	{
+		const TSharedPtr<FMDMetaDataEditorFieldView> FieldView = UMDMetaDataEditorLibrary::MakeFieldView(Field);
+		if (!FieldView.IsValid())
+		{
+			continue;
+		}
+
+		FieldView->RequestRefresh.BindSP(this, &SMDMetaDataMatrix::OnFieldViewRefreshRequested);
+
+		const TSharedRef<FMDMetaDataMatrixRow> Row = MakeShared<FMDMetaDataMatrixRow>();
+		Row->AssetData = AssetData;
+		Row->FieldType = Field.FieldType;
+		Row->Usage = MDMDMX_Private::GetUsage(Field.FieldType);
+		Row->FunctionName = Field.FunctionName;
+		Row->FieldName = Field.FieldName;
+		if (const FProperty* Property = FieldView->GetProperty())
+		{
+			// Match the summaries, which name struct members the way the user sees them
+			if (Field.FieldType == EMDMetaDataFieldType::StructMember)
+			{
+				Row->FieldName = FName(*Property->GetAuthoredName());
+			}
+
+			Row->bHasPinType = GetDefault<UEdGraphSchema_K2>()->ConvertPropertyToPinType(Property, Row->PinType);
+		}
+		Row->Label = MDMDMX_Private::MakeLabel(*Row);
+		Row->FieldView = FieldView;
+		OutRows.Add(Row);
+	}
+}
+
+void SMDMetaDataMatrix::ReplaceAssetRows(const FAssetData& AssetData, UObject* Asset)
+{
+	const FSoftObjectPath AssetPath = AssetData.GetSoftObjectPath();
+	auto IsAssetRow = [&AssetPath](const TSharedPtr<FMDMetaDataMatrixRow>& Row)
+	{
+		return Row->AssetData.GetSoftObjectPath() == AssetPath;
+	};
+
+	// An asset's rows are always next to each other
+	const int32 FirstIndex = Rows.IndexOfByPredicate(IsAssetRow);
+	if (FirstIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	int32 NumAssetRows = 1;
+	while (Rows.IsValidIndex(FirstIndex + NumAssetRows) && IsAssetRow(Rows[FirstIndex + NumAssetRows]))
+	{
+		++NumAssetRows;
+	}
+
+	TArray<TSharedPtr<FMDMetaDataMatrixRow>> LoadedRows;
+	AddLoadedRows(AssetData, Asset, LoadedRows);
+
+	Rows.RemoveAt(FirstIndex, NumAssetRows);
+	Rows.Insert(LoadedRows, FirstIndex);
+
+	RebuildKeyColumns();
+	RefreshFilter();
+}
+
+void SMDMetaDataMatrix::RefreshFilter()
+{
+	FilteredRows.Reset();
+	if (FilterString.IsEmpty())
+	{
+		FilteredRows = Rows;
+	}
+	else
+	{
+		for (const TSharedPtr<FMDMetaDataMatrixRow>& Row : Rows)
+		{
+			if (Row->Label.Contains(FilterString) || Row->AssetData.AssetName.ToString().Contains(FilterString))
+			{
+				FilteredRows.Add(Row);
+			}
+		}
+	}
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+void SMDMetaDataMatrix::RebuildKeyColumns()
+{
+	KeyColumns.Reset();
+
+	// Struct members are summarized without a usage, so they can take any key
+	EMDMetaDataKeyUsage RowUsages = EMDMetaDataKeyUsage::None;
+	bool bHasStructMembers = false;
+	for (const TSharedPtr<FMDMetaDataMatrixRow>& Row : Rows)
+	{
+		if (!Row->bIsPlaceholder)
+		{
+			RowUsages |= Row->Usage;
+			bHasStructMembers |= Row->Usage == EMDMetaDataKeyUsage::None;
+		}
+	}
+
+	if (Snapshot.IsValid())
+	{
+		const TArray<FMDMetaDataEditorCompiledKey>& Keys = Snapshot->GetKeys();
+		for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); ++KeyIndex)
+		{
+			if (bHasStructMembers || EnumHasAnyFlags(Keys[KeyIndex].Usage, RowUsages))
+			{
+				KeyColumns.Add(KeyIndex);
+			}
+		}
+	}
+
+	RebuildHeader();
+}
+
+void SMDMetaDataMatrix::RebuildHeader()
+{
+	using namespace MDMDMX_Private;
+
+	if (!HeaderRow.IsValid() || !Snapshot.IsValid())
+	{
+		return;
+	}
+
+	FirstVisibleColumn = FMath::Clamp(FirstVisibleColumn, 0, FMath::Max(0, KeyColumns.Num() - NumVisibleColumns));
+	const int32 EndColumn = FMath::Min(FirstVisibleColumn + NumVisibleColumns, KeyColumns.Num());
+
+	HeaderRow->ClearColumns();
+	ColumnKeyIndices.Reset();
+
+	HeaderRow->AddColumn(SHeaderRow::Column(AssetColumn)
+		.DefaultLabel(INVTEXT("Asset"))
+		.ManualWidth(AssetColumnWidth));
+
+	HeaderRow->AddColumn(SHeaderRow::Column(FieldColumn)
+		.DefaultLabel(INVTEXT("Field"))
+		.ManualWidth(FieldColumnWidth));
+
+	for (int32 ColumnIndex = FirstVisibleColumn; ColumnIndex < EndColumn; ++ColumnIndex)
+	{
+		const int32 KeyIndex = KeyColumns[ColumnIndex];
+		const FMDMetaDataKey& Key = Snapshot->GetKeys()[KeyIndex].Key;
+		const FName ColumnId = *FString::Printf(TEXT("MDMatrix_Key%d"), KeyIndex);
+		ColumnKeyIndices.Add(ColumnId, KeyIndex);
+
+		HeaderRow->AddColumn(SHeaderRow::Column(ColumnId)
+			.DefaultLabel(Key.GetKeyDisplayText())
+			.DefaultTooltip(Key.GetToolTipText())
+			.FillWidth(1.f));
+	}
+
+	if (ColumnScrollBar.IsValid())
+	{
+		const float NumColumns = FMath::Max(1, KeyColumns.Num());
+		ColumnScrollBar->SetState(FirstVisibleColumn / NumColumns, FMath::Min(1.f, NumVisibleColumns / NumColumns));
+	}
+
+	if (ListView.IsValid())
+	{
+		ListView->RebuildList();
+	}
+}
+
+const TBitArray<>& SMDMetaDataMatrix::GetApplicableKeys(FMDMetaDataMatrixRow& Row) const
+{
+	if (!Row.ApplicableKeys.IsSet())
+	{
+		if (Row.bHasPinType && (!Row.PinSubCategoryObjectPath.IsEmpty() || !Row.PinValueSubCategoryObjectPath.IsEmpty()))
+		{
+			// Rows are only a preview so types aren't loaded for them, types that aren't loaded skip the type tests until the asset is loaded
+			if (!Row.PinSubCategoryObjectPath.IsEmpty())
+			{
+				Row.PinType.PinSubCategoryObject = FindObject<UObject>(nullptr, *Row.PinSubCategoryObjectPath);
+				Row.bHasPinType &= Row.PinType.PinSubCategoryObject.IsValid();
+			}
+
+			if (!Row.PinValueSubCategoryObjectPath.IsEmpty())
+			{
+				Row.PinType.PinValueType.TerminalSubCategoryObject = FindObject<UObject>(nullptr, *Row.PinValueSubCategoryObjectPath);
+				Row.bHasPinType &= Row.PinType.PinValueType.TerminalSubCategoryObject.IsValid();
+			}
+		}
+
+		TBitArray<> ApplicableKeys(false, Snapshot->GetKeys().Num());
+		const FMDMetaDataResolvedClass BlueprintClass(FMDMetaDataProjectValidator::GetBlueprintClass(Row.AssetData));
+		TOptional<FMDMetaDataResolvedPinType> PinType;
+		if (Row.bHasPinType)
+		{
+			PinType.Emplace(Row.PinType);
+		}
+
+		Snapshot->ForEachKeyIndex(Row.Usage, &BlueprintClass, PinType.GetPtrOrNull(), [&ApplicableKeys](int32 KeyIndex)
+		{
+			ApplicableKeys[KeyIndex] = true;
+		});
+
+		Row.ApplicableKeys.Emplace(MoveTemp(ApplicableKeys));
+	}
+
+	return Row.ApplicableKeys.GetValue();
+}
+
+TSharedRef<ITableRow> SMDMetaDataMatrix::OnGenerateRow(TSharedPtr<FMDMetaDataMatrixRow> Row, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(MDMDMX_Private::SMDMetaDataMatrixRow, OwnerTable)
+		.Row(Row)
+		.Matrix(SharedThis(this));
+}
+
+void SMDMetaDataMatrix::LoadRowAsset(TSharedPtr<FMDMetaDataMatrixRow> Row)
+{
+	if (!Row.IsValid() || Row->FieldView.IsValid())
+	{
+		return;
+	}
+
+	const FAssetData AssetData = Row->AssetData;
+	UObject* Asset = AssetData.GetAsset();
+	if (!IsValid(Asset))
+	{
+		return;
+	}
+
+	ReplaceAssetRows(AssetData, Asset);
+
+	// Keep the field that was clicked selected now that it's been replaced by an editable row
+	const TSharedPtr<FMDMetaDataMatrixRow> LoadedRow = FindRow(*Row);
+	if (LoadedRow.IsValid() && FilteredRows.Contains(LoadedRow))
+	{
+		ListView->SetSelection(LoadedRow);
+		ListView->RequestScrollIntoView(LoadedRow);
+	}
+}
+
+TSharedPtr<FMDMetaDataMatrixRow> SMDMetaDataMatrix::FindRow(const FMDMetaDataMatrixRow& Row) const
+{
+	const TSharedPtr<FMDMetaDataMatrixRow>* FoundRow = Rows.FindByPredicate([&Row](const TSharedPtr<FMDMetaDataMatrixRow>& Other)
+	{
+		return Other->AssetData.GetSoftObjectPath() == Row.AssetData.GetSoftObjectPath()
+			&& Other->FunctionName == Row.FunctionName
+			&& Other->FieldName == Row.FieldName;
+	});
+
+	return (FoundRow != nullptr) ? *FoundRow : nullptr;
+}
+
+FReply SMDMetaDataMatrix::OnEditClicked(TSharedPtr<FMDMetaDataMatrixRow> Row)
+{
+	LoadRowAsset(Row);
+	return FReply::Handled();
+}
+
+TSharedRef<SWidget> SMDMetaDataMatrix::CreatePresetMenu()
+{
+	FMenuBuilder MenuBuilder(true, nullptr);
+
+	const TArray<FMDMetaDataPreset>& Presets = GetDefault<UMDMetaDataEditorConfig>()->GetMetaDataPresets();
+	if (Presets.IsEmpty())
+	{
+		MenuBuilder.AddWidget(SNew(STextBlock).Text(INVTEXT("No presets, they're configured in the Meta Data Editor project settings")), FText::GetEmpty());
+	}
+
+	for (const FMDMetaDataPreset& Preset : Presets)
+	{
+		MenuBuilder.AddMenuEntry(
+			Preset.GetDisplayText(),
+			Preset.GetToolTipText(),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateSP(this, &SMDMetaDataMatrix::ApplyPresetToSelection, Preset.PresetName))
+		);
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+void SMDMetaDataMatrix::ApplyPresetToSelection(FName PresetName)
+{
+	const FMDMetaDataPreset* Preset = GetDefault<UMDMetaDataEditorConfig>()->FindMetaDataPreset(PresetName);
+	if (Preset == nullptr || !ListView.IsValid())
+	{
+		return;
+	}
+
+	const TArray<TSharedPtr<FMDMetaDataMatrixRow>> SelectedRows = ListView->GetSelectedItems();
+
+	// Summary rows can't be edited, so their assets are loaded first which replaces them with editable rows
+	TArray<FAssetData> AssetsToLoad;
+	for (const TSharedPtr<FMDMetaDataMatrixRow>& Row : SelectedRows)
+	{
+		if (!Row->FieldView.IsValid() && !Row->bIsPlaceholder)
+		{
+			AssetsToLoad.AddUnique(Row->AssetData);
+		}
+	}
+
+	for (const FAssetData& AssetData : AssetsToLoad)
+	{
+		UObject* Asset = AssetData.GetAsset();
+		if (IsValid(Asset))
+		{
+			ReplaceAssetRows(AssetData, Asset);
+		}
+	}
+
+	TArray<TSharedPtr<FMDMetaDataMatrixRow>> PresetRows;
+	TArray<TSharedPtr<FMDMetaDataEditorFieldView>> FieldViews;
+	for (const TSharedPtr<FMDMetaDataMatrixRow>& Row : SelectedRows)
+	{
+		const TSharedPtr<FMDMetaDataMatrixRow> PresetRow = Row->FieldView.IsValid() ? Row : FindRow(*Row);
+		if (PresetRow.IsValid() && PresetRow->FieldView.IsValid())
+		{
+			PresetRows.Add(PresetRow);
+			FieldViews.Add(PresetRow->FieldView);
+		}
+	}
+
+	const int32 NumApplied = FMDMetaDataEditorFieldView::ApplyPresetToFields(*Preset, FieldViews);
+
+	ListView->ClearSelection();
+	for (const TSharedPtr<FMDMetaDataMatrixRow>& PresetRow : PresetRows)
+	{
+		ListView->SetItemSelection(PresetRow, true);
+	}
+	ListView->RebuildList();
+
+	FNotificationInfo Info(FText::Format(INVTEXT("Applied {0} to {1} of {2} selected fields"), Preset->GetDisplayText(), FText::AsNumber(NumApplied), FText::AsNumber(SelectedRows.Num())));
+	Info.ExpireDuration = 5.f;
+	FSlateNotificationManager::Get().AddNotification(Info);
+}
+
+bool SMDMetaDataMatrix::HasSelection() const
+{
+	return ListView.IsValid() && ListView->GetNumItemsSelected() > 0;
+}
+
+void SMDMetaDataMatrix::OnSearchTextChanged(const FText& Text)
+{
+	FilterString = Text.ToString();
+	RefreshFilter();
+}
+
+FReply SMDMetaDataMatrix::OnRefreshClicked()
+{
+	RebuildRows();
+	return FReply::Handled();
+}
+
+void SMDMetaDataMatrix::OnColumnsScrolled(float Offset)
+{
+	const int32 NewFirstVisibleColumn = FMath::RoundToInt(Offset * KeyColumns.Num());
+	if (NewFirstVisibleColumn != FirstVisibleColumn)
+	{
+		FirstVisibleColumn = NewFirstVisibleColumn;
+		RebuildHeader();
+	}
+}
+
+FText SMDMetaDataMatrix::GetStatusText() const
+{
+	return FText::Format(INVTEXT("{0} Fields in {1} Assets"), FText::AsNumber(FilteredRows.Num()), FText::AsNumber(SourceAssets.Num()));
+}
+
+void SMDMetaDataMatrix::OnMetaDataKeysChanged()
+{
+	Snapshot = GetDefault<UMDMetaDataEditorConfig>()->GetSnapshot();
+
+	for (const TSharedPtr<FMDMetaDataMatrixRow>& Row : Rows)
+	{
+		Row->ApplicableKeys.Reset();
+	}
+
+	RebuildKeyColumns();
+}
+
+void SMDMetaDataMatrix::OnBlueprintCompiled(UBlueprint* Blueprint)
+{
+	// Compiling regenerates the properties that the field views point to
+	if (IsValid(Blueprint))
+	{
+		ReplaceAssetRows(FAssetData(Blueprint), Blueprint);
+	}
+}
+
+void SMDMetaDataMatrix::OnFieldViewRefreshRequested()
+{
+	if (ListView.IsValid())
+	{
+		ListView->RebuildList();
+	}
+}
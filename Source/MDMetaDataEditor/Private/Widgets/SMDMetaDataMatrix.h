@@ -0,0 +1,130 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "AssetRegistry/AssetData.h"
+#include "Config/MDMetaDataEditorConfigSnapshot.h"
+#include "EdGraph/EdGraphPin.h"
+#include "MDMetaDataEditorLibrary.h"
+#include "MDMetaDataValuePool.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+class FMDMetaDataEditorFieldView;
+class FSpawnTabArgs;
+class SDockTab;
+class SHeaderRow;
+class SScrollBar;
+class UBlueprint;
+
+// A single field of an asset, read from the asset's meta data summary until the asset is loaded for editing
+struct FMDMetaDataMatrixRow
+{
+	FAssetData AssetData;
+
+	EMDMetaDataFieldType FieldType = EMDMetaDataFieldType::Variable;
+	EMDMetaDataKeyUsage Usage = EMDMetaDataKeyUsage::None;
+	FName FunctionName = NAME_None;
+	FName FieldName = NAME_None;
+	FString Label;
+
+	bool bHasPinType = false;
+	FEdGraphPinType PinType;
+	// Summaries only store the paths of the pin type's sub category objects, they're resolved when the row is first shown
+	FString PinSubCategoryObjectPath;
+	FString PinValueSubCategoryObjectPath;
+
+	// The summarized meta data, only used until the asset is loaded. Interned since views over folders hold thousands of rows of mostly repeated values.
+	TMap<FName, FMDMetaDataValue> MetaData;
+
+	// Set once the asset is loaded, cells are then edited through it
+	TSharedPtr<FMDMetaDataEditorFieldView> FieldView;
+
+	// Stands in for all the fields of an asset that isn't loaded and has no summary
+	bool bIsPlaceholder = false;
+
+	// Bit N is set if key N of the snapshot can be used on this field
+	TOptional<TBitArray<>> ApplicableKeys;
+};
+
+/**
+ * A spreadsheet of the meta data of fields across many Blueprints and User Defined Structs, with a column per configured key.
+ * Rows come from the asset registry summary so assets are only loaded once one of their rows is edited,
+ * and only the rows and key columns that fit in the view are ever built.
+ */
+class SMDMetaDataMatrix : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SMDMetaDataMatrix)
+		{}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+	virtual ~SMDMetaDataMatrix() override;
+
+	virtual void Tick(const FGeometry& AllottedGeometry, const double InCurrentTime, const float InDeltaTime) override;
+
+	// Replaces the rows with the fields of the assets
+	void SetAssets(TArray<FAssetData> Assets);
+
+	TSharedRef<SWidget> GenerateCellWidget(const TSharedPtr<FMDMetaDataMatrixRow>& Row, const FName& ColumnName);
+
+	static const FName TabId;
+
+	static TSharedRef<SDockTab> SpawnTab(const FSpawnTabArgs& TabArgs);
+	static void OpenAssets(TArray<FAssetData> Assets);
+	static void OpenFolders(TArray<FString> PackagePaths);
+
+	static void RegisterMenus();
+	static void UnregisterMenus();
+
+private:
+	void RebuildRows();
+	void AddLoadedRows(const FAssetData& AssetData, UObject* Asset, TArray<TSharedPtr<FMDMetaDataMatrixRow>>& OutRows);
+	void ReplaceAssetRows(const FAssetData& AssetData, UObject* Asset);
+	void RefreshFilter();
+
+	void RebuildKeyColumns();
+	void RebuildHeader();
+
+	const TBitArray<>& GetApplicableKeys(FMDMetaDataMatrixRow& Row) const;
+
+	// Finds the row of the same field in Rows, such as the editable row that replaced a summary row
+	TSharedPtr<FMDMetaDataMatrixRow> FindRow(const FMDMetaDataMatrixRow& Row) const;
+
+	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FMDMetaDataMatrixRow> Row, const TSharedRef<STableViewBase>& OwnerTable);
+	void LoadRowAsset(TSharedPtr<FMDMetaDataMatrixRow> Row);
+	FReply OnEditClicked(TSharedPtr<FMDMetaDataMatrixRow> Row);
+
+	TSharedRef<SWidget> CreatePresetMenu();
+	void ApplyPresetToSelection(FName PresetName);
+	bool HasSelection() const;
+
+	void OnSearchTextChanged(const FText& Text);
+	FReply OnRefreshClicked();
+	void OnColumnsScrolled(float Offset);
+	FText GetStatusText() const;
+
+	void OnMetaDataKeysChanged();
+	void OnBlueprintCompiled(UBlueprint* Blueprint);
+	void OnFieldViewRefreshRequested();
+
+	TArray<FAssetData> SourceAssets;
+	TArray<TSharedPtr<FMDMetaDataMatrixRow>> Rows;
+	TArray<TSharedPtr<FMDMetaDataMatrixRow>> FilteredRows;
+	FString FilterString;
+
+	TSharedPtr<const FMDMetaDataEditorConfigSnapshot> Snapshot;
+
+	// Indices into the snapshot's keys that get a column, only the window starting at FirstVisibleColumn is added to the header
+	TArray<int32> KeyColumns;
+	TMap<FName, int32> ColumnKeyIndices;
+	int32 FirstVisibleColumn = 0;
+	int32 NumVisibleColumns = 0;
+
+	TArray<TWeakObjectPtr<UBlueprint>> BoundBlueprints;
+
+	TSharedPtr<SListView<TSharedPtr<FMDMetaDataMatrixRow>>> ListView;
+	TSharedPtr<SHeaderRow> HeaderRow;
+	TSharedPtr<SScrollBar> ColumnScrollBar;
+};
@@ -0,0 +1,144 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "SMDMetaDataParamPicker.h"
+
+#include "DetailLayoutBuilder.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Widgets/Input/SComboButton.h"
+
+void SMDMetaDataParamPicker::Construct(const FArguments& InArgs)
+{
+	Key = InArgs._Key;
+	bIsMulti = InArgs._bMultiSelect;
+	MetaDataValue = InArgs._MetaDataValue;
+	OnGetParams = InArgs._OnGetParams;
+	OnRemoveMetaData = InArgs._OnRemoveMetaData;
+	OnSetMetaData = InArgs._OnSetMetaData;
+
+	ChildSlot
+	[
+		SNew(SComboButton)
+		.OnGetMenuContent(this, &SMDMetaDataParamPicker::OnGetMenuContent)
+		.ButtonContent()
+		[
+			SNew(STextBlock)
+			.Text(this, &SMDMetaDataParamPicker::GetValue)
+			.Font(IDetailLayoutBuilder::GetDetailFont())
+		]
+	];
+}
+
+FText SMDMetaDataParamPicker::GetValue() const
+{
+	const TArray<FString> Params = GetSelectedParams();
+	if (Params.IsEmpty())
+	{
+		return INVTEXT("None");
+	}
+
+	return FText::FromString(FString::Join(Params, TEXT(", ")));
+}
+
+TSharedRef<SWidget> SMDMetaDataParamPicker::OnGetMenuContent()
+{
+	const TArray<FName> Params = OnGetParams.IsBound() ? OnGetParams.Execute() : TArray<FName>();
+
+	// Multi-select keeps the menu open so several params can be toggled at once
+	FMenuBuilder MenuBuilder(!bIsMulti, nullptr);
+
+	MenuBuilder.AddMenuEntry(
+		INVTEXT("None"),
+		INVTEXT("Remove this meta data"),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateSP(this, &SMDMetaDataParamPicker::OnClearClicked))
+	);
+
+	MenuBuilder.AddSeparator();
+
+	if (Params.IsEmpty())
+	{
+		MenuBuilder.AddWidget(SNew(STextBlock).Text(INVTEXT("This function has no params")).Font(IDetailLayoutBuilder::GetDetailFont()), FText::GetEmpty());
+	}
+
+	for (const FName& Param : Params)
+	{
+		MenuBuilder.AddMenuEntry(
+			FText::FromName(Param),
+			FText::GetEmpty(),
+			FSlateIcon(),
+			FUIAction(
+				FExecuteAction::CreateSP(this, &SMDMetaDataParamPicker::OnParamClicked, Param),
+				FCanExecuteAction(),
+				FIsActionChecked::CreateSP(this, &SMDMetaDataParamPicker::IsParamSelected, Param)
+			),
+			NAME_None,
+			bIsMulti ? EUserInterfaceActionType::ToggleButton : EUserInterfaceActionType::RadioButton
+		);
+	}
+
+	return MenuBuilder.MakeWidget();
+}
+
+bool SMDMetaDataParamPicker::IsParamSelected(FName Param) const
+{
+	return GetSelectedParams().Contains(Param.ToString());
+}
+
+void SMDMetaDataParamPicker::OnParamClicked(FName Param)
+{
+	const FString ParamString = Param.ToString();
+	if (!bIsMulti)
+	{
+		SetSelectedParams({ ParamString });
+		return;
+	}
+
+	TArray<FString> Params = GetSelectedParams();
+	if (Params.Remove(ParamString) == 0)
+	{
+		Params.Add(ParamString);
+	}
+
+	SetSelectedParams(Params);
+}
+
+void SMDMetaDataParamPicker::OnClearClicked()
+{
+	SetSelectedParams({});
+}
+
+TArray<FString> SMDMetaDataParamPicker::GetSelectedParams() const
+{
+	TArray<FString> Params;
+
+	const TOptional<FString> ValueStringOptional = MetaDataValue.Get(TOptional<FString>());
+	if (ValueStringOptional.IsSet())
+	{
+		if (bIsMulti)
+		{
+			ValueStringOptional.GetValue().ParseIntoArray(Params, TEXT(","));
+			for (FString& Param : Params)
+			{
+				Param.TrimStartAndEndInline();
+			}
+		}
+		else if (!ValueStringOptional.GetValue().IsEmpty())
+		{
+			Params.Add(ValueStringOptional.GetValue());
+		}
+	}
+
+	return Params;
+}
+
+void SMDMetaDataParamPicker::SetSelectedParams(const TArray<FString>& Params)
+{
+	if (Params.IsEmpty())
+	{
+		OnRemoveMetaData.ExecuteIfBound(Key);
+	}
+	else
+	{
+		OnSetMetaData.ExecuteIfBound(Key, FString::Join(Params, TEXT(",")));
+	}
+}
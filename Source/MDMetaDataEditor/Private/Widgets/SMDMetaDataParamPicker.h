@@ -0,0 +1,48 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Widgets/SCompoundWidget.h"
+
+/**
+ * Picks one or more params of the function, custom event or macro that's being edited
+ */
+class SMDMetaDataParamPicker : public SCompoundWidget
+{
+public:
+	DECLARE_DELEGATE_RetVal(TArray<FName>, FOnGetParams);
+	DECLARE_DELEGATE_OneParam(FOnRemoveMetaData, const FName&);
+	DECLARE_DELEGATE_TwoParams(FOnSetMetaData, const FName&, const FString& Value);
+
+	SLATE_BEGIN_ARGS(SMDMetaDataParamPicker)
+	{}
+		SLATE_ARGUMENT_DEFAULT(FName, Key) = NAME_None;
+		SLATE_ARGUMENT_DEFAULT(bool, bMultiSelect) = false;
+
+		SLATE_ATTRIBUTE(TOptional<FString>, MetaDataValue);
+		SLATE_EVENT(FOnGetParams, OnGetParams);
+		SLATE_EVENT(FOnRemoveMetaData, OnRemoveMetaData);
+		SLATE_EVENT(FOnSetMetaData, OnSetMetaData);
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	FText GetValue() const;
+
+	TSharedRef<SWidget> OnGetMenuContent();
+
+	bool IsParamSelected(FName Param) const;
+	void OnParamClicked(FName Param);
+	void OnClearClicked();
+
+	TArray<FString> GetSelectedParams() const;
+	void SetSelectedParams(const TArray<FString>& Params);
+
+	FName Key = NAME_None;
+	bool bIsMulti = false;
+	TAttribute<TOptional<FString>> MetaDataValue;
+	FOnGetParams OnGetParams;
+	FOnRemoveMetaData OnRemoveMetaData;
+	FOnSetMetaData OnSetMetaData;
+};
@@ -0,0 +1,269 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "SMDMetaDataTypePicker.h"
+
+#include "DetailLayoutBuilder.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SComboButton.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/SBoxPanel.h"
+
+void SMDMetaDataTypePicker::Construct(const FArguments& InArgs)
+{
+	Key = InArgs._Key;
+	Kind = InArgs._Kind;
+	BasePath = InArgs._BasePath;
+	bIsMulti = InArgs._bMultiSelect;
+	TypeIndex = InArgs._TypeIndex;
+	MetaDataValue = InArgs._MetaDataValue;
+	OnRemoveMetaData = InArgs._OnRemoveMetaData;
+	OnSetMetaData = InArgs._OnSetMetaData;
+
+	ChildSlot
+	[
+		SAssignNew(ComboButton, SComboButton)
+		.ToolTipText(this, &SMDMetaDataTypePicker::GetValueToolTip)
+		.OnGetMenuContent(this, &SMDMetaDataTypePicker::OnGetMenuContent)
+		.ButtonContent()
+		[
+			SNew(STextBlock)
+			.Text(this, &SMDMetaDataTypePicker::GetValue)
+			.Font(IDetailLayoutBuilder::GetDetailFont())
+		]
+	];
+}
+
+FText SMDMetaDataTypePicker::GetValue() const
+{
+	const TArray<FString> Paths = GetSelectedPaths();
+	if (Paths.IsEmpty())
+	{
+		return INVTEXT("None");
+	}
+
+	FString Value;
+	for (const FString& Path : Paths)
+	{
+		if (!Value.IsEmpty())
+		{
+			Value += TEXT(", ");
+		}
+
+		Value += GetDisplayName(Path);
+	}
+
+	return FText::FromString(Value);
+}
+
+FText SMDMetaDataTypePicker::GetValueToolTip() const
+{
+	return FText::FromString(FString::Join(GetSelectedPaths(), TEXT("\r\n")));
+}
+
+TSharedRef<SWidget> SMDMetaDataTypePicker::OnGetMenuContent()
+{
+	// Only copy the types out of the index while the menu is open, the index only visits the types under BasePath
+	AllEntries.Reset();
+	if (const TSharedPtr<FMDMetaDataTypeIndex> TypeIndexPtr = TypeIndex.Pin())
+	{
+		TypeIndexPtr->ForEachType(Kind, BasePath, [this](const FMDMetaDataTypeEntry& Entry)
+		{
+			AllEntries.Add(MakeShared<FMDMetaDataTypeEntry>(Entry));
+		});
+	}
+
+	AllEntries.Sort([](const FEntryPtr& A, const FEntryPtr& B)
+	{
+		return A->Name.LexicalLess(B->Name);
+	});
+
+	SearchText = FText::GetEmpty();
+	RefreshFilteredEntries();
+
+	TSharedRef<SWidget> MenuContent = SNew(SBox)
+		.MaxDesiredHeight(400.f)
+		.WidthOverride(300.f)
+		[
+			SNew(SVerticalBox)
+			+SVerticalBox::Slot()
+			.AutoHeight()
+			.Padding(4.f)
+			[
+				SNew(SHorizontalBox)
+				+SHorizontalBox::Slot()
+				.FillWidth(1.f)
+				[
+					SAssignNew(SearchBox, SSearchBox)
+					.OnTextChanged(this, &SMDMetaDataTypePicker::OnSearchTextChanged)
+				]
+				+SHorizontalBox::Slot()
+				.AutoWidth()
+				.Padding(4.f, 0.f, 0.f, 0.f)
+				[
+					SNew(SButton)
+					.Text(INVTEXT("Clear"))
+					.ToolTipText(INVTEXT("Remove this meta data"))
+					.OnClicked(this, &SMDMetaDataTypePicker::OnClearClicked)
+				]
+			]
+			+SVerticalBox::Slot()
+			.FillHeight(1.f)
+			[
+				SAssignNew(ListView, SListView<FEntryPtr>)
+				.ListItemsSource(&FilteredEntries)
+				.SelectionMode(bIsMulti ? ESelectionMode::None : ESelectionMode::Single)
+				.OnGenerateRow(this, &SMDMetaDataTypePicker::OnGenerateRow)
+				.OnSelectionChanged(this, &SMDMetaDataTypePicker::OnSelectionChanged)
+			]
+		];
+
+	ComboButton->SetMenuContentWidgetToFocus(SearchBox);
+
+	return MenuContent;
+}
+
+void SMDMetaDataTypePicker::OnSearchTextChanged(const FText& InSearchText)
+{
+	SearchText = InSearchText;
+	RefreshFilteredEntries();
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+void SMDMetaDataTypePicker::RefreshFilteredEntries()
+{
+	const FString SearchString = SearchText.ToString();
+	if (SearchString.IsEmpty())
+	{
+		FilteredEntries = AllEntries;
+		return;
+	}
+
+	FilteredEntries.Reset();
+	for (const FEntryPtr& Entry : AllEntries)
+	{
+		if (GetDisplayName(Entry->Path).Contains(SearchString))
+		{
+			FilteredEntries.Add(Entry);
+		}
+	}
+}
+
+TSharedRef<ITableRow> SMDMetaDataTypePicker::OnGenerateRow(FEntryPtr Entry, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	const FText DisplayText = FText::FromString(GetDisplayName(Entry->Path));
+
+	TSharedRef<SWidget> RowContent = SNew(STextBlock)
+		.Text(DisplayText)
+		.HighlightText_Lambda([this]() { return SearchText; })
+		.Font(IDetailLayoutBuilder::GetDetailFont());
+
+	if (bIsMulti)
+	{
+		RowContent = SNew(SCheckBox)
+			.IsChecked(this, &SMDMetaDataTypePicker::IsEntryChecked, Entry)
+			.OnCheckStateChanged(this, &SMDMetaDataTypePicker::OnEntryCheckStateChanged, Entry)
+			[
+				RowContent
+			];
+	}
+
+	return SNew(STableRow<FEntryPtr>, OwnerTable)
+		.ToolTipText(FText::FromString(Entry->Path))
+		[
+			RowContent
+		];
+}
+
+void SMDMetaDataTypePicker::OnSelectionChanged(FEntryPtr Entry, ESelectInfo::Type SelectInfo)
+{
+	if (!Entry.IsValid() || SelectInfo == ESelectInfo::Direct)
+	{
+		return;
+	}
+
+	OnSetMetaData.ExecuteIfBound(Key, Entry->Path);
+	ComboButton->SetIsOpen(false);
+}
+
+ECheckBoxState SMDMetaDataTypePicker::IsEntryChecked(FEntryPtr Entry) const
+{
+	return GetSelectedPaths().Contains(Entry->Path) ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SMDMetaDataTypePicker::OnEntryCheckStateChanged(ECheckBoxState State, FEntryPtr Entry)
+{
+	TArray<FString> Paths = GetSelectedPaths();
+	if (State == ECheckBoxState::Checked)
+	{
+		Paths.AddUnique(Entry->Path);
+	}
+	else
+	{
+		Paths.Remove(Entry->Path);
+	}
+
+	SetSelectedPaths(Paths);
+}
+
+FReply SMDMetaDataTypePicker::OnClearClicked()
+{
+	SetSelectedPaths({});
+	ComboButton->SetIsOpen(false);
+	return FReply::Handled();
+}
+
+TArray<FString> SMDMetaDataTypePicker::GetSelectedPaths() const
+{
+	TArray<FString> Paths;
+
+	const TOptional<FString> ValueStringOptional = MetaDataValue.Get(TOptional<FString>());
+	if (ValueStringOptional.IsSet())
+	{
+		if (bIsMulti)
+		{
+			ValueStringOptional.GetValue().ParseIntoArray(Paths, TEXT(","));
+			for (FString& Path : Paths)
+			{
+				Path.TrimStartAndEndInline();
+			}
+		}
+		else if (!ValueStringOptional.GetValue().IsEmpty())
+		{
+			Paths.Add(ValueStringOptional.GetValue());
+		}
+	}
+
+	return Paths;
+}
+
+void SMDMetaDataTypePicker::SetSelectedPaths(const TArray<FString>& Paths)
+{
+	if (Paths.IsEmpty())
+	{
+		OnRemoveMetaData.ExecuteIfBound(Key);
+	}
+	else
+	{
+		OnSetMetaData.ExecuteIfBound(Key, FString::Join(Paths, TEXT(",")));
+	}
+}
+
+FString SMDMetaDataTypePicker::GetDisplayName(const FString& Path)
+{
+	// Values may be full paths or, as written by hand, just the type's name
+	FString Name = Path;
+	int32 SeparatorIndex = INDEX_NONE;
+	if (Name.FindLastChar(TEXT('.'), SeparatorIndex))
+	{
+		Name.RightChopInline(SeparatorIndex + 1);
+	}
+
+	Name.RemoveFromEnd(TEXT("_C"));
+	return Name;
+}
@@ -0,0 +1,74 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Types/MDMetaDataTypeIndex.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+
+class SComboButton;
+class SSearchBox;
+
+/**
+ * Picks one or more classes, interfaces or structs from FMDMetaDataTypeIndex, so listing them never loads a Blueprint
+ */
+class SMDMetaDataTypePicker : public SCompoundWidget
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnRemoveMetaData, const FName&);
+	DECLARE_DELEGATE_TwoParams(FOnSetMetaData, const FName&, const FString& Value);
+
+	SLATE_BEGIN_ARGS(SMDMetaDataTypePicker)
+	{}
+		SLATE_ARGUMENT_DEFAULT(FName, Key) = NAME_None;
+		SLATE_ARGUMENT_DEFAULT(EMDMetaDataTypeKind, Kind) = EMDMetaDataTypeKind::Class;
+		// Only types that are or derive from this type are listed
+		SLATE_ARGUMENT(FString, BasePath);
+		SLATE_ARGUMENT_DEFAULT(bool, bMultiSelect) = false;
+		SLATE_ARGUMENT(TSharedPtr<FMDMetaDataTypeIndex>, TypeIndex);
+
+		SLATE_ATTRIBUTE(TOptional<FString>, MetaDataValue);
+		SLATE_EVENT(FOnRemoveMetaData, OnRemoveMetaData);
+		SLATE_EVENT(FOnSetMetaData, OnSetMetaData);
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+private:
+	using FEntryPtr = TSharedPtr<FMDMetaDataTypeEntry>;
+
+	FText GetValue() const;
+	FText GetValueToolTip() const;
+
+	TSharedRef<SWidget> OnGetMenuContent();
+	void OnSearchTextChanged(const FText& InSearchText);
+	void RefreshFilteredEntries();
+
+	TSharedRef<ITableRow> OnGenerateRow(FEntryPtr Entry, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnSelectionChanged(FEntryPtr Entry, ESelectInfo::Type SelectInfo);
+	ECheckBoxState IsEntryChecked(FEntryPtr Entry) const;
+	void OnEntryCheckStateChanged(ECheckBoxState State, FEntryPtr Entry);
+	FReply OnClearClicked();
+
+	TArray<FString> GetSelectedPaths() const;
+	void SetSelectedPaths(const TArray<FString>& Paths);
+
+	static FString GetDisplayName(const FString& Path);
+
+	FName Key = NAME_None;
+	EMDMetaDataTypeKind Kind = EMDMetaDataTypeKind::Class;
+	FString BasePath;
+	bool bIsMulti = false;
+	TWeakPtr<FMDMetaDataTypeIndex> TypeIndex;
+	TAttribute<TOptional<FString>> MetaDataValue;
+	FOnRemoveMetaData OnRemoveMetaData;
+	FOnSetMetaData OnSetMetaData;
+
+	TSharedPtr<SComboButton> ComboButton;
+	TSharedPtr<SSearchBox> SearchBox;
+	TSharedPtr<SListView<FEntryPtr>> ListView;
+
+	FText SearchText;
+	TArray<FEntryPtr> AllEntries;
+	TArray<FEntryPtr> FilteredEntries;
+};
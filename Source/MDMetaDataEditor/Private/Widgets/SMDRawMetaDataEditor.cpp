@@ -0,0 +1,268 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "SMDRawMetaDataEditor.h"
+
+#include "DetailLayoutBuilder.h"
+#include "Styling/AppStyle.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SEditableTextBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+
+void SMDRawMetaDataEditor::Construct(const FArguments& InArgs)
+{
+	bIsReadOnly = InArgs._bIsReadOnly;
+	OnGetMetaDataMap = InArgs._OnGetMetaDataMap;
+	OnAddMetaData = InArgs._OnAddMetaData;
+	OnRemoveMetaData = InArgs._OnRemoveMetaData;
+	OnSetMetaData = InArgs._OnSetMetaData;
+	OnRenameMetaData = InArgs._OnRenameMetaData;
+
+	RefreshEntries();
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.f, 2.f)
+		[
+			SAssignNew(SearchBox, SSearchBox)
+			.HintText(INVTEXT("Search Meta Data"))
+			.OnTextChanged(this, &SMDRawMetaDataEditor::OnSearchTextChanged)
+		]
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SBox)
+			.MaxDesiredHeight(300.f)
+			[
+				SAssignNew(ListView, SListView<TSharedPtr<FMDRawMetaDataEntry>>)
+				.ListItemsSource(&FilteredEntries)
+				.SelectionMode(ESelectionMode::None)
+				.OnGenerateRow(this, &SMDRawMetaDataEditor::OnGenerateRow)
+			]
+		]
+		+SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0.f, 2.f)
+		[
+			SAssignNew(NewKeyTextBox, SEditableTextBox)
+			.Visibility(bIsReadOnly ? EVisibility::Collapsed : EVisibility::Visible)
+			.Font(IDetailLayoutBuilder::GetDetailFont())
+			.HintText(INVTEXT("New Meta Data entry..."))
+			.OnTextCommitted(this, &SMDRawMetaDataEditor::OnNewKeyCommitted)
+			.ClearKeyboardFocusOnCommit(false)
+		]
+	];
+}
+
+void SMDRawMetaDataEditor::RefreshEntries()
+{
+	AllEntries.Reset();
+
+	if (const TMap<FName, FString>* MetaDataMap = OnGetMetaDataMap.IsBound() ? OnGetMetaDataMap.Execute() : nullptr)
+	{
+		AllEntries.Reserve(MetaDataMap->Num());
+		for (const TPair<FName, FString>& MetaDataPair : *MetaDataMap)
+		{
+			TSharedPtr<FMDRawMetaDataEntry> Entry = MakeShared<FMDRawMetaDataEntry>();
+			Entry->Key = MetaDataPair.Key;
+			Entry->KeyText = FText::FromName(MetaDataPair.Key);
+			Entry->ValueText = FText::FromString(MetaDataPair.Value);
+			Entry->SearchString = FString::Printf(TEXT("%s=%s"), *MetaDataPair.Key.ToString(), *MetaDataPair.Value).ToLower();
+			AllEntries.Emplace(MoveTemp(Entry));
+		}
+	}
+
+	AllEntries.Sort([](const TSharedPtr<FMDRawMetaDataEntry>& A, const TSharedPtr<FMDRawMetaDataEntry>& B)
+	{
+		return A->Key.LexicalLess(B->Key);
+	});
+
+	ApplyFilter();
+}
+
+void SMDRawMetaDataEditor::RenameMetaData(const FName& OldKey, const FName& NewKey)
+{
+	if (OldKey != NewKey)
+	{
+		// Changing meta data can refresh the details panel that owns this widget
+		TSharedRef<SMDRawMetaDataEditor> PinnedThis = SharedThis(this);
+		OnRenameMetaData.ExecuteIfBound(OldKey, NewKey);
+		RefreshEntries();
+	}
+}
+
+void SMDRawMetaDataEditor::SetMetaData(const FName& Key, const FString& Value)
+{
+	TSharedRef<SMDRawMetaDataEditor> PinnedThis = SharedThis(this);
+	OnSetMetaData.ExecuteIfBound(Key, Value);
+	RefreshEntries();
+}
+
+void SMDRawMetaDataEditor::RemoveMetaData(const FName& Key)
+{
+	TSharedRef<SMDRawMetaDataEditor> PinnedThis = SharedThis(this);
+	OnRemoveMetaData.ExecuteIfBound(Key);
+	RefreshEntries();
+}
+
+TSharedRef<ITableRow> SMDRawMetaDataEditor::OnGenerateRow(TSharedPtr<FMDRawMetaDataEntry> Entry, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SMDRawMetaDataRow, OwnerTable, SharedThis(this))
+		.Entry(Entry);
+}
+
+void SMDRawMetaDataEditor::OnSearchTextChanged(const FText& InSearchText)
+{
+	SearchString = InSearchText.ToString().TrimStartAndEnd().ToLower();
+	ApplyFilter();
+}
+
+void SMDRawMetaDataEditor::ApplyFilter()
+{
+	FilteredEntries.Reset(AllEntries.Num());
+
+	if (SearchString.IsEmpty())
+	{
+		FilteredEntries = AllEntries;
+	}
+	else
+	{
+		for (const TSharedPtr<FMDRawMetaDataEntry>& Entry : AllEntries)
+		{
+			// Both strings are already lower case
+			if (Entry->SearchString.Contains(SearchString, ESearchCase::CaseSensitive))
+			{
+				FilteredEntries.Add(Entry);
+			}
+		}
+	}
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+void SMDRawMetaDataEditor::OnNewKeyCommitted(const FText& NewText, ETextCommit::Type InTextCommit)
+{
+	if (!NewText.IsEmptyOrWhitespace() && (InTextCommit == ETextCommit::OnEnter || InTextCommit == ETextCommit::OnUserMovedFocus))
+	{
+		TSharedRef<SMDRawMetaDataEditor> PinnedThis = SharedThis(this);
+		OnAddMetaData.ExecuteIfBound(*NewText.ToString().TrimStartAndEnd());
+		RefreshEntries();
+
+		if (NewKeyTextBox.IsValid())
+		{
+			NewKeyTextBox->SetText(FText::GetEmpty());
+		}
+	}
+}
+
+void SMDRawMetaDataRow::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable, const TSharedRef<SMDRawMetaDataEditor>& InEditor)
+{
+	EditorPtr = InEditor;
+	Entry = InArgs._Entry;
+
+	STableRow<TSharedPtr<FMDRawMetaDataEntry>>::Construct(
+		STableRow<TSharedPtr<FMDRawMetaDataEntry>>::FArguments()
+		.Padding(FMargin(0.f, 1.f))
+		.Content()
+		[
+			SNew(SHorizontalBox)
+			.IsEnabled(!InEditor->IsReadOnly())
+			+SHorizontalBox::Slot()
+			.FillWidth(0.4f)
+			.Padding(0.f, 0.f, 2.f, 0.f)
+			[
+				SNew(SEditableTextBox)
+				.Font(IDetailLayoutBuilder::GetDetailFont())
+				.Text(this, &SMDRawMetaDataRow::GetKeyText)
+				.OnTextCommitted(this, &SMDRawMetaDataRow::OnKeyCommitted)
+				.RevertTextOnEscape(true)
+			]
+			+SHorizontalBox::Slot()
+			.FillWidth(0.6f)
+			[
+				SNew(SEditableTextBox)
+				.Font(IDetailLayoutBuilder::GetDetailFont())
+				.Text(this, &SMDRawMetaDataRow::GetValueText)
+				.ToolTipText(this, &SMDRawMetaDataRow::GetValueText)
+				.OnTextCommitted(this, &SMDRawMetaDataRow::OnValueCommitted)
+				.RevertTextOnEscape(true)
+			]
+			+SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SButton)
+				.IsFocusable(false)
+				.ToolTipText(INVTEXT("Remove this meta data"))
+				.ButtonStyle(FAppStyle::Get(), "SimpleButton")
+				.ContentPadding(0)
+				.Visibility(this, &SMDRawMetaDataRow::GetRemoveButtonVisibility)
+				.OnClicked(this, &SMDRawMetaDataRow::OnRemoveClicked)
+				.Content()
+				[
+					SNew(SImage)
+					.Image(FAppStyle::GetBrush("Icons.X"))
+					.ColorAndOpacity(FSlateColor::UseForeground())
+				]
+			]
+		],
+		InOwnerTable);
+}
+
+FText SMDRawMetaDataRow::GetKeyText() const
+{
+	return Entry.IsValid() ? Entry->KeyText : FText::GetEmpty();
+}
+
+FText SMDRawMetaDataRow::GetValueText() const
+{
+	return Entry.IsValid() ? Entry->ValueText : FText::GetEmpty();
+}
+
+EVisibility SMDRawMetaDataRow::GetRemoveButtonVisibility() const
+{
+	const TSharedPtr<SMDRawMetaDataEditor> Editor = EditorPtr.Pin();
+	return (Editor.IsValid() && !Editor->IsReadOnly()) ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+void SMDRawMetaDataRow::OnKeyCommitted(const FText& NewText, ETextCommit::Type InTextCommit)
+{
+	const TSharedPtr<SMDRawMetaDataEditor> Editor = EditorPtr.Pin();
+	if (Editor.IsValid() && Entry.IsValid() && !NewText.IsEmptyOrWhitespace() && (InTextCommit == ETextCommit::OnEnter || InTextCommit == ETextCommit::OnUserMovedFocus))
+	{
+		const FName Key = Entry->Key;
+		Editor->RenameMetaData(Key, *NewText.ToString().TrimStartAndEnd());
+	}
+}
+
+void SMDRawMetaDataRow::OnValueCommitted(const FText& NewText, ETextCommit::Type InTextCommit)
+{
+	const TSharedPtr<SMDRawMetaDataEditor> Editor = EditorPtr.Pin();
+	if (Editor.IsValid() && Entry.IsValid() && (InTextCommit == ETextCommit::OnEnter || InTextCommit == ETextCommit::OnUserMovedFocus))
+	{
+		if (!NewText.EqualTo(Entry->ValueText))
+		{
+			const FName Key = Entry->Key;
+			Editor->SetMetaData(Key, NewText.ToString());
+		}
+	}
+}
+
+FReply SMDRawMetaDataRow::OnRemoveClicked()
+{
+	const TSharedPtr<SMDRawMetaDataEditor> Editor = EditorPtr.Pin();
+	if (Editor.IsValid() && Entry.IsValid())
+	{
+		const FName Key = Entry->Key;
+		Editor->RemoveMetaData(Key);
+	}
+
+	return FReply::Handled();
+}
@@ -0,0 +1,103 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SListView.h"
+#include "Widgets/Views/STableRow.h"
+
+class SEditableTextBox;
+class SSearchBox;
+
+struct FMDRawMetaDataEntry
+{
+	FName Key = NAME_None;
+	FText KeyText;
+	FText ValueText;
+
+	// Lower case "key=value", precomputed so filtering doesn't need to allocate
+	FString SearchString;
+};
+
+/**
+ * Virtualized key-value editor for all of a field's raw meta data
+ */
+class SMDRawMetaDataEditor : public SCompoundWidget
+{
+public:
+	DECLARE_DELEGATE_RetVal(const TMap<FName, FString>*, FOnGetMetaDataMap);
+	DECLARE_DELEGATE_OneParam(FOnAddMetaData, const FName&);
+	DECLARE_DELEGATE_OneParam(FOnRemoveMetaData, const FName&);
+	DECLARE_DELEGATE_TwoParams(FOnSetMetaData, const FName&, const FString& Value);
+	DECLARE_DELEGATE_TwoParams(FOnRenameMetaData, const FName& OldKey, const FName& NewKey);
+
+	SLATE_BEGIN_ARGS(SMDRawMetaDataEditor)
+	{}
+		SLATE_ARGUMENT_DEFAULT(bool, bIsReadOnly) = false;
+
+		SLATE_EVENT(FOnGetMetaDataMap, OnGetMetaDataMap);
+		SLATE_EVENT(FOnAddMetaData, OnAddMetaData);
+		SLATE_EVENT(FOnRemoveMetaData, OnRemoveMetaData);
+		SLATE_EVENT(FOnSetMetaData, OnSetMetaData);
+		SLATE_EVENT(FOnRenameMetaData, OnRenameMetaData);
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	// Rebuild the entries from the current meta data map
+	void RefreshEntries();
+
+	bool IsReadOnly() const { return bIsReadOnly; }
+
+	void RenameMetaData(const FName& OldKey, const FName& NewKey);
+	void SetMetaData(const FName& Key, const FString& Value);
+	void RemoveMetaData(const FName& Key);
+
+private:
+	TSharedRef<ITableRow> OnGenerateRow(TSharedPtr<FMDRawMetaDataEntry> Entry, const TSharedRef<STableViewBase>& OwnerTable);
+
+	void OnSearchTextChanged(const FText& InSearchText);
+	void ApplyFilter();
+
+	void OnNewKeyCommitted(const FText& NewText, ETextCommit::Type InTextCommit);
+
+	bool bIsReadOnly = false;
+
+	FOnGetMetaDataMap OnGetMetaDataMap;
+	FOnAddMetaData OnAddMetaData;
+	FOnRemoveMetaData OnRemoveMetaData;
+	FOnSetMetaData OnSetMetaData;
+	FOnRenameMetaData OnRenameMetaData;
+
+	FString SearchString;
+
+	TArray<TSharedPtr<FMDRawMetaDataEntry>> AllEntries;
+	TArray<TSharedPtr<FMDRawMetaDataEntry>> FilteredEntries;
+
+	TSharedPtr<SListView<TSharedPtr<FMDRawMetaDataEntry>>> ListView;
+	TSharedPtr<SSearchBox> SearchBox;
+	TSharedPtr<SEditableTextBox> NewKeyTextBox;
+};
+
+class SMDRawMetaDataRow : public STableRow<TSharedPtr<FMDRawMetaDataEntry>>
+{
+public:
+	SLATE_BEGIN_ARGS(SMDRawMetaDataRow)
+	{}
+		SLATE_ARGUMENT(TSharedPtr<FMDRawMetaDataEntry>, Entry)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable, const TSharedRef<SMDRawMetaDataEditor>& InEditor);
+
+private:
+	FText GetKeyText() const;
+	FText GetValueText() const;
+	EVisibility GetRemoveButtonVisibility() const;
+
+	void OnKeyCommitted(const FText& NewText, ETextCommit::Type InTextCommit);
+	void OnValueCommitted(const FText& NewText, ETextCommit::Type InTextCommit);
+	FReply OnRemoveClicked();
+
+	TSharedPtr<FMDRawMetaDataEntry> Entry;
+	TWeakPtr<SMDRawMetaDataEditor> EditorPtr;
+};
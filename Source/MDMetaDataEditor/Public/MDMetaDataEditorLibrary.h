@@ -0,0 +1,161 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Templates/UniquePtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+#include "MDMetaDataEditorLibrary.generated.h"
+
+class FScopedTransaction;
+class FMDMetaDataEditorFieldView;
+class UBlueprint;
+
+UENUM(BlueprintType)
+enum class EMDMetaDataFieldType : uint8
+{
+	// A member variable of a Blueprint
+	Variable,
+	// A local variable of a Blueprint function, FunctionName must be set
+	LocalVariable,
+	// An input or output of a Blueprint function or custom event, FunctionName must be set
+	FunctionParameter,
+	// A Blueprint function
+	Function,
+	// A Blueprint custom event
+	CustomEvent,
+	// A member of a User Defined Struct
+	StructMember,
+	// A User Defined Struct itself, FieldName is ignored
+	Struct
+};
+
+/**
+ * Identifies a field of a Blueprint or User Defined Struct that can have meta data
+ */
+USTRUCT(BlueprintType)
+struct FMDMetaDataFieldReference
+{
+	GENERATED_BODY()
+
+public:
+	// The Blueprint or User Defined Struct that owns the field
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meta Data Editor")
+	TObjectPtr<UObject> Asset = nullptr;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meta Data Editor")
+	EMDMetaDataFieldType FieldType = EMDMetaDataFieldType::Variable;
+
+	// The function or custom event that owns local variables and parameters
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meta Data Editor")
+	FName FunctionName = NAME_None;
+
+	// The name of the variable, parameter, function, custom event or struct member
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meta Data Editor")
+	FName FieldName = NAME_None;
+};
+
+UENUM(BlueprintType)
+enum class EMDMetaDataOperationType : uint8
+{
+	Set,
+	Remove,
+	Rename
+};
+
+USTRUCT(BlueprintType)
+struct FMDMetaDataOperation
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meta Data Editor")
+	FMDMetaDataFieldReference Field;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meta Data Editor")
+	EMDMetaDataOperationType Operation = EMDMetaDataOperationType::Set;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meta Data Editor")
+	FName Key = NAME_None;
+
+	// The value to set, only used by Set
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meta Data Editor")
+	FString Value;
+
+	// The key to rename to, only used by Rename
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Meta Data Editor")
+	FName NewKey = NAME_None;
+};
+
+/**
+ * Groups meta data changes into a single transaction.
+ * Modified Blueprints are only marked as modified (and optionally compiled) once the outermost scope ends.
+ */
+class MDMETADATAEDITOR_API FMDMetaDataEditorBatchScope
+{
+public:
+	explicit FMDMetaDataEditorBatchScope(const FText& Description, bool bCompileModifiedBlueprints = false);
+	~FMDMetaDataEditorBatchScope();
+
+	static bool IsActive() { return Depth > 0; }
+	static void AddModifiedBlueprint(UBlueprint* Blueprint);
+
+private:
+	TUniquePtr<FScopedTransaction> Transaction;
+
+	static int32 Depth;
+	static bool bCompileBlueprints;
+	static TArray<TWeakObjectPtr<UBlueprint>> ModifiedBlueprints;
+};
+
+/**
+ * Reads and writes the meta data of Blueprint and User Defined Struct fields, for use from scripts and tools
+ */
+UCLASS()
+class MDMETADATAEDITOR_API UMDMetaDataEditorLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	// Lists every field of a Blueprint or User Defined Struct that can have meta data
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static void GetMetaDataFields(UObject* Asset, TArray<FMDMetaDataFieldReference>& OutFields);
+
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static bool GetMetaData(const FMDMetaDataFieldReference& Field, FName Key, FString& OutValue);
+
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static bool GetAllMetaData(const FMDMetaDataFieldReference& Field, TMap<FName, FString>& OutMetaData);
+
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static bool SetMetaData(const FMDMetaDataFieldReference& Field, FName Key, const FString& Value);
+
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static bool RemoveMetaData(const FMDMetaDataFieldReference& Field, FName Key);
+
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static bool RenameMetaData(const FMDMetaDataFieldReference& Field, FName OldKey, FName NewKey);
+
+	// Applies all the operations under one transaction, each modified Blueprint is marked as modified once at the end. Returns the number of operations that were applied.
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static int32 ApplyMetaDataOperations(const TArray<FMDMetaDataOperation>& Operations, bool bCompileModifiedBlueprints = false);
+
+	// Sets the values of a preset from the Meta Data Editor settings on every field it can be used on, under one transaction. Returns the number of fields it was applied to.
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static int32 ApplyMetaDataPreset(const TArray<FMDMetaDataFieldReference>& Fields, FName PresetName);
+
+	// Writes the meta data of every Blueprint and User Defined Struct under the package paths (eg. /Game/Characters) to a file as C++ specifiers
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static bool ExportMetaDataAsCpp(const TArray<FString>& PackagePaths, const FString& FilePath);
+
+	// Lists the meta data that differs between two versions of a Blueprint or User Defined Struct, one line per changed key
+	UFUNCTION(BlueprintCallable, Category = "Meta Data Editor")
+	static void DiffMetaData(UObject* OldAsset, UObject* NewAsset, TArray<FString>& OutChanges);
+
+	// Returns null if the field can't be found in its asset
+	static TSharedPtr<FMDMetaDataEditorFieldView> MakeFieldView(const FMDMetaDataFieldReference& Field);
+
+private:
+	static bool ApplyOperation(const FMDMetaDataOperation& Operation);
+};
@@ -8,6 +8,14 @@ public class MDMetaDataEditorGraph : ModuleRules
     {
         PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
 
+        PublicDependencyModuleNames.AddRange(
+            new string[]
+            {
+                "Core",
+                "CoreUObject"
+            }
+        );
+
         PrivateDependencyModuleNames.AddRange(
             new string[]
             {
@@ -16,6 +24,8 @@ public class MDMetaDataEditorGraph : ModuleRules
                 "CoreUObject",
                 "Engine",
                 "Kismet",
+                "KismetCompiler",
+                "MDMetaDataRuntime",
                 "Slate",
                 "SlateCore",
                 "UnrealEd"
@@ -4,9 +4,41 @@
 
 #include "Engine/BlueprintGeneratedClass.h"
 #include "K2Node_FunctionEntry.h"
+#include "KismetCompiler.h"
+#include "MDEditConditionCache.h"
+#include "MDMetaDataCompilerHooks.h"
+#include "MDMetaDataChangeBus.h"
+#include "MDMetaDataRuntimeTable.h"
 
 namespace MDMDEBCE_Private
 {
+	const FName EditConditionKey = TEXT("EditCondition");
+
+	// Warns about EditConditions on member variables that won't work on instances of the class
+	void ValidateEditConditions(const FKismetCompilerContext& CompilationContext, const UBlueprint* Blueprint)
+	{
+		const UClass* Class = Blueprint->GeneratedClass;
+		if (!IsValid(Class))
+		{
+			return;
+		}
+
+		for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+		{
+			if (!Variable.HasMetaData(EditConditionKey))
+			{
+				continue;
+			}
+
+			const FString& Expression = Variable.GetMetaData(EditConditionKey);
+			const FMDEditConditionResult& Result = FMDEditConditionCache::Get().FindOrCompile(Class, Expression);
+			for (const FText& Error : Result.Errors)
+			{
+				CompilationContext.MessageLog.Warning(*FString::Printf(TEXT("EditCondition \"%s\" on variable %s: %s"), *Expression, *Variable.VarName.ToString(), *Error.ToString()));
+			}
+		}
+	}
+
 	FProperty* FindNodePropertyInClass(const UK2Node_FunctionEntry& FunctionNode, const FName& PropertyName, const UClass* Class)
 	{
 		const FName FunctionName = (FunctionNode.CustomGeneratedFunctionName != NAME_None)
@@ -30,10 +62,70 @@ namespace MDMDEBCE_Private
 		return nullptr;
 	}
 
+	// Publishes how the meta data of a compiled property differs from what the previous compile applied, compared in place so unchanged values aren't copied
+	void PublishPropertyChanges(const UBlueprint* Blueprint, FName ScopeName, const FProperty* OldProperty, const FProperty* NewProperty)
+	{
+		const TMap<FName, FString>* OldMetaData = (OldProperty != nullptr) ? OldProperty->GetMetaDataMap() : nullptr;
+		const TMap<FName, FString>* NewMetaData = (NewProperty != nullptr) ? NewProperty->GetMetaDataMap() : nullptr;
+		if (OldMetaData == nullptr && NewMetaData == nullptr)
+		{
+			return;
+		}
+
+		FMDMetaDataChangeTarget Target;
+		Target.Asset = const_cast<UBlueprint*>(Blueprint);
+		Target.ScopeName = ScopeName;
+		Target.FieldName = (NewProperty != nullptr) ? NewProperty->GetFName() : OldProperty->GetFName();
+
+		if (NewMetaData != nullptr)
+		{
+			for (const TPair<FName, FString>& MetaDataPair : *NewMetaData)
+			{
+				const FString* OldValue = (OldMetaData != nullptr) ? OldMetaData->Find(MetaDataPair.Key) : nullptr;
+				if (OldValue == nullptr || !OldValue->Equals(MetaDataPair.Value, ESearchCase::CaseSensitive))
+				{
+					TOptional<FMDMetaDataValue> OldPooledValue;
+					if (OldValue != nullptr)
+					{
+						OldPooledValue = FMDMetaDataValue(*OldValue);
+					}
+
+					FMDMetaDataChangeBus::Get().Publish(Target, MetaDataPair.Key, MoveTemp(OldPooledValue), FMDMetaDataValue(MetaDataPair.Value), EMDMetaDataChangeSource::Compiler);
+				}
+			}
+		}
+
+		if (OldMetaData != nullptr)
+		{
+			for (const TPair<FName, FString>& MetaDataPair : *OldMetaData)
+			{
+				if (NewMetaData == nullptr || !NewMetaData->Contains(MetaDataPair.Key))
+				{
+					FMDMetaDataChangeBus::Get().Publish(Target, MetaDataPair.Key, FMDMetaDataValue(MetaDataPair.Value), TOptional<FMDMetaDataValue>(), EMDMetaDataChangeSource::Compiler);
+				}
+			}
+		}
+	}
+
+	// Member variable meta data is applied by the engine, this only reports what it changed
+	void PublishVariableChanges(const UBlueprint* Blueprint, const UClass* OldClass)
+	{
+		const UClass* NewClass = Blueprint->GeneratedClass;
+		if (!IsValid(OldClass) || !IsValid(NewClass))
+		{
+			return;
+		}
+
+		for (const FBPVariableDescription& Variable : Blueprint->NewVariables)
+		{
+			PublishPropertyChanges(Blueprint, NAME_None, FindFProperty<FProperty>(OldClass, Variable.VarName), FindFProperty<FProperty>(NewClass, Variable.VarName));
+		}
+	}
+
 	// Inits meta data on function-related properties (params & variables) that the engine doesn't already support
 	void InitFunctionNodeMetaData(const UK2Node_FunctionEntry& FunctionNode, const UClass* OldClass, const UBlueprint* Blueprint)
 	{
-		auto InitFunctionMetaData = [&FunctionNode, &OldClass](const UFunction* Function)
+		auto InitFunctionMetaData = [&FunctionNode, &OldClass, Blueprint](const UFunction* Function, bool bPublishChanges)
 		{
 			if (!IsValid(Function))
 			{
@@ -74,17 +166,20 @@ namespace MDMDEBCE_Private
 				{
 					for (const FBPVariableDescription& Variable : FunctionNode.LocalVariables)
 					{
-						if (Variable.MetaDataArray.IsEmpty())
+						if (Prop->GetFName() != Variable.VarName)
 						{
 							continue;
 						}
 
-						if (Prop->GetFName() == Variable.VarName)
+						for (const FBPVariableMetaDataEntry& Entry : Variable.MetaDataArray)
+						{
+							Prop->SetMetaData(Entry.DataKey, *Entry.DataValue);
+						}
+
+						// Variables without meta data are still compared, the previous compile may have applied some
+						if (bPublishChanges && IsValid(OldClass))
 						{
-							for (const FBPVariableMetaDataEntry& Entry : Variable.MetaDataArray)
-							{
-								Prop->SetMetaData(Entry.DataKey, *Entry.DataValue);
-							}
+							PublishPropertyChanges(Blueprint, Function->GetFName(), FindNodePropertyInClass(FunctionNode, Prop->GetFName(), OldClass), Prop);
 						}
 					}
 				}
@@ -95,8 +190,18 @@ namespace MDMDEBCE_Private
 			? FunctionNode.CustomGeneratedFunctionName : FunctionNode.GetGraph()->GetFName();
 		const UFunction* Function = IsValid(Blueprint->GeneratedClass) ? Blueprint->GeneratedClass->FindFunctionByName(FunctionName) : nullptr;
 		const UFunction* SkeletonFunction = IsValid(Blueprint->SkeletonGeneratedClass) ? Blueprint->SkeletonGeneratedClass->FindFunctionByName(FunctionName) : nullptr;
-		InitFunctionMetaData(Function);
-		InitFunctionMetaData(SkeletonFunction);
+		InitFunctionMetaData(Function, true);
+		InitFunctionMetaData(SkeletonFunction, false);
+	}
+
+	// Copies the values of runtime keys on the class's variables and functions into a table that's saved with the class, since meta data is stripped from cooked builds
+	void BakeRuntimeMetaData(UClass* Class)
+	{
+		const FMDIsRuntimeMetaDataKey& IsRuntimeMetaDataKey = FMDMetaDataCompilerHooks::Get().IsRuntimeMetaDataKey;
+		UMDMetaDataRuntimeTable::BakeStruct(Class, [&IsRuntimeMetaDataKey](FName Key)
+		{
+			return IsRuntimeMetaDataKey.IsBound() && IsRuntimeMetaDataKey.Execute(Key);
+		});
 	}
 }
 
@@ -109,6 +214,10 @@ void UMDMetaDataEditorBlueprintCompilerExtension::ProcessBlueprintCompiled(const
 		return;
 	}
 
+	// The classes' properties have been recreated
+	FMDEditConditionCache::Get().Invalidate(CompilationContext.Blueprint->GeneratedClass);
+	FMDEditConditionCache::Get().Invalidate(CompilationContext.Blueprint->SkeletonGeneratedClass);
+
 	TArray<TObjectPtr<UEdGraph>> Graphs = CompilationContext.Blueprint->FunctionGraphs;
 	Graphs.Append(CompilationContext.Blueprint->EventGraphs);
 
@@ -125,4 +234,14 @@ void UMDMetaDataEditorBlueprintCompilerExtension::ProcessBlueprintCompiled(const
 			MDMDEBCE_Private::InitFunctionNodeMetaData(*FunctionNode, CompilationContext.OldClass, CompilationContext.Blueprint);
 		}
 	}
+
+	MDMDEBCE_Private::ValidateEditConditions(CompilationContext, CompilationContext.Blueprint);
+
+	if (CompilationContext.CompileOptions.CompileType != EKismetCompileType::SkeletonOnly)
+	{
+		MDMDEBCE_Private::PublishVariableChanges(CompilationContext.Blueprint, CompilationContext.OldClass);
+		MDMDEBCE_Private::BakeRuntimeMetaData(CompilationContext.Blueprint->GeneratedClass);
+	}
+
+	FMDMetaDataCompilerHooks::Get().OnValidateCompiledBlueprint.Broadcast(CompilationContext.Blueprint, CompilationContext.MessageLog);
 }
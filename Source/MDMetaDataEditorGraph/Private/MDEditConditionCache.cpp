@@ -0,0 +1,92 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDEditConditionCache.h"
+
+#include "UObject/UObjectGlobals.h"
+
+FMDEditConditionCache& FMDEditConditionCache::Get()
+{
+	static FMDEditConditionCache Instance;
+	return Instance;
+}
+
+const FMDEditConditionResult& FMDEditConditionCache::FindOrCompile(const UStruct* Owner, const FString& Expression)
+{
+	check(IsInGameThread());
+
+	// Expressions that were never cached aren't in the pool yet, so the lookup doesn't add them
+	const TOptional<FMDMetaDataValue> CachedExpression = FMDMetaDataValuePool::Get().Find(Expression);
+	if (CachedExpression.IsSet())
+	{
+		if (const FMDEditConditionResult* Result = Results.Find(TPair<TObjectKey<UStruct>, FMDMetaDataValue>(Owner, CachedExpression.GetValue())))
+		{
+			return *Result;
+		}
+	}
+
+	const FMDMetaDataValue PooledExpression = CachedExpression.IsSet() ? CachedExpression.GetValue() : FMDMetaDataValuePool::Get().Intern(Expression);
+	const TPair<TObjectKey<UStruct>, FMDMetaDataValue> ResultKey(Owner, PooledExpression);
+
+	const TSharedRef<const FMDEditConditionExpression>* ParsedExpression = ParsedExpressions.Find(PooledExpression);
+	if (ParsedExpression == nullptr)
+	{
+		ParsedExpression = &ParsedExpressions.Add(PooledExpression, MakeShared<FMDEditConditionExpression>(Expression));
+	}
+
+	if (!PostGarbageCollectHandle.IsValid())
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(this, &FMDEditConditionCache::RemoveStaleOwners);
+	}
+
+	FMDEditConditionResult& Result = Results.Add(ResultKey);
+	Result.Expression = *ParsedExpression;
+	Result.Errors = (*ParsedExpression)->Validate(Owner);
+	return Result;
+}
+
+void FMDEditConditionCache::Invalidate(const UStruct* Owner)
+{
+	const TObjectKey<UStruct> OwnerKey(Owner);
+	for (auto It = Results.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Key == OwnerKey)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	++Generation;
+}
+
+void FMDEditConditionCache::Invalidate(const UStruct* Owner, const FString& Expression)
+{
+	const TOptional<FMDMetaDataValue> CachedExpression = FMDMetaDataValuePool::Get().Find(Expression);
+	if (CachedExpression.IsSet() && Results.Remove(TPair<TObjectKey<UStruct>, FMDMetaDataValue>(Owner, CachedExpression.GetValue())) > 0)
+	{
+		++Generation;
+	}
+}
+
+void FMDEditConditionCache::Reset()
+{
+	if (PostGarbageCollectHandle.IsValid())
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		PostGarbageCollectHandle.Reset();
+	}
+
+	ParsedExpressions.Reset();
+	Results.Reset();
+	++Generation;
+}
+
+void FMDEditConditionCache::RemoveStaleOwners()
+{
+	for (auto It = Results.CreateIterator(); It; ++It)
+	{
+		if (It->Key.Key.ResolveObjectPtr() == nullptr)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -0,0 +1,436 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDEditConditionExpression.h"
+
+#include "Misc/Char.h"
+#include "UObject/EnumProperty.h"
+#include "UObject/UnrealType.h"
+
+struct FMDEditConditionExpression::FParser
+{
+	enum class ETokenType : uint8
+	{
+		Identifier,
+		Number,
+		Operator,
+		OpenParen,
+		CloseParen,
+		End
+	};
+
+	struct FToken
+	{
+		ETokenType Type = ETokenType::End;
+		FString Text;
+	};
+
+	explicit FParser(FMDEditConditionExpression& InExpression)
+		: Owner(InExpression)
+	{
+	}
+
+	void Parse()
+	{
+		if (!Tokenize())
+		{
+			return;
+		}
+
+		Owner.Root = ParseBinary(0);
+		if (Owner.Errors.Num() == 0 && Peek().Type != ETokenType::End)
+		{
+			AddError(FText::Format(INVTEXT("Unexpected '{0}'"), FText::FromString(Peek().Text)));
+		}
+	}
+
+private:
+	// Lowest to highest precedence
+	static const TArray<TArray<FString>>& GetBinaryOperators()
+	{
+		static const TArray<TArray<FString>> Operators = {
+			{ TEXT("||") },
+			{ TEXT("&&") },
+			{ TEXT("=="), TEXT("!=") },
+			{ TEXT("<"), TEXT(">"), TEXT("<="), TEXT(">=") },
+			{ TEXT("+"), TEXT("-") },
+			{ TEXT("*"), TEXT("/") }
+		};
+		return Operators;
+	}
+
+	bool Tokenize()
+	{
+		const FString& Text = Owner.Expression;
+		int32 Index = 0;
+		while (Index < Text.Len())
+		{
+			const TCHAR Char = Text[Index];
+			if (FChar::IsWhitespace(Char))
+			{
+				++Index;
+			}
+			else if (FChar::IsAlpha(Char) || Char == TEXT('_'))
+			{
+				// Identifiers may be qualified, as in EMyEnum::Value
+				const int32 Start = Index;
+				while (Index < Text.Len() && (FChar::IsAlnum(Text[Index]) || Text[Index] == TEXT('_') || (Text[Index] == TEXT(':') && Index + 1 < Text.Len() && Text[Index + 1] == TEXT(':'))))
+				{
+					Index += (Text[Index] == TEXT(':')) ? 2 : 1;
+				}
+				Tokens.Add(FToken{ ETokenType::Identifier, Text.Mid(Start, Index - Start) });
+			}
+			else if (FChar::IsDigit(Char) || (Char == TEXT('.') && Index + 1 < Text.Len() && FChar::IsDigit(Text[Index + 1])))
+			{
+				const int32 Start = Index;
+				while (Index < Text.Len() && (FChar::IsDigit(Text[Index]) || Text[Index] == TEXT('.')))
+				{
+					++Index;
+				}
+				// Allow float suffixes like 0.5f
+				if (Index < Text.Len() && (Text[Index] == TEXT('f') || Text[Index] == TEXT('F')))
+				{
+					++Index;
+				}
+				Tokens.Add(FToken{ ETokenType::Number, Text.Mid(Start, Index - Start) });
+			}
+			else if (Char == TEXT('('))
+			{
+				Tokens.Add(FToken{ ETokenType::OpenParen, TEXT("(") });
+				++Index;
+			}
+			else if (Char == TEXT(')'))
+			{
+				Tokens.Add(FToken{ ETokenType::CloseParen, TEXT(")") });
+				++Index;
+			}
+			else
+			{
+				static const TCHAR* const Operators[] = { TEXT("&&"), TEXT("||"), TEXT("=="), TEXT("!="), TEXT("<="), TEXT(">="), TEXT("<"), TEXT(">"), TEXT("!"), TEXT("+"), TEXT("-"), TEXT("*"), TEXT("/") };
+
+				const TCHAR* Match = nullptr;
+				for (const TCHAR* Operator : Operators)
+				{
+					if (FCString::Strncmp(*Text + Index, Operator, FCString::Strlen(Operator)) == 0)
+					{
+						Match = Operator;
+						break;
+					}
+				}
+
+				if (Match == nullptr)
+				{
+					AddError(FText::Format(INVTEXT("Unexpected character '{0}'"), FText::FromString(FString(1, &Char))));
+					return false;
+				}
+
+				Tokens.Add(FToken{ ETokenType::Operator, Match });
+				Index += FCString::Strlen(Match);
+			}
+		}
+
+		if (Tokens.Num() == 0)
+		{
+			AddError(INVTEXT("The expression is empty"));
+			return false;
+		}
+
+		return true;
+	}
+
+	const FToken& Peek() const
+	{
+		static const FToken EndToken;
+		return Tokens.IsValidIndex(Current) ? Tokens[Current] : EndToken;
+	}
+
+	int32 AddNode(FMDEditConditionNode&& Node)
+	{
+		return Owner.Nodes.Emplace(MoveTemp(Node));
+	}
+
+	void AddError(FText&& Error)
+	{
+		Owner.Errors.Emplace(MoveTemp(Error));
+	}
+
+	int32 ParseBinary(int32 Precedence)
+	{
+		if (!GetBinaryOperators().IsValidIndex(Precedence))
+		{
+			return ParseUnary();
+		}
+
+		int32 Lhs = ParseBinary(Precedence + 1);
+		while (Owner.Errors.Num() == 0 && Peek().Type == ETokenType::Operator && GetBinaryOperators()[Precedence].Contains(Peek().Text))
+		{
+			FMDEditConditionNode Node;
+			Node.Type = EMDEditConditionNodeType::Binary;
+			Node.Text = Tokens[Current++].Text;
+			Node.Lhs = Lhs;
+			Node.Rhs = ParseBinary(Precedence + 1);
+			Lhs = AddNode(MoveTemp(Node));
+		}
+
+		return Lhs;
+	}
+
+	int32 ParseUnary()
+	{
+		if (Peek().Type == ETokenType::Operator && (Peek().Text == TEXT("!") || Peek().Text == TEXT("-")))
+		{
+			FMDEditConditionNode Node;
+			Node.Type = (Tokens[Current++].Text == TEXT("!")) ? EMDEditConditionNodeType::Not : EMDEditConditionNodeType::Negate;
+			Node.Lhs = ParseUnary();
+			return AddNode(MoveTemp(Node));
+		}
+
+		return ParsePrimary();
+	}
+
+	int32 ParsePrimary()
+	{
+		const FToken& Token = Peek();
+		switch (Token.Type)
+		{
+		case ETokenType::OpenParen:
+		{
+			++Current;
+			const int32 Inner = ParseBinary(0);
+			if (Owner.Errors.Num() == 0 && Peek().Type != ETokenType::CloseParen)
+			{
+				AddError(INVTEXT("Missing ')'"));
+			}
+			++Current;
+			return Inner;
+		}
+		case ETokenType::Number:
+		{
+			FMDEditConditionNode Node;
+			Node.Type = EMDEditConditionNodeType::Number;
+			Node.Text = Token.Text;
+			LexFromString(Node.Number, *Token.Text.Replace(TEXT("f"), TEXT(""), ESearchCase::IgnoreCase));
+			++Current;
+			return AddNode(MoveTemp(Node));
+		}
+		case ETokenType::Identifier:
+		{
+			FMDEditConditionNode Node;
+			Node.Text = Token.Text;
+			if (Token.Text.Equals(TEXT("true"), ESearchCase::IgnoreCase) || Token.Text.Equals(TEXT("false"), ESearchCase::IgnoreCase))
+			{
+				Node.Type = EMDEditConditionNodeType::Bool;
+				Node.bBool = Token.Text.Equals(TEXT("true"), ESearchCase::IgnoreCase);
+			}
+			else if (Token.Text == TEXT("nullptr"))
+			{
+				Node.Type = EMDEditConditionNodeType::Null;
+			}
+			else
+			{
+				Node.Type = Token.Text.Contains(TEXT("::")) ? EMDEditConditionNodeType::EnumValue : EMDEditConditionNodeType::Identifier;
+			}
+			++Current;
+			return AddNode(MoveTemp(Node));
+		}
+		case ETokenType::End:
+			AddError(INVTEXT("Unexpected end of expression"));
+			return INDEX_NONE;
+		default:
+			AddError(FText::Format(INVTEXT("Unexpected '{0}'"), FText::FromString(Token.Text)));
+			++Current;
+			return INDEX_NONE;
+		}
+	}
+
+	FMDEditConditionExpression& Owner;
+	TArray<FToken> Tokens;
+	int32 Current = 0;
+};
+
+namespace MDMDECE_Private
+{
+	bool DoesEnumHaveValue(const UEnum* Enum, const FString& EnumValue)
+	{
+		FString EnumName;
+		FString ValueName;
+		if (!EnumValue.Split(TEXT("::"), &EnumName, &ValueName, ESearchCase::CaseSensitive, ESearchDir::FromEnd))
+		{
+			return false;
+		}
+
+		if (Enum->GetIndexByNameString(ValueName) != INDEX_NONE || Enum->GetIndexByNameString(EnumValue) != INDEX_NONE)
+		{
+			return true;
+		}
+
+		// User Defined Enum values are referenced by their display names
+		for (int32 i = 0; i < Enum->NumEnums(); ++i)
+		{
+			if (Enum->GetDisplayNameTextByIndex(i).ToString() == ValueName)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+}
+
+FMDEditConditionExpression::FMDEditConditionExpression(const FString& InExpression)
+	: Expression(InExpression)
+{
+	FParser(*this).Parse();
+}
+
+TArray<FText> FMDEditConditionExpression::Validate(const UStruct* Owner) const
+{
+	TArray<FText> OutErrors = Errors;
+	if (OutErrors.Num() > 0 || !Nodes.IsValidIndex(Root))
+	{
+		return OutErrors;
+	}
+
+	const FValueType RootType = ValidateNode(Root, Owner, OutErrors);
+	if (RootType.Type != EValueType::Invalid && RootType.Type != EValueType::Bool)
+	{
+		OutErrors.Add(INVTEXT("The expression must evaluate to a bool"));
+	}
+
+	return OutErrors;
+}
+
+FMDEditConditionExpression::FValueType FMDEditConditionExpression::ValidateNode(int32 NodeIndex, const UStruct* Owner, TArray<FText>& OutErrors) const
+{
+	if (!Nodes.IsValidIndex(NodeIndex))
+	{
+		return {};
+	}
+
+	const FMDEditConditionNode& Node = Nodes[NodeIndex];
+	switch (Node.Type)
+	{
+	case EMDEditConditionNodeType::Bool:
+		return { EValueType::Bool };
+	case EMDEditConditionNodeType::Number:
+		return { EValueType::Number };
+	case EMDEditConditionNodeType::Null:
+		return { EValueType::Null };
+	case EMDEditConditionNodeType::EnumValue:
+		// Checked against the enum it's compared with
+		return { EValueType::Enum };
+	case EMDEditConditionNodeType::Identifier:
+	{
+		const FProperty* Property = (Owner != nullptr) ? FindFProperty<FProperty>(Owner, *Node.Text) : nullptr;
+		if (Property == nullptr)
+		{
+			OutErrors.Add(FText::Format(INVTEXT("Unknown property '{0}'"), FText::FromString(Node.Text)));
+			return {};
+		}
+
+		if (Property->IsA<FBoolProperty>())
+		{
+			return { EValueType::Bool };
+		}
+		if (const FEnumProperty* EnumProperty = CastField<FEnumProperty>(Property))
+		{
+			return { EValueType::Enum, EnumProperty->GetEnum() };
+		}
+		if (const FByteProperty* ByteProperty = CastField<FByteProperty>(Property))
+		{
+			if (ByteProperty->Enum != nullptr)
+			{
+				return { EValueType::Enum, ByteProperty->Enum };
+			}
+		}
+		if (Property->IsA<FNumericProperty>())
+		{
+			return { EValueType::Number };
+		}
+		if (Property->IsA<FObjectPropertyBase>())
+		{
+			return { EValueType::Object };
+		}
+
+		OutErrors.Add(FText::Format(INVTEXT("'{0}' is a {1} property, EditConditions only support bool, enum, numeric and object properties"), FText::FromString(Node.Text), FText::FromString(Property->GetCPPType())));
+		return {};
+	}
+	case EMDEditConditionNodeType::Not:
+	{
+		const FValueType Operand = ValidateNode(Node.Lhs, Owner, OutErrors);
+		if (Operand.Type != EValueType::Invalid && Operand.Type != EValueType::Bool)
+		{
+			OutErrors.Add(INVTEXT("'!' can only be used on bools"));
+			return {};
+		}
+		return { EValueType::Bool };
+	}
+	case EMDEditConditionNodeType::Negate:
+	{
+		const FValueType Operand = ValidateNode(Node.Lhs, Owner, OutErrors);
+		if (Operand.Type != EValueType::Invalid && Operand.Type != EValueType::Number)
+		{
+			OutErrors.Add(INVTEXT("'-' can only be used on numbers"));
+			return {};
+		}
+		return { EValueType::Number };
+	}
+	case EMDEditConditionNodeType::Binary:
+	{
+		const FValueType Lhs = ValidateNode(Node.Lhs, Owner, OutErrors);
+		const FValueType Rhs = ValidateNode(Node.Rhs, Owner, OutErrors);
+		if (Lhs.Type == EValueType::Invalid || Rhs.Type == EValueType::Invalid)
+		{
+			return {};
+		}
+
+		const FText Operator = FText::FromString(Node.Text);
+		if (Node.Text == TEXT("&&") || Node.Text == TEXT("||"))
+		{
+			if (Lhs.Type != EValueType::Bool || Rhs.Type != EValueType::Bool)
+			{
+				OutErrors.Add(FText::Format(INVTEXT("'{0}' can only be used on bools"), Operator));
+				return {};
+			}
+			return { EValueType::Bool };
+		}
+
+		if (Node.Text == TEXT("==") || Node.Text == TEXT("!="))
+		{
+			const bool bIsObjectCompare = (Lhs.Type == EValueType::Object || Lhs.Type == EValueType::Null) && (Rhs.Type == EValueType::Object || Rhs.Type == EValueType::Null);
+			if (Lhs.Type != Rhs.Type && !bIsObjectCompare)
+			{
+				OutErrors.Add(FText::Format(INVTEXT("Can't compare different types with '{0}'"), Operator));
+				return {};
+			}
+
+			if (Lhs.Type == EValueType::Enum)
+			{
+				// One side should be the property, the other the enum value
+				const UEnum* Enum = (Lhs.Enum != nullptr) ? Lhs.Enum : Rhs.Enum;
+				const FMDEditConditionNode& ValueNode = Nodes[(Lhs.Enum != nullptr) ? Node.Rhs : Node.Lhs];
+				if (Enum == nullptr)
+				{
+					OutErrors.Add(FText::Format(INVTEXT("'{0}' needs an enum property on one side"), Operator));
+				}
+				else if (ValueNode.Type == EMDEditConditionNodeType::EnumValue && !MDMDECE_Private::DoesEnumHaveValue(Enum, ValueNode.Text))
+				{
+					OutErrors.Add(FText::Format(INVTEXT("'{0}' is not a value of {1}"), FText::FromString(ValueNode.Text), FText::FromString(Enum->GetName())));
+				}
+			}
+
+			return { EValueType::Bool };
+		}
+
+		if (Lhs.Type != EValueType::Number || Rhs.Type != EValueType::Number)
+		{
+			OutErrors.Add(FText::Format(INVTEXT("'{0}' can only be used on numbers"), Operator));
+			return {};
+		}
+
+		const bool bIsComparison = Node.Text == TEXT("<") || Node.Text == TEXT(">") || Node.Text == TEXT("<=") || Node.Text == TEXT(">=");
+		return { bIsComparison ? EValueType::Bool : EValueType::Number };
+	}
+	default:
+		return {};
+	}
+}
@@ -0,0 +1,209 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataChangeBus.h"
+
+FMDMetaDataChangeBus& FMDMetaDataChangeBus::Get()
+{
+	static FMDMetaDataChangeBus Instance;
+	return Instance;
+}
+
+void FMDMetaDataChangeBus::Publish(FMDMetaDataChangeRecord&& Record)
+{
+	check(IsInGameThread());
+
+	const TPair<FMDMetaDataChangeTarget, FName> RecordKey = { Record.Target, Record.Key };
+	if (!Record.RenamedFrom.IsNone())
+	{
+		const TPair<FMDMetaDataChangeTarget, FName> OldRecordKey = { Record.Target, Record.RenamedFrom };
+		int32 OldKeyRecordIndex = INDEX_NONE;
+		if (PendingRecordIndices.RemoveAndCopyValue(OldRecordKey, OldKeyRecordIndex))
+		{
+			// The old key already changed this frame, so the rename starts from what it was before that.
+			// Its own record is emptied out, it's dropped when the batch is delivered.
+			FMDMetaDataChangeRecord& OldKeyRecord = PendingRecords[OldKeyRecordIndex];
+			Record.OldValue = MoveTemp(OldKeyRecord.OldValue);
+			Record.RenamedFrom = OldKeyRecord.RenamedFrom;
+			OldKeyRecord.OldValue.Reset();
+			OldKeyRecord.NewValue.Reset();
+			OldKeyRecord.RenamedFrom = NAME_None;
+
+			if (!Record.OldValue.IsSet())
+			{
+				// The old key was added this frame, so this is just the new key being added
+				Record.RenamedFrom = NAME_None;
+			}
+		}
+
+		int32 NewKeyRecordIndex = INDEX_NONE;
+		TOptional<FMDMetaDataValue> NewKeyOriginalValue;
+		if (PendingRecordIndices.RemoveAndCopyValue(RecordKey, NewKeyRecordIndex))
+		{
+			// The new key already changed this frame, its record is emptied out and folded into this one
+			FMDMetaDataChangeRecord& NewKeyRecord = PendingRecords[NewKeyRecordIndex];
+			const FName NewKeyRenamedFrom = NewKeyRecord.RenamedFrom;
+			TOptional<FMDMetaDataValue> NewKeyOldValue = MoveTemp(NewKeyRecord.OldValue);
+			NewKeyRecord.OldValue.Reset();
+			NewKeyRecord.NewValue.Reset();
+			NewKeyRecord.RenamedFrom = NAME_None;
+
+			if (NewKeyRenamedFrom.IsNone())
+			{
+				NewKeyOriginalValue = MoveTemp(NewKeyOldValue);
+			}
+			else
+			{
+				// The value that was moved to the new key is being overwritten, so the key it came from was just removed
+				AddRemoval(Record.Target, NewKeyRenamedFrom, MoveTemp(NewKeyOldValue), Record.Source);
+			}
+		}
+
+		if (NewKeyOriginalValue.IsSet() && !Record.RenamedFrom.IsNone())
+		{
+			// The new key existed before this frame, so the old key's value replaced it rather than being renamed
+			AddRemoval(Record.Target, Record.RenamedFrom, MoveTemp(Record.OldValue), Record.Source);
+			Record.RenamedFrom = NAME_None;
+		}
+
+		if (Record.RenamedFrom.IsNone())
+		{
+			Record.OldValue = MoveTemp(NewKeyOriginalValue);
+		}
+
+		PendingRecordIndices.Add(RecordKey, PendingRecords.Num());
+		PendingRecords.Emplace(MoveTemp(Record));
+	}
+	else if (const int32* RecordIndex = PendingRecordIndices.Find(RecordKey))
+	{
+		// Keep the value from before the first change this frame
+		FMDMetaDataChangeRecord& PendingRecord = PendingRecords[*RecordIndex];
+		PendingRecord.NewValue = MoveTemp(Record.NewValue);
+		PendingRecord.Source = Record.Source;
+	}
+	else
+	{
+		PendingRecordIndices.Add(RecordKey, PendingRecords.Num());
+		PendingRecords.Emplace(MoveTemp(Record));
+	}
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FMDMetaDataChangeBus::Tick));
+	}
+}
+
+void FMDMetaDataChangeBus::Publish(const FMDMetaDataChangeTarget& Target, FName Key, TOptional<FMDMetaDataValue> OldValue, TOptional<FMDMetaDataValue> NewValue, EMDMetaDataChangeSource Source)
+{
+	FMDMetaDataChangeRecord Record;
+	Record.Target = Target;
+	Record.Key = Key;
+	Record.OldValue = MoveTemp(OldValue);
+	Record.NewValue = MoveTemp(NewValue);
+	Record.Source = Source;
+	Publish(MoveTemp(Record));
+}
+
+void FMDMetaDataChangeBus::PublishRename(const FMDMetaDataChangeTarget& Target, FName OldKey, FName NewKey, FMDMetaDataValue OldValue, FMDMetaDataValue NewValue, EMDMetaDataChangeSource Source)
+{
+	FMDMetaDataChangeRecord Record;
+	Record.Target = Target;
+	Record.Key = NewKey;
+	Record.RenamedFrom = OldKey;
+	Record.OldValue = MoveTemp(OldValue);
+	Record.NewValue = MoveTemp(NewValue);
+	Record.Source = Source;
+	Publish(MoveTemp(Record));
+}
+
+void FMDMetaDataChangeBus::AddRemoval(const FMDMetaDataChangeTarget& Target, FName Key, TOptional<FMDMetaDataValue> OriginalValue, EMDMetaDataChangeSource Source)
+{
+	if (!OriginalValue.IsSet())
+	{
+		return;
+	}
+
+	if (const int32* RecordIndex = PendingRecordIndices.Find({ Target, Key }))
+	{
+		const int32 KeyRecordIndex = *RecordIndex;
+		FMDMetaDataChangeRecord& KeyRecord = PendingRecords[KeyRecordIndex];
+		if (KeyRecord.RenamedFrom.IsNone())
+		{
+			// The key was added again after its value moved away, so it was changed instead
+			KeyRecord.OldValue = MoveTemp(OriginalValue);
+			return;
+		}
+
+		// Another key was renamed onto this one after its value moved away, so that key was removed and this one was changed
+		const FName RenamedFrom = KeyRecord.RenamedFrom;
+		TOptional<FMDMetaDataValue> RenamedValue = MoveTemp(KeyRecord.OldValue);
+		KeyRecord.OldValue = MoveTemp(OriginalValue);
+		KeyRecord.RenamedFrom = NAME_None;
+		AddRemoval(Target, RenamedFrom, MoveTemp(RenamedValue), Source);
+		return;
+	}
+
+	FMDMetaDataChangeRecord Record;
+	Record.Target = Target;
+	Record.Key = Key;
+	Record.OldValue = MoveTemp(OriginalValue);
+	Record.Source = Source;
+	PendingRecordIndices.Add({ Target, Key }, PendingRecords.Num());
+	PendingRecords.Emplace(MoveTemp(Record));
+}
+
+void FMDMetaDataChangeBus::Flush()
+{
+	check(IsInGameThread());
+
+	TArray<FMDMetaDataChangeRecord> Records = MoveTemp(PendingRecords);
+	PendingRecords.Reset();
+	PendingRecordIndices.Reset();
+
+	for (FMDMetaDataChangeRecord& Record : Records)
+	{
+		// A key that was renamed and then removed is just removed, and one that was renamed back was never renamed
+		if (!Record.RenamedFrom.IsNone() && !Record.NewValue.IsSet())
+		{
+			Record.Key = Record.RenamedFrom;
+			Record.RenamedFrom = NAME_None;
+		}
+		else if (Record.RenamedFrom == Record.Key)
+		{
+			Record.RenamedFrom = NAME_None;
+		}
+	}
+
+	// Changes that were reverted within the frame aren't changes
+	Records.RemoveAll([](const FMDMetaDataChangeRecord& Record)
+	{
+		return Record.RenamedFrom.IsNone() && Record.OldValue == Record.NewValue;
+	});
+
+	// Subscribers may publish more changes, those go out in the next batch
+	if (!Records.IsEmpty())
+	{
+		OnMetaDataChanged.Broadcast(Records);
+	}
+}
+
+void FMDMetaDataChangeBus::Reset()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+
+	PendingRecords.Reset();
+	PendingRecordIndices.Reset();
+	OnMetaDataChanged.Clear();
+}
+
+bool FMDMetaDataChangeBus::Tick(float DeltaTime)
+{
+	TickerHandle.Reset();
+	Flush();
+
+	// Returning false removes the ticker, it's added again when the next change is published
+	return false;
+}
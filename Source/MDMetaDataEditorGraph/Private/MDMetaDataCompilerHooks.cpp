@@ -0,0 +1,9 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataCompilerHooks.h"
+
+FMDMetaDataCompilerHooks& FMDMetaDataCompilerHooks::Get()
+{
+	static FMDMetaDataCompilerHooks Instance;
+	return Instance;
+}
@@ -2,6 +2,9 @@
 
 #include "BlueprintCompilationManager.h"
 #include "Extensions/MDMetaDataEditorBlueprintCompilerExtension.h"
+#include "MDEditConditionCache.h"
+#include "MDMetaDataCompilerHooks.h"
+#include "MDMetaDataChangeBus.h"
 #include "Modules/ModuleManager.h"
 
 
@@ -18,6 +21,11 @@ public:
 
 	virtual void ShutdownModule() override
 	{
+		FMDMetaDataChangeBus::Get().Reset();
+		FMDEditConditionCache::Get().Reset();
+		FMDMetaDataCompilerHooks::Get().OnValidateCompiledBlueprint.Clear();
+		FMDMetaDataCompilerHooks::Get().IsRuntimeMetaDataKey.Unbind();
+
 		if (UMDMetaDataEditorBlueprintCompilerExtension* CompilerExtension = CompilerExtensionPtr.Get())
 		{
 			CompilerExtension->RemoveFromRoot();
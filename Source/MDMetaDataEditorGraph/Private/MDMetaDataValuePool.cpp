@@ -0,0 +1,187 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataValuePool.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+
+namespace MDMDVP_Private
+{
+	SIZE_T GetStringBytes(const FString& Value)
+	{
+		return sizeof(FString) + Value.GetAllocatedSize();
+	}
+
+	FAutoConsoleCommandWithOutputDevice ReportCommand(
+		TEXT("MDMetaData.ReportValuePool"),
+		TEXT("Prints how much memory the Meta Data Editor saves by interning the meta data values held by its caches"),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Ar)
+		{
+			const FMDMetaDataValuePoolStats Stats = FMDMetaDataValuePool::Get().GetStats();
+			Ar.Logf(TEXT("Meta data value pool: %d distinct values, %llu references"), Stats.NumValues, Stats.NumReferences);
+			Ar.Logf(TEXT("  Pooled: %.1f KiB, unpooled: %.1f KiB, saved: %.1f KiB"), Stats.PoolBytes / 1024.0, Stats.UnpooledBytes / 1024.0, Stats.GetBytesSaved() / 1024.0);
+		})
+	);
+}
+
+const FString FMDMetaDataValue::EmptyString;
+
+FMDMetaDataValue::FMDMetaDataValue(FStringView InValue)
+	: FMDMetaDataValue(FMDMetaDataValuePool::Get().Intern(InValue))
+{
+}
+
+FMDMetaDataValue::FMDMetaDataValue(const FMDMetaDataValue& Other)
+	: Value(Other.Value)
+{
+	// Other holds a reference, so the value can't be waiting to be removed
+	if (Value != nullptr)
+	{
+		Value->NumReferences.fetch_add(1);
+	}
+}
+
+FMDMetaDataValue::FMDMetaDataValue(FMDMetaDataValue&& Other)
+	: Value(Other.Value)
+{
+	Other.Value = nullptr;
+}
+
+FMDMetaDataValue::~FMDMetaDataValue()
+{
+	if (Value != nullptr)
+	{
+		FMDMetaDataValuePool::Get().ReleaseReference(*Value);
+	}
+}
+
+FMDMetaDataValue& FMDMetaDataValue::operator=(const FMDMetaDataValue& Other)
+{
+	FMDMetaDataValue Copy(Other);
+	Swap(Value, Copy.Value);
+	return *this;
+}
+
+FMDMetaDataValue& FMDMetaDataValue::operator=(FMDMetaDataValue&& Other)
+{
+	Swap(Value, Other.Value);
+	return *this;
+}
+
+FMDMetaDataValuePool& FMDMetaDataValuePool::Get()
+{
+	// Never destroyed, so handles held by other statics can still be released during shutdown
+	static FMDMetaDataValuePool* Instance = new FMDMetaDataValuePool();
+	return *Instance;
+}
+
+FMDMetaDataValue FMDMetaDataValuePool::Intern(FStringView Value)
+{
+	if (Value.IsEmpty())
+	{
+		return FMDMetaDataValue();
+	}
+
+	{
+		FReadScopeLock ReadLock(Lock);
+		FMDMetaDataPooledValue* const* PooledValue = ValueSet.Find(Value);
+		if (PooledValue != nullptr && TryAddReference(**PooledValue))
+		{
+			return FMDMetaDataValue(*PooledValue);
+		}
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+
+	// Another thread may have added it between the locks, or its last handle may be gone without it having been removed yet.
+	// Nothing is removed while the write lock is held, so either way it can be used again.
+	if (FMDMetaDataPooledValue* const* PooledValue = ValueSet.Find(Value))
+	{
+		(*PooledValue)->NumReferences.fetch_add(1);
+		return FMDMetaDataValue(*PooledValue);
+	}
+
+	FMDMetaDataPooledValue* PooledValue = FreeValues.IsEmpty() ? &Values[Values.Add()] : FreeValues.Pop();
+	PooledValue->Value = FString(Value);
+	PooledValue->NumReferences.store(1);
+	PooledValue->bIsPooled = true;
+	ValueSet.Add(PooledValue);
+	return FMDMetaDataValue(PooledValue);
+}
+
+void FMDMetaDataValuePool::InternMap(const TMap<FName, FString>& MetaData, TMap<FName, FMDMetaDataValue>& OutMetaData)
+{
+	OutMetaData.Reserve(OutMetaData.Num() + MetaData.Num());
+	for (const TPair<FName, FString>& MetaDataPair : MetaData)
+	{
+		OutMetaData.Add(MetaDataPair.Key, Intern(MetaDataPair.Value));
+	}
+}
+
+TOptional<FMDMetaDataValue> FMDMetaDataValuePool::Find(FStringView Value) const
+{
+	if (Value.IsEmpty())
+	{
+		return FMDMetaDataValue();
+	}
+
+	FReadScopeLock ReadLock(Lock);
+	FMDMetaDataPooledValue* const* PooledValue = ValueSet.Find(Value);
+	if (PooledValue != nullptr && TryAddReference(**PooledValue))
+	{
+		return FMDMetaDataValue(*PooledValue);
+	}
+
+	return TOptional<FMDMetaDataValue>();
+}
+
+FMDMetaDataValuePoolStats FMDMetaDataValuePool::GetStats() const
+{
+	FReadScopeLock ReadLock(Lock);
+
+	FMDMetaDataValuePoolStats Stats;
+	Stats.NumValues = ValueSet.Num();
+	Stats.PoolBytes = Values.GetAllocatedSize() + FreeValues.GetAllocatedSize() + ValueSet.GetAllocatedSize();
+	for (const FMDMetaDataPooledValue* PooledValue : ValueSet)
+	{
+		const uint64 NumReferences = FMath::Max(PooledValue->NumReferences.load(), 0);
+		Stats.NumReferences += NumReferences;
+		Stats.PoolBytes += PooledValue->Value.GetAllocatedSize() + NumReferences * sizeof(FMDMetaDataValue);
+		Stats.UnpooledBytes += NumReferences * MDMDVP_Private::GetStringBytes(PooledValue->Value);
+	}
+
+	return Stats;
+}
+
+bool FMDMetaDataValuePool::TryAddReference(FMDMetaDataPooledValue& Value)
+{
+	int32 NumReferences = Value.NumReferences.load();
+	while (NumReferences > 0)
+	{
+		if (Value.NumReferences.compare_exchange_weak(NumReferences, NumReferences + 1))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FMDMetaDataValuePool::ReleaseReference(FMDMetaDataPooledValue& Value)
+{
+	if (Value.NumReferences.fetch_sub(1) != 1)
+	{
+		return;
+	}
+
+	FWriteScopeLock WriteLock(Lock);
+
+	// The value may have been interned again before the lock was taken, or removed by a release that raced this one
+	if (Value.bIsPooled && Value.NumReferences.load() == 0)
+	{
+		ValueSet.Remove(FStringView(Value.Value));
+		Value.bIsPooled = false;
+		Value.Value.Empty();
+		FreeValues.Add(&Value);
+	}
+}
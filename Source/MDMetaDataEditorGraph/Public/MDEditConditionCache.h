@@ -0,0 +1,52 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "MDEditConditionExpression.h"
+#include "MDMetaDataValuePool.h"
+#include "Delegates/IDelegateInstance.h"
+#include "Templates/SharedPointer.h"
+#include "UObject/ObjectKey.h"
+
+struct FMDEditConditionResult
+{
+	TSharedPtr<const FMDEditConditionExpression> Expression;
+
+	// Syntax errors and errors from resolving the properties against the owner
+	TArray<FText> Errors;
+
+	bool IsValid() const { return Errors.Num() == 0; }
+};
+
+/**
+ * Caches parsed EditConditions by expression and their validation results by (owner, expression),
+ * so the same condition repeated across many properties is only parsed and resolved once.
+ * Must only be used from the game thread.
+ */
+class MDMETADATAEDITORGRAPH_API FMDEditConditionCache
+{
+public:
+	static FMDEditConditionCache& Get();
+
+	const FMDEditConditionResult& FindOrCompile(const UStruct* Owner, const FString& Expression);
+
+	// Call when the owner's properties may have changed (it was compiled or its properties were edited)
+	void Invalidate(const UStruct* Owner);
+	// Call when only the properties named by the expression may have changed
+	void Invalidate(const UStruct* Owner, const FString& Expression);
+	void Reset();
+
+	// Changes whenever a result is invalidated, so callers holding onto a result know to look it up again
+	uint32 GetGeneration() const { return Generation; }
+
+private:
+	// Drops the results of owners that have been garbage collected
+	void RemoveStaleOwners();
+
+	FDelegateHandle PostGarbageCollectHandle;
+	uint32 Generation = 0;
+
+	// Keyed by pooled expressions, so each expression string is stored once no matter how many owners use it
+	TMap<FMDMetaDataValue, TSharedRef<const FMDEditConditionExpression>> ParsedExpressions;
+	TMap<TPair<TObjectKey<UStruct>, FMDMetaDataValue>, FMDEditConditionResult> Results;
+};
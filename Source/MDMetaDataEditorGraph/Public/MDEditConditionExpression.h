@@ -0,0 +1,84 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/Array.h"
+#include "Containers/UnrealString.h"
+#include "Internationalization/Text.h"
+
+class UEnum;
+class UStruct;
+
+enum class EMDEditConditionNodeType : uint8
+{
+	Bool,
+	Number,
+	Null,
+	// A property of the owning struct
+	Identifier,
+	// EMyEnum::Value
+	EnumValue,
+	Not,
+	Negate,
+	Binary
+};
+
+struct FMDEditConditionNode
+{
+	EMDEditConditionNodeType Type = EMDEditConditionNodeType::Bool;
+
+	// The identifier, enum value or binary operator
+	FString Text;
+	double Number = 0.0;
+	bool bBool = false;
+
+	// Indices into the expression's nodes
+	int32 Lhs = INDEX_NONE;
+	int32 Rhs = INDEX_NONE;
+};
+
+/**
+ * An EditCondition value parsed into a tree, with the same operators the engine's EditCondition parser supports:
+ * ! && || == != < > <= >= + - * / and parentheses, bool/number/nullptr literals, properties and EMyEnum::Value
+ */
+class MDMETADATAEDITORGRAPH_API FMDEditConditionExpression
+{
+public:
+	// Parses the expression, check GetErrors() for syntax errors
+	explicit FMDEditConditionExpression(const FString& InExpression);
+
+	const FString& GetExpression() const { return Expression; }
+	const TArray<FMDEditConditionNode>& GetNodes() const { return Nodes; }
+	int32 GetRoot() const { return Root; }
+	const TArray<FText>& GetErrors() const { return Errors; }
+	bool IsValid() const { return Errors.Num() == 0; }
+
+	// Checks that every property exists on the owner and that the types work with the operators, returns the errors
+	TArray<FText> Validate(const UStruct* Owner) const;
+
+private:
+	enum class EValueType : uint8
+	{
+		Invalid,
+		Bool,
+		Number,
+		Enum,
+		Object,
+		Null
+	};
+
+	struct FValueType
+	{
+		EValueType Type = EValueType::Invalid;
+		const UEnum* Enum = nullptr;
+	};
+
+	struct FParser;
+
+	FValueType ValidateNode(int32 NodeIndex, const UStruct* Owner, TArray<FText>& OutErrors) const;
+
+	FString Expression;
+	TArray<FMDEditConditionNode> Nodes;
+	int32 Root = INDEX_NONE;
+	TArray<FText> Errors;
+};
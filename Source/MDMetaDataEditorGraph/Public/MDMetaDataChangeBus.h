@@ -0,0 +1,98 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ArrayView.h"
+#include "Containers/Ticker.h"
+#include "Delegates/Delegate.h"
+#include "MDMetaDataValuePool.h"
+#include "Misc/Optional.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+enum class EMDMetaDataChangeSource : uint8
+{
+	// Set or removed from the Meta Data Editor details panels
+	Editor,
+	// Dropped or restored while a User Defined Struct was being changed
+	StructChange,
+	// Applied to a compiled property by the Blueprint compiler extension
+	Compiler
+};
+
+/**
+ * The field that owns a piece of meta data
+ */
+struct FMDMetaDataChangeTarget
+{
+	// The Blueprint or User Defined Struct that owns the field
+	TWeakObjectPtr<UObject> Asset;
+
+	// The function that owns the field for params and local variables, otherwise None
+	FName ScopeName = NAME_None;
+
+	// The property or function name, None when the meta data is on the asset itself
+	FName FieldName = NAME_None;
+
+	bool operator==(const FMDMetaDataChangeTarget& Other) const
+	{
+		return Asset == Other.Asset && ScopeName == Other.ScopeName && FieldName == Other.FieldName;
+	}
+
+	friend uint32 GetTypeHash(const FMDMetaDataChangeTarget& Target)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Target.Asset), GetTypeHash(Target.ScopeName)), GetTypeHash(Target.FieldName));
+	}
+};
+
+struct FMDMetaDataChangeRecord
+{
+	FMDMetaDataChangeTarget Target;
+	FName Key = NAME_None;
+
+	// Set if the value was moved from another key, OldValue is then the value that key had
+	FName RenamedFrom = NAME_None;
+
+	// Unset if the key was added
+	TOptional<FMDMetaDataValue> OldValue;
+	// Unset if the key was removed
+	TOptional<FMDMetaDataValue> NewValue;
+
+	EMDMetaDataChangeSource Source = EMDMetaDataChangeSource::Editor;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FMDOnMetaDataChanged, TConstArrayView<FMDMetaDataChangeRecord>);
+
+/**
+ * Collects meta data changes made by the Meta Data Editor and delivers them to subscribers once per frame.
+ * Changes to the same key on the same field within a frame are merged into a single record, a key that's changed and then renamed is reported as renamed.
+ * Renaming onto a key that existed at the start of the frame is reported as the old key being removed and the new key being changed.
+ * Must only be used from the game thread.
+ */
+class MDMETADATAEDITORGRAPH_API FMDMetaDataChangeBus
+{
+public:
+	static FMDMetaDataChangeBus& Get();
+
+	void Publish(FMDMetaDataChangeRecord&& Record);
+	void Publish(const FMDMetaDataChangeTarget& Target, FName Key, TOptional<FMDMetaDataValue> OldValue, TOptional<FMDMetaDataValue> NewValue, EMDMetaDataChangeSource Source);
+	void PublishRename(const FMDMetaDataChangeTarget& Target, FName OldKey, FName NewKey, FMDMetaDataValue OldValue, FMDMetaDataValue NewValue, EMDMetaDataChangeSource Source);
+
+	// Delivers the pending batch right away instead of waiting for the next tick
+	void Flush();
+
+	// Drops any pending changes and stops ticking, called when the module shuts down
+	void Reset();
+
+	FMDOnMetaDataChanged OnMetaDataChanged;
+
+private:
+	bool Tick(float DeltaTime);
+
+	// Records that a key which had OriginalValue at the start of the frame has lost it, merging with whatever's pending for that key
+	void AddRemoval(const FMDMetaDataChangeTarget& Target, FName Key, TOptional<FMDMetaDataValue> OriginalValue, EMDMetaDataChangeSource Source);
+
+	TArray<FMDMetaDataChangeRecord> PendingRecords;
+	TMap<TPair<FMDMetaDataChangeTarget, FName>, int32> PendingRecordIndices;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,27 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Delegates/Delegate.h"
+
+class FCompilerResultsLog;
+class UBlueprint;
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FMDOnValidateCompiledBlueprint, const UBlueprint*, FCompilerResultsLog&);
+DECLARE_DELEGATE_RetVal_OneParam(bool, FMDIsRuntimeMetaDataKey, FName);
+
+/**
+ * Lets modules that the compiler extension can't depend on add their own checks to every Blueprint compile.
+ * Must only be used from the game thread.
+ */
+class MDMETADATAEDITORGRAPH_API FMDMetaDataCompilerHooks
+{
+public:
+	static FMDMetaDataCompilerHooks& Get();
+
+	// Broadcast at the end of each compile, once meta data has been applied to the new class's properties
+	FMDOnValidateCompiledBlueprint OnValidateCompiledBlueprint;
+
+	// Returns whether values for a key should be baked into the generated class's UMDMetaDataRuntimeTable, nothing is baked while unbound
+	FMDIsRuntimeMetaDataKey IsRuntimeMetaDataKey;
+};
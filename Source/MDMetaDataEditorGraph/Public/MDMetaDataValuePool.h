@@ -0,0 +1,118 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/ChunkedArray.h"
+#include "Containers/Map.h"
+#include "Containers/Set.h"
+#include "Containers/StringView.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/Optional.h"
+
+#include <atomic>
+
+// A value stored in FMDMetaDataValuePool, along with how many handles point at it
+struct FMDMetaDataPooledValue
+{
+	FString Value;
+	std::atomic<int32> NumReferences{ 0 };
+
+	// Only changed under the pool's write lock, false once the value has been removed and its slot is free for reuse
+	bool bIsPooled = false;
+};
+
+/**
+ * A reference counted handle to a meta data value stored once in FMDMetaDataValuePool, the value is removed from the pool once its last handle is gone.
+ * Comparing and hashing only touch the handle, and unlike FString, comparisons are case sensitive. The empty value doesn't use the pool.
+ */
+class MDMETADATAEDITORGRAPH_API FMDMetaDataValue
+{
+public:
+	FMDMetaDataValue() = default;
+	explicit FMDMetaDataValue(FStringView InValue);
+	FMDMetaDataValue(const FMDMetaDataValue& Other);
+	FMDMetaDataValue(FMDMetaDataValue&& Other);
+	~FMDMetaDataValue();
+
+	FMDMetaDataValue& operator=(const FMDMetaDataValue& Other);
+	FMDMetaDataValue& operator=(FMDMetaDataValue&& Other);
+
+	const FString& ToString() const { return (Value != nullptr) ? Value->Value : EmptyString; }
+	const FString& operator*() const { return ToString(); }
+	const FString* operator->() const { return &ToString(); }
+
+	bool operator==(const FMDMetaDataValue& Other) const { return Value == Other.Value; }
+	bool operator!=(const FMDMetaDataValue& Other) const { return Value != Other.Value; }
+
+	friend uint32 GetTypeHash(const FMDMetaDataValue& InValue)
+	{
+		return PointerHash(InValue.Value);
+	}
+
+private:
+	friend class FMDMetaDataValuePool;
+
+	// Takes over a reference that was already added
+	explicit FMDMetaDataValue(FMDMetaDataPooledValue* InValue)
+		: Value(InValue)
+	{
+	}
+
+	static const FString EmptyString;
+
+	FMDMetaDataPooledValue* Value = nullptr;
+};
+
+struct FMDMetaDataValuePoolStats
+{
+	// Distinct values in the pool
+	int32 NumValues = 0;
+	// Live handles to pooled values
+	uint64 NumReferences = 0;
+
+	// What the pool and the handles use
+	SIZE_T PoolBytes = 0;
+	// What the same references would use if each one were its own FString
+	SIZE_T UnpooledBytes = 0;
+
+	int64 GetBytesSaved() const { return static_cast<int64>(UnpooledBytes) - static_cast<int64>(PoolBytes); }
+};
+
+/**
+ * Interns the meta data values held by the editor's caches so that repeated values ("true", "0", tag lists, EditConditions) are only stored once.
+ * Can be used from any thread.
+ */
+class MDMETADATAEDITORGRAPH_API FMDMetaDataValuePool
+{
+public:
+	static FMDMetaDataValuePool& Get();
+
+	FMDMetaDataValue Intern(FStringView Value);
+	void InternMap(const TMap<FName, FString>& MetaData, TMap<FName, FMDMetaDataValue>& OutMetaData);
+
+	// Finds a value without adding it, for lookups into caches keyed by values
+	TOptional<FMDMetaDataValue> Find(FStringView Value) const;
+
+	FMDMetaDataValuePoolStats GetStats() const;
+
+private:
+	friend class FMDMetaDataValue;
+
+	// Returns false if the value's last handle is gone and it's waiting to be removed
+	static bool TryAddReference(FMDMetaDataPooledValue& Value);
+	void ReleaseReference(FMDMetaDataPooledValue& Value);
+
+	struct FValueKeyFuncs : BaseKeyFuncs<FMDMetaDataPooledValue*, FStringView>
+	{
+		static FStringView GetSetKey(const FMDMetaDataPooledValue* Element) { return Element->Value; }
+		static bool Matches(FStringView A, FStringView B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(FStringView Key) { return FCrc::MemCrc32(Key.GetData(), Key.Len() * sizeof(TCHAR)); }
+	};
+
+	mutable FRWLock Lock;
+
+	// Chunked so values never move once added, handles point straight at them. Removed values leave their slot to be reused.
+	TChunkedArray<FMDMetaDataPooledValue> Values;
+	TArray<FMDMetaDataPooledValue*> FreeValues;
+	TSet<FMDMetaDataPooledValue*, FValueKeyFuncs> ValueSet;
+};
@@ -0,0 +1,19 @@
+﻿// Copyright Dylan Dumesnil. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class MDMetaDataRuntime : ModuleRules
+{
+	public MDMetaDataRuntime(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject"
+			}
+		);
+	}
+}
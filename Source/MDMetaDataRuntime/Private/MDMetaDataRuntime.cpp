@@ -0,0 +1,5 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "Modules/ModuleManager.h"
+
+IMPLEMENT_MODULE(FDefaultModuleImpl, MDMetaDataRuntime)
@@ -0,0 +1,279 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#include "MDMetaDataRuntimeTable.h"
+
+#include "Runtime/Launch/Resources/Version.h"
+#include "UObject/Class.h"
+#include "UObject/MetaData.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+const FName UMDMetaDataRuntimeTable::TableName = TEXT("MDMetaDataRuntimeTable");
+
+const UMDMetaDataRuntimeTable* UMDMetaDataRuntimeTable::FindTable(const UStruct* Struct)
+{
+	if (Struct == nullptr)
+	{
+		return nullptr;
+	}
+
+	return FindObjectFast<UMDMetaDataRuntimeTable>(const_cast<UStruct*>(Struct), TableName);
+}
+
+bool UMDMetaDataRuntimeTable::FindMetaData(const UClass* Class, FName FieldName, FName Key, FStringView& OutValue)
+{
+	for (; Class != nullptr; Class = Class->GetSuperClass())
+	{
+		const UMDMetaDataRuntimeTable* Table = FindTable(Class);
+		if (Table != nullptr && Table->FindValue(FieldName, Key, OutValue))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UMDMetaDataRuntimeTable::FindMetaData(const FProperty* Property, FName Key, FStringView& OutValue)
+{
+	if (Property == nullptr)
+	{
+		return false;
+	}
+
+	// User Defined Struct members have no owner class, so go through the owner struct
+	const UMDMetaDataRuntimeTable* Table = FindTable(Property->GetOwnerStruct());
+	return Table != nullptr && Table->FindValue(Property->GetFName(), Key, OutValue);
+}
+
+bool UMDMetaDataRuntimeTable::FindMetaData(const UFunction* Function, FName Key, FStringView& OutValue)
+{
+	if (Function == nullptr)
+	{
+		return false;
+	}
+
+	const UMDMetaDataRuntimeTable* Table = FindTable(Function->GetOwnerClass());
+	return Table != nullptr && Table->FindValue(Function->GetFName(), Key, OutValue);
+}
+
+int32 UMDMetaDataRuntimeTable::FindFieldIndex(FName FieldName) const
+{
+	const int32* FieldIndex = FieldIndices.Find(FieldName);
+	return (FieldIndex != nullptr) ? *FieldIndex : INDEX_NONE;
+}
+
+int32 UMDMetaDataRuntimeTable::FindKeyIndex(FName Key) const
+{
+	const int32* KeyIndex = KeyIndices.Find(Key);
+	return (KeyIndex != nullptr) ? *KeyIndex : INDEX_NONE;
+}
+
+bool UMDMetaDataRuntimeTable::GetValue(int32 FieldIndex, int32 KeyIndex, FStringView& OutValue) const
+{
+	if (!Fields.IsValidIndex(FieldIndex) || !Keys.IsValidIndex(KeyIndex))
+	{
+		return false;
+	}
+
+	const int32 EntryIndex = EntrySlots[FieldIndex * Keys.Num() + KeyIndex];
+	if (EntryIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const FMDMetaDataRuntimeEntry& Entry = Entries[EntryIndex];
+	OutValue = FStringView(*Values + Entry.ValueStart, Entry.ValueLength);
+	return true;
+}
+
+bool UMDMetaDataRuntimeTable::FindValue(FName FieldName, FName Key, FStringView& OutValue) const
+{
+	return GetValue(FindFieldIndex(FieldName), FindKeyIndex(Key), OutValue);
+}
+
+#if WITH_EDITOR
+bool UMDMetaDataRuntimeTable::BakeStruct(UStruct* Struct, TFunctionRef<bool(FName)> IsRuntimeKey)
+{
+	if (!IsValid(Struct))
+	{
+		return false;
+	}
+
+	TMap<FName, TMap<FName, FString>> FieldMetaData;
+	auto AddFieldMetaData = [&IsRuntimeKey, &FieldMetaData](FName FieldName, const TMap<FName, FString>* MetaData)
+	{
+		if (MetaData == nullptr)
+		{
+			return;
+		}
+
+		for (const TPair<FName, FString>& MetaDataPair : *MetaData)
+		{
+			if (IsRuntimeKey(MetaDataPair.Key))
+			{
+				FieldMetaData.FindOrAdd(FieldName).Add(MetaDataPair.Key, MetaDataPair.Value);
+			}
+		}
+	};
+
+	for (TFieldIterator<FProperty> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+	{
+		AddFieldMetaData(It->GetFName(), It->GetMetaDataMap());
+	}
+
+	if (Struct->IsA<UClass>())
+	{
+		for (TFieldIterator<UFunction> It(Struct, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+		{
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 6) // On or after UE 5.6
+			AddFieldMetaData(It->GetFName(), FMetaData::GetMapForObject(*It));
+#else // Pre UE 5.6
+			AddFieldMetaData(It->GetFName(), UMetaData::GetMapForObject(*It));
+#endif
+		}
+	}
+
+	UMDMetaDataRuntimeTable* Table = FindObjectFast<UMDMetaDataRuntimeTable>(Struct, TableName);
+	if (FieldMetaData.IsEmpty())
+	{
+		if (Table == nullptr)
+		{
+			return false;
+		}
+
+		Table->Rename(nullptr, GetTransientPackage(), REN_DontCreateRedirectors | REN_NonTransactional | REN_DoNotDirty);
+		Table->MarkAsGarbage();
+		return true;
+	}
+
+	if (Table == nullptr)
+	{
+		// Public so it's saved and cooked with the struct even though nothing references it
+		Table = NewObject<UMDMetaDataRuntimeTable>(Struct, TableName, RF_Public);
+	}
+
+	return Table->Bake(FieldMetaData);
+}
+
+bool UMDMetaDataRuntimeTable::Bake(const TMap<FName, TMap<FName, FString>>& FieldMetaData)
+{
+	const TArray<FName> OldKeys = MoveTemp(Keys);
+	const FString OldValues = MoveTemp(Values);
+	const TArray<FMDMetaDataRuntimeField> OldFields = MoveTemp(Fields);
+	const TArray<FMDMetaDataRuntimeEntry> OldEntries = MoveTemp(Entries);
+
+	Keys.Reset();
+	Values.Reset();
+	Fields.Reset();
+	Entries.Reset();
+
+	TArray<FName> FieldNames;
+	FieldMetaData.GenerateKeyArray(FieldNames);
+	FieldNames.Sort(FNameLexicalLess());
+
+	TSet<FName> UniqueKeys;
+	for (const TPair<FName, TMap<FName, FString>>& FieldPair : FieldMetaData)
+	{
+		for (const TPair<FName, FString>& MetaDataPair : FieldPair.Value)
+		{
+			UniqueKeys.Add(MetaDataPair.Key);
+		}
+	}
+
+	Keys = UniqueKeys.Array();
+	Keys.Sort(FNameLexicalLess());
+	if (!ensureMsgf(Keys.Num() <= MAX_uint16, TEXT("Too many runtime meta data keys to bake into %s"), *GetPathName()))
+	{
+		Keys.Reset();
+		BuildLookups();
+		return !OldKeys.IsEmpty();
+	}
+
+	TMap<FName, int32> BakeKeyIndices;
+	for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); ++KeyIndex)
+	{
+		BakeKeyIndices.Add(Keys[KeyIndex], KeyIndex);
+	}
+
+	// Many fields share values, so each distinct value is only stored once
+	TMap<FString, int32> ValueStarts;
+	TArray<FName> FieldKeys;
+	for (const FName& FieldName : FieldNames)
+	{
+		const TMap<FName, FString>& MetaData = FieldMetaData.FindChecked(FieldName);
+		if (MetaData.IsEmpty())
+		{
+			continue;
+		}
+
+		FMDMetaDataRuntimeField& Field = Fields.AddDefaulted_GetRef();
+		Field.FieldName = FieldName;
+		Field.FirstEntry = Entries.Num();
+		Field.NumEntries = MetaData.Num();
+
+		MetaData.GenerateKeyArray(FieldKeys);
+		FieldKeys.Sort(FNameLexicalLess());
+		for (const FName& Key : FieldKeys)
+		{
+			const FString& Value = MetaData.FindChecked(Key);
+
+			int32* ValueStart = ValueStarts.Find(Value);
+			if (ValueStart == nullptr)
+			{
+				ValueStart = &ValueStarts.Add(Value, Values.Len());
+				Values.Append(Value);
+			}
+
+			FMDMetaDataRuntimeEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.KeyIndex = static_cast<uint16>(BakeKeyIndices.FindChecked(Key));
+			Entry.ValueStart = *ValueStart;
+			Entry.ValueLength = Value.Len();
+		}
+	}
+
+	Keys.Shrink();
+	Values.Shrink();
+	Fields.Shrink();
+	Entries.Shrink();
+
+	BuildLookups();
+
+	return Keys != OldKeys || !Values.Equals(OldValues, ESearchCase::CaseSensitive) || Fields != OldFields || Entries != OldEntries;
+}
+#endif
+
+void UMDMetaDataRuntimeTable::PostLoad()
+{
+	Super::PostLoad();
+
+	BuildLookups();
+}
+
+void UMDMetaDataRuntimeTable::BuildLookups()
+{
+	FieldIndices.Reset();
+	KeyIndices.Reset();
+	EntrySlots.Reset();
+
+	for (int32 KeyIndex = 0; KeyIndex < Keys.Num(); ++KeyIndex)
+	{
+		KeyIndices.Add(Keys[KeyIndex], KeyIndex);
+	}
+
+	EntrySlots.Init(INDEX_NONE, Fields.Num() * Keys.Num());
+	for (int32 FieldIndex = 0; FieldIndex < Fields.Num(); ++FieldIndex)
+	{
+		const FMDMetaDataRuntimeField& Field = Fields[FieldIndex];
+		FieldIndices.Add(Field.FieldName, FieldIndex);
+
+		for (int32 EntryIndex = Field.FirstEntry; EntryIndex < Field.FirstEntry + Field.NumEntries && Entries.IsValidIndex(EntryIndex); ++EntryIndex)
+		{
+			const int32 KeyIndex = Entries[EntryIndex].KeyIndex;
+			if (Keys.IsValidIndex(KeyIndex))
+			{
+				EntrySlots[FieldIndex * Keys.Num() + KeyIndex] = EntryIndex;
+			}
+		}
+	}
+}
@@ -0,0 +1,118 @@
+// Copyright Dylan Dumesnil. All Rights Reserved.
+
+#pragma once
+
+#include "Containers/StringView.h"
+#include "UObject/Object.h"
+
+#include "MDMetaDataRuntimeTable.generated.h"
+
+USTRUCT()
+struct FMDMetaDataRuntimeEntry
+{
+	GENERATED_BODY()
+
+	// Index into the table's Keys
+	UPROPERTY()
+	uint16 KeyIndex = 0;
+
+	// Where the value is in the table's Values
+	UPROPERTY()
+	int32 ValueStart = 0;
+
+	UPROPERTY()
+	int32 ValueLength = 0;
+
+	bool operator==(const FMDMetaDataRuntimeEntry& Other) const
+	{
+		return KeyIndex == Other.KeyIndex && ValueStart == Other.ValueStart && ValueLength == Other.ValueLength;
+	}
+};
+
+USTRUCT()
+struct FMDMetaDataRuntimeField
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FName FieldName = NAME_None;
+
+	// The field's entries are Entries[FirstEntry, FirstEntry + NumEntries)
+	UPROPERTY()
+	int32 FirstEntry = 0;
+
+	UPROPERTY()
+	int32 NumEntries = 0;
+
+	bool operator==(const FMDMetaDataRuntimeField& Other) const
+	{
+		return FieldName == Other.FieldName && FirstEntry == Other.FirstEntry && NumEntries == Other.NumEntries;
+	}
+};
+
+/**
+ * The meta data of a Blueprint's variables and functions, or a User Defined Struct's members, for keys flagged as available at runtime.
+ * Meta data is editor-only, this table is saved with the generated class or struct so the flagged keys can still be read in cooked builds.
+ * Lookups are hash lookups on names followed by array indexing, so they don't touch FString maps.
+ */
+UCLASS()
+class MDMETADATARUNTIME_API UMDMetaDataRuntimeTable : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	static const FName TableName;
+
+	// Finds the table baked into a generated class or User Defined Struct, super classes have their own tables
+	static const UMDMetaDataRuntimeTable* FindTable(const UStruct* Struct);
+
+	// Finds the value of Key on a variable or function of Class or its super classes
+	static bool FindMetaData(const UClass* Class, FName FieldName, FName Key, FStringView& OutValue);
+	// Looked up in the table of the class or struct that owns the property, function params aren't baked
+	static bool FindMetaData(const FProperty* Property, FName Key, FStringView& OutValue);
+	static bool FindMetaData(const UFunction* Function, FName Key, FStringView& OutValue);
+
+	// Indices can be cached by callers that look up the same field or key often, they're valid until the class is recompiled
+	int32 FindFieldIndex(FName FieldName) const;
+	int32 FindKeyIndex(FName Key) const;
+	bool GetValue(int32 FieldIndex, int32 KeyIndex, FStringView& OutValue) const;
+
+	bool FindValue(FName FieldName, FName Key, FStringView& OutValue) const;
+
+	const TArray<FName>& GetKeys() const { return Keys; }
+	const TArray<FMDMetaDataRuntimeField>& GetFields() const { return Fields; }
+
+#if WITH_EDITOR
+	// Bakes the values of runtime keys on the struct's properties, and functions if it's a class, into its table.
+	// The table is created or removed as needed, returns whether the baked values changed.
+	static bool BakeStruct(UStruct* Struct, TFunctionRef<bool(FName)> IsRuntimeKey);
+
+	// Replaces the contents of the table with FieldMetaData (field name -> key -> value), sorted so cooks are deterministic.
+	// Returns whether the contents changed.
+	bool Bake(const TMap<FName, TMap<FName, FString>>& FieldMetaData);
+#endif
+
+	virtual void PostLoad() override;
+
+private:
+	void BuildLookups();
+
+	UPROPERTY()
+	TArray<FName> Keys;
+
+	// Every distinct value, back to back
+	UPROPERTY()
+	FString Values;
+
+	UPROPERTY()
+	TArray<FMDMetaDataRuntimeField> Fields;
+
+	UPROPERTY()
+	TArray<FMDMetaDataRuntimeEntry> Entries;
+
+	TMap<FName, int32> FieldIndices;
+	TMap<FName, int32> KeyIndices;
+
+	// Fields.Num() x Keys.Num() indices into Entries, INDEX_NONE where the field has no value for the key
+	TArray<int32> EntrySlots;
+};